@@ -126,3 +126,14 @@ enum class EAGX_ROS2QosHistory
 	KeepLastHistoryQos,
 	KeepAllHistoryQos
 };
+
+/** Specifies what an asynchronous ROS2 Publisher does when the queue of a topic is full. */
+UENUM()
+enum class EAGX_ROS2QueueFullPolicy
+{
+	/** The oldest queued message of the topic is discarded to make room for the new one. */
+	DropOldest,
+
+	/** The sender waits until the background thread has published a message of the topic. */
+	Block
+};
@@ -262,6 +262,14 @@ void UAGX_RigidBodyComponent::SetNativeAddress(uint64 NativeAddress)
 	if (HasNative())
 	{
 		MergeSplitProperties.BindBarrierToOwner(*GetNative());
+
+		// The native is being handed over from another Component, e.g. during Blueprint
+		// reconstruction, so it is already part of the Simulation. Make sure GUID lookups find
+		// this Component instead of the previous owner.
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		{
+			Simulation->RegisterGuid(*this);
+		}
 	}
 }
 
@@ -301,6 +309,20 @@ void UAGX_RigidBodyComponent::BeginPlay()
 
 		MergeSplitProperties.OnBeginPlay(*this);
 	}
+
+	if (HasNative())
+	{
+		// With batched synchronization the Simulation reads the state of all Rigid Bodies at once,
+		// so Tick Component skips the per-body synchronization. Subclasses, including Blueprint
+		// classes, may have their own Tick so only plain Rigid Body Components stop ticking.
+		UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
+		if (Simulation != nullptr && Simulation->bEnableBatchedRigidBodySync)
+		{
+			Simulation->AddToBatchedSync(*this);
+			if (GetClass() == UAGX_RigidBodyComponent::StaticClass())
+				SetComponentTickEnabled(false);
+		}
+	}
 }
 
 /// \todo Split the UAGX_RigidBodyComponent::TickComponent callback into two
@@ -315,7 +337,7 @@ void UAGX_RigidBodyComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	if (MotionControl != MC_STATIC)
+	if (MotionControl != MC_STATIC && BatchedSyncIndex == INDEX_NONE)
 	{
 		// ReadTransformFromNative may trigger user callbacks, e.g. On Begin Overlap, which may
 		// remove this Rigid Body from the simulation.
@@ -328,10 +350,37 @@ void UAGX_RigidBodyComponent::TickComponent(
 	}
 }
 
+void UAGX_RigidBodyComponent::SynchronizeFromNative(
+	const FVector& InPosition, const FQuat& InRotation, const FVector& InVelocity,
+	const FVector& InAngularVelocity)
+{
+	if (MotionControl == MC_STATIC || !HasNative())
+	{
+		return;
+	}
+
+	// ApplyTransformFromNative may trigger user callbacks, e.g. On Begin Overlap, which may remove
+	// this Rigid Body from the simulation.
+	ApplyTransformFromNative(InPosition, InRotation, InVelocity);
+	if (HasNative())
+	{
+		Velocity = InVelocity;
+		AngularVelocity = InAngularVelocity;
+	}
+}
+
 void UAGX_RigidBodyComponent::EndPlay(const EEndPlayReason::Type Reason)
 {
 	Super::EndPlay(Reason);
 
+	if (BatchedSyncIndex != INDEX_NONE)
+	{
+		if (UAGX_Simulation* Sim = UAGX_Simulation::GetFrom(this))
+		{
+			Sim->RemoveFromBatchedSync(*this);
+		}
+	}
+
 	if (GIsReconstructingBlueprintInstances)
 	{
 		// Another UAGX_RigidBodyComponent will inherit this one's Native, so don't wreck it.
@@ -573,10 +622,14 @@ bool UAGX_RigidBodyComponent::ReadTransformFromNative()
 		return false;
 	}
 
-	const FVector NewLocation = NativeBarrier.GetPosition();
-	const FQuat NewRotation = NativeBarrier.GetRotation();
+	return ApplyTransformFromNative(
+		NativeBarrier.GetPosition(), NativeBarrier.GetRotation(), NativeBarrier.GetVelocity());
+}
 
-	auto TransformSelf = [this, &NewLocation, &NewRotation]()
+bool UAGX_RigidBodyComponent::ApplyTransformFromNative(
+	const FVector& NewLocation, const FQuat& NewRotation, const FVector& NewVelocity)
+{
+	auto TransformSelf = [this, &NewLocation, &NewRotation, &NewVelocity]()
 	{
 		const FVector OldLocation = GetComponentLocation();
 		const FVector LocationDelta = NewLocation - OldLocation;
@@ -585,12 +638,13 @@ bool UAGX_RigidBodyComponent::ReadTransformFromNative()
 		MoveComponent(LocationDelta, NewRotation, false);
 		if (HasNative())
 		{
-			ComponentVelocity = NativeBarrier.GetVelocity();
+			ComponentVelocity = NewVelocity;
 		}
 		return true;
 	};
 
-	auto TransformAncestor = [this, &NewLocation, &NewRotation](USceneComponent& Ancestor)
+	auto TransformAncestor =
+		[this, &NewLocation, &NewRotation, &NewVelocity](USceneComponent& Ancestor)
 	{
 		// Where Ancestor is relative to RigidBodyComponent, i.e., how the AGX Dynamics
 		// transformation should be changed in order to be applicable to Ancestor.
@@ -614,7 +668,7 @@ bool UAGX_RigidBodyComponent::ReadTransformFromNative()
 		Ancestor.SetWorldTransform(NewTransform);
 		if (HasNative())
 		{
-			Ancestor.ComponentVelocity = NativeBarrier.GetVelocity();
+			Ancestor.ComponentVelocity = NewVelocity;
 		}
 	};
 
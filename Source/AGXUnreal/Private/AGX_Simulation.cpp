@@ -15,7 +15,6 @@
 #include "AMOR/AGX_WireMergeSplitThresholds.h"
 #include "Cable/AGX_CableComponent.h"
 #include "Constraints/AGX_ConstraintComponent.h"
-#include "Contacts/ContactListenerBarrier.h"
 #include "Materials/AGX_ContactMaterial.h"
 #include "Materials/AGX_ShapeMaterial.h"
 #include "Materials/AGX_TerrainMaterial.h"
@@ -129,6 +128,30 @@ FAGX_Statistics UAGX_Simulation::GetStatistics()
 	return NativeBarrier.GetStatistics();
 }
 
+TArray<FAGX_StatisticsSample> UAGX_Simulation::GetStatisticsHistory() const
+{
+	TArray<FAGX_StatisticsSample> Samples;
+	StatisticsHistory.GetSamples(Samples);
+	return Samples;
+}
+
+bool UAGX_Simulation::GetStatisticsSummary(
+	FName StatisticName, double Percentile, FAGX_StatisticsSummary& OutSummary) const
+{
+	return StatisticsHistory.GetSummary(StatisticName, Percentile, OutSummary);
+}
+
+bool UAGX_Simulation::ExportStatisticsHistory(const FString& FilePath) const
+{
+	return StatisticsHistory.ExportCsv(FilePath);
+}
+
+void UAGX_Simulation::ClearStatisticsHistory()
+{
+	StatisticsHistory.Reset();
+	StepsSinceStatisticsSample = 0;
+}
+
 namespace AGX_Simulation_helpers
 {
 	template <typename T>
@@ -152,6 +175,7 @@ namespace AGX_Simulation_helpers
 			return false;
 		}
 
+		Sim.WaitForStepForward();
 		return Sim.GetNative()->Add(*ActorOrComponent.GetNative());
 	}
 
@@ -176,6 +200,7 @@ namespace AGX_Simulation_helpers
 			return false;
 		}
 
+		Sim.WaitForStepForward();
 		return Sim.GetNative()->Add(*Asset.GetNative());
 	}
 
@@ -201,6 +226,7 @@ namespace AGX_Simulation_helpers
 			return false;
 		}
 
+		Sim.WaitForStepForward();
 		return Sim.GetNative()->Remove(*ActorOrComponent.GetNative());
 	}
 
@@ -225,6 +251,7 @@ namespace AGX_Simulation_helpers
 			return false;
 		}
 
+		Sim.WaitForStepForward();
 		return Sim.GetNative()->Remove(*Asset.GetNative());
 	}
 
@@ -239,6 +266,46 @@ namespace AGX_Simulation_helpers
 		return LoadObject<T>(GetTransientPackage(), *Path.GetAssetPathString());
 	}
 
+	template <typename T>
+	void Unregister(TMap<FGuid, TWeakObjectPtr<T>>& Registry, const FGuid& Guid, T& Component)
+	{
+		// Another Component may have taken over the native, e.g. during Blueprint reconstruction.
+		const TWeakObjectPtr<T>* Registered = Registry.Find(Guid);
+		if (Registered != nullptr && Registered->Get() == &Component)
+		{
+			Registry.Remove(Guid);
+		}
+	}
+
+	bool IsMatch(const UAGX_ShapeComponent* Shape, const FGuid& Guid)
+	{
+		return Shape != nullptr && Shape->HasNative() &&
+			   Shape->GetNative()->GetGeometryGuid() == Guid;
+	}
+
+	bool IsMatch(const UAGX_RigidBodyComponent* Body, const FGuid& Guid)
+	{
+		return Body != nullptr && Body->HasNative() && Body->GetNative()->GetGuid() == Guid;
+	}
+
+	template <typename T>
+	T* FindInRegistry(const TMap<FGuid, TWeakObjectPtr<T>>& Registry, const FGuid& Guid)
+	{
+		if (!Guid.IsValid())
+		{
+			return nullptr;
+		}
+
+		const TWeakObjectPtr<T>* Registered = Registry.Find(Guid);
+		if (Registered == nullptr)
+		{
+			return nullptr;
+		}
+
+		T* Component = Registered->Get();
+		return IsMatch(Component, Guid) ? Component : nullptr;
+	}
+
 #if WITH_EDITOR
 	template <typename T>
 	void CloseInstancedAssetEditors()
@@ -283,13 +350,23 @@ bool UAGX_Simulation::Add(UAGX_ObserverFrameComponent& Frame)
 bool UAGX_Simulation::Add(UAGX_RigidBodyComponent& Body)
 {
 	EnsureStepperCreated();
-	return AGX_Simulation_helpers::Add(*this, Body);
+	const bool bAdded = AGX_Simulation_helpers::Add(*this, Body);
+	if (bAdded)
+	{
+		RegisterGuid(Body);
+	}
+	return bAdded;
 }
 
 bool UAGX_Simulation::Add(UAGX_ShapeComponent& Shape)
 {
 	EnsureStepperCreated();
-	return AGX_Simulation_helpers::Add(*this, Shape);
+	const bool bAdded = AGX_Simulation_helpers::Add(*this, Shape);
+	if (bAdded)
+	{
+		RegisterGuid(Shape);
+	}
+	return bAdded;
 }
 
 bool UAGX_Simulation::Add(UAGX_ShapeMaterial& Material)
@@ -338,6 +415,7 @@ bool UAGX_Simulation::Add(AAGX_Terrain& Terrain)
 		return false;
 	}
 
+	WaitForStepForward();
 	const bool Result = [this, &Terrain]()
 	{
 		if (Terrain.bEnableTerrainPaging)
@@ -376,6 +454,7 @@ void UAGX_Simulation::Add(UAGX_MovableTerrainComponent& MovableTerrain)
 		return;
 	}
 
+	WaitForStepForward();
 	bool result = GetNative()->Add(*MovableTerrain.GetNative());
 
 	if (!result)
@@ -425,11 +504,20 @@ bool UAGX_Simulation::Remove(UAGX_ObserverFrameComponent& Frame)
 
 bool UAGX_Simulation::Remove(UAGX_RigidBodyComponent& Body)
 {
+	if (Body.HasNative())
+	{
+		AGX_Simulation_helpers::Unregister(RigidBodiesByGuid, Body.GetNative()->GetGuid(), Body);
+	}
 	return AGX_Simulation_helpers::Remove(*this, Body);
 }
 
 bool UAGX_Simulation::Remove(UAGX_ShapeComponent& Shape)
 {
+	if (Shape.HasNative())
+	{
+		AGX_Simulation_helpers::Unregister(
+			ShapesByGuid, Shape.GetNative()->GetGeometryGuid(), Shape);
+	}
 	return AGX_Simulation_helpers::Remove(*this, Shape);
 }
 
@@ -475,6 +563,7 @@ bool UAGX_Simulation::Remove(AAGX_Terrain& Terrain)
 		return false;
 	}
 
+	WaitForStepForward();
 	const bool Result = [this, &Terrain]()
 	{
 		if (Terrain.bEnableTerrainPaging)
@@ -513,6 +602,7 @@ void UAGX_Simulation::Remove(UAGX_MovableTerrainComponent& MovableTerrain)
 		return;
 	}
 
+	WaitForStepForward();
 	const bool Result = GetNative()->Remove(*MovableTerrain.GetNative());
 
 	if (!Result)
@@ -571,6 +661,7 @@ void UAGX_Simulation::Register(UAGX_ContactMaterial& Material)
 	// When the count goes from 0 to 1, we add the Contact Material to the Simulation.
 	if (Count == 1)
 	{
+		WaitForStepForward();
 		if (!GetNative()->Add(*Material.GetNative()))
 		{
 			UE_LOG(
@@ -621,6 +712,7 @@ void UAGX_Simulation::Unregister(UAGX_ContactMaterial& Material)
 	// When the count goes down to 0, we remove the Contact Material from the Simulation.
 	if (Count == 0)
 	{
+		WaitForStepForward();
 		if (!GetNative()->Remove(*Material.GetNative()))
 		{
 			UE_LOG(
@@ -638,6 +730,7 @@ void UAGX_Simulation::SetEnableCollisionGroupPair(
 	const FName& Group1, const FName& Group2, bool CanCollide)
 {
 	EnsureStepperCreated();
+	WaitForStepForward();
 	NativeBarrier.SetEnableCollisionGroupPair(Group1, Group2, CanCollide);
 }
 
@@ -674,6 +767,20 @@ TArray<FAGX_ShapeContact> UAGX_Simulation::GetShapeContacts() const
 	return ShapeContacts;
 }
 
+void UAGX_Simulation::GetShapeContactSnapshot(
+	FAGX_ShapeContactSnapshot& Snapshot, const FAGX_ShapeContactFilter& Filter)
+{
+	if (!HasNative())
+	{
+		Snapshot.Reset();
+		return;
+	}
+
+	// The contacts are rewritten during the step.
+	WaitForStepForward();
+	NativeBarrier.GetShapeContactSnapshot(Filter, Snapshot);
+}
+
 void UAGX_Simulation::Internal_EnableThreadTimeline()
 {
 	if (!HasNative())
@@ -852,6 +959,10 @@ void UAGX_Simulation::InitPropertyDispatcher()
 		GET_MEMBER_NAME_CHECKED(UAGX_Simulation, bEnableAMOR),
 		[](ThisClass* This) { This->SetEnableAMOR(This->bEnableAMOR); });
 
+	PropertyDispatcher.Add(
+		GET_MEMBER_NAME_CHECKED(ThisClass, bEnableAsyncStepping),
+		[](ThisClass* This) { This->SetEnableAsyncStepping(This->bEnableAsyncStepping); });
+
 	PropertyDispatcher.Add(
 		GET_MEMBER_NAME_CHECKED(ThisClass, NumThreads),
 		[](ThisClass* This) { This->SetNumThreads(This->NumThreads); });
@@ -927,7 +1038,7 @@ void UAGX_Simulation::CreateNative()
 
 	if (bEnableGlobalContactEventListener)
 	{
-		CreateContactEventListener(
+		GlobalContactEventListener.AllocateNative(
 			NativeBarrier, [this](double TimeStamp, FShapeContactBarrier& Contact)
 			{ return ImpactCallback(TimeStamp, Contact); },
 			[this](double TimeStamp, FShapeContactBarrier& Contact)
@@ -1035,6 +1146,19 @@ namespace AGX_Simulation_helpers
 		}
 	}
 
+	/**
+	 * True when Unreal Engine is collecting stats, e.g. because a 'stat' command is active. The
+	 * stat counters are no-ops otherwise, so there is no need to read the statistics for them.
+	 */
+	bool IsCollectingStats()
+	{
+#if STATS
+		return FThreadStats::IsCollectingData();
+#else
+		return false;
+#endif
+	}
+
 	void ReportStepStatistics(const FAGX_Statistics& Statistics)
 	{
 		// These are the same lines repeated over and over with some rather long
@@ -1185,30 +1309,33 @@ void UAGX_Simulation::Step(double DeltaTime)
 	}
 #endif
 
+	// The join Tick Function should have run last frame, but it may have been disabled or
+	// unregistered at some point. Never start a new step on top of one in flight.
+	FinishAsyncStep();
+
 	const uint64 StartCycle = FPlatformTime::Cycles64();
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:UAGX_Simulation::Step"));
-	int32 NumSteps = 0;
-	switch (StepMode)
+	const int32 NumSteps = GetNumStepsToTake(DeltaTime);
+
+	if (NumSteps > 0 && CanStepAsync())
 	{
-		case SmCatchUpImmediately:
-			NumSteps = StepCatchUpImmediately(DeltaTime);
-			break;
-		case SmCatchUpOverTime:
-			NumSteps = StepCatchUpOverTime(DeltaTime);
-			break;
-		case SmCatchUpOverTimeCapped:
-			NumSteps = StepCatchUpOverTimeCapped(DeltaTime);
-			break;
-		case SmDropImmediately:
-			NumSteps = StepDropImmediately(DeltaTime);
-			break;
-		case SmNone:
-			NumSteps = 0;
-			break;
-		default:
-			UE_LOG(LogAGX, Error, TEXT("Unknown step mode: %d"), StepMode);
+		// Statistics and stat counters are reported by FinishAsyncStep.
+		StartAsyncStep(NumSteps, StartCycle, DeltaTime);
+		return;
 	}
 
+	for (int32 I = 0; I < NumSteps; ++I)
+	{
+		StepForward();
+	}
+
+	ReportFrameStepped(NumSteps, StartCycle, DeltaTime);
+}
+
+void UAGX_Simulation::ReportFrameStepped(int32 NumSteps, uint64 StartCycle, double DeltaTime)
+{
+	using namespace AGX_Simulation_helpers;
+
 	SET_DWORD_STAT(STAT_AGXU_NumSteps, NumSteps);
 
 	// Unreal Engine will zero the stat counters every frame. If we can run the game loop faster
@@ -1233,10 +1360,9 @@ void UAGX_Simulation::Step(double DeltaTime)
 	// it. Note that we do not call the frame accumulation version. This means that the frame timers
 	// will be zero when no stepping was made. This makes it possible to see that no step was made
 	// in a frame.
-	if (bEnableStatistics)
+	if (bEnableStatistics && IsCollectingStats())
 	{
-		FAGX_Statistics AGXStatistics = GetStatistics();
-		ReportStepStatistics(AGXStatistics);
+		ReportStepStatistics(LastStepStatistics);
 	}
 
 	if (bDrawShapeContacts)
@@ -1249,7 +1375,27 @@ void UAGX_Simulation::Step(double DeltaTime)
 	}
 }
 
-int32 UAGX_Simulation::StepCatchUpImmediately(double DeltaTime)
+int32 UAGX_Simulation::GetNumStepsToTake(double DeltaTime)
+{
+	switch (StepMode)
+	{
+		case SmCatchUpImmediately:
+			return GetNumStepsCatchUpImmediately(DeltaTime);
+		case SmCatchUpOverTime:
+			return GetNumStepsCatchUpOverTime(DeltaTime);
+		case SmCatchUpOverTimeCapped:
+			return GetNumStepsCatchUpOverTimeCapped(DeltaTime);
+		case SmDropImmediately:
+			return GetNumStepsDropImmediately(DeltaTime);
+		case SmNone:
+			return 0;
+		default:
+			UE_LOG(LogAGX, Error, TEXT("Unknown step mode: %d"), StepMode);
+			return 0;
+	}
+}
+
+int32 UAGX_Simulation::GetNumStepsCatchUpImmediately(double DeltaTime)
 {
 	DeltaTime += LeftoverTime;
 	LeftoverTime = 0.0;
@@ -1257,20 +1403,14 @@ int32 UAGX_Simulation::StepCatchUpImmediately(double DeltaTime)
 	int32 NumSteps = 0;
 	while (DeltaTime >= TimeStep)
 	{
-		PreStep();
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step"));
-			NativeBarrier.Step();
-		}
 		++NumSteps;
 		DeltaTime -= TimeStep;
-		PostStep();
 	}
 	LeftoverTime = DeltaTime;
 	return NumSteps;
 }
 
-int32 UAGX_Simulation::StepCatchUpOverTime(double DeltaTime)
+int32 UAGX_Simulation::GetNumStepsCatchUpOverTime(double DeltaTime)
 {
 	DeltaTime += LeftoverTime;
 	LeftoverTime = 0.0;
@@ -1281,14 +1421,8 @@ int32 UAGX_Simulation::StepCatchUpOverTime(double DeltaTime)
 	{
 		if (DeltaTime >= TimeStep)
 		{
-			PreStep();
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step"));
-				NativeBarrier.Step();
-			}
 			++NumSteps;
 			DeltaTime -= TimeStep;
-			PostStep();
 		}
 	}
 
@@ -1296,7 +1430,7 @@ int32 UAGX_Simulation::StepCatchUpOverTime(double DeltaTime)
 	return NumSteps;
 }
 
-int32 UAGX_Simulation::StepCatchUpOverTimeCapped(double DeltaTime)
+int32 UAGX_Simulation::GetNumStepsCatchUpOverTimeCapped(double DeltaTime)
 {
 	DeltaTime += LeftoverTime;
 	LeftoverTime = 0.0;
@@ -1307,14 +1441,8 @@ int32 UAGX_Simulation::StepCatchUpOverTimeCapped(double DeltaTime)
 	{
 		if (DeltaTime >= TimeStep)
 		{
-			PreStep();
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step"));
-				NativeBarrier.Step();
-			}
 			++NumSteps;
 			DeltaTime -= TimeStep;
-			PostStep();
 		}
 	}
 
@@ -1323,7 +1451,7 @@ int32 UAGX_Simulation::StepCatchUpOverTimeCapped(double DeltaTime)
 	return NumSteps;
 }
 
-int32 UAGX_Simulation::StepDropImmediately(double DeltaTime)
+int32 UAGX_Simulation::GetNumStepsDropImmediately(double DeltaTime)
 {
 	DeltaTime += LeftoverTime;
 	LeftoverTime = 0.0;
@@ -1331,14 +1459,8 @@ int32 UAGX_Simulation::StepDropImmediately(double DeltaTime)
 	int32 NumSteps = 0;
 	if (DeltaTime >= TimeStep)
 	{
-		PreStep();
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step"));
-			NativeBarrier.Step();
-		}
 		++NumSteps;
 		DeltaTime -= TimeStep;
-		PostStep();
 	}
 
 	// Keep LeftoverTime updated in case the information is needed in the future.
@@ -1346,6 +1468,259 @@ int32 UAGX_Simulation::StepDropImmediately(double DeltaTime)
 	return NumSteps;
 }
 
+void UAGX_Simulation::StepForward()
+{
+	PreStep();
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step"));
+		NativeBarrier.Step();
+	}
+	PostStep();
+}
+
+bool UAGX_Simulation::CanStepAsync() const
+{
+	if (!bEnableAsyncStepping)
+		return false;
+
+	// Contact event callbacks are called from within the native step and would run game code on
+	// the worker thread.
+	if (NumContactEventListeners > 0)
+		return false;
+	if (bEnableGlobalContactEventListener &&
+		(OnImpact.IsBound() || OnContact.IsBound() || OnSeparation.IsBound()))
+		return false;
+
+	return true;
+}
+
+void UAGX_Simulation::StartAsyncStep(int32 NumSteps, uint64 StartCycle, double DeltaTime)
+{
+	check(IsInGameThread());
+	check(!AsyncStepEvent.IsValid());
+	check(NumSteps > 0);
+
+	AsyncStepNumSteps = NumSteps;
+	AsyncStepStartCycle = StartCycle;
+	AsyncStepDeltaTime = DeltaTime;
+
+	PreStep();
+
+	// The Simulation Barrier is owned by this Simulation, which outlives the task since every path
+	// that releases the native, or destroys the Simulation, first calls FinishAsyncStep.
+	FSimulationBarrier* Barrier = &NativeBarrier;
+	AsyncStepEvent = FFunctionGraphTask::CreateAndDispatchWhenReady(
+		[Barrier]()
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Native step (async)"));
+			Barrier->Step();
+		},
+		TStatId {}, nullptr, ENamedThreads::AnyBackgroundHiPriTask);
+}
+
+void UAGX_Simulation::FinishAsyncStep()
+{
+	if (!AsyncStepEvent.IsValid())
+		return;
+
+	check(IsInGameThread());
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:Wait for async step"));
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(AsyncStepEvent);
+	}
+	AsyncStepEvent = nullptr;
+
+	PostStep();
+
+	// Any additional steps needed to catch up are taken synchronously, so that Pre and Post Step
+	// Forward keep being broadcast around each step.
+	for (int32 I = 1; I < AsyncStepNumSteps; ++I)
+	{
+		StepForward();
+	}
+
+	ReportFrameStepped(AsyncStepNumSteps, AsyncStepStartCycle, AsyncStepDeltaTime);
+	AsyncStepNumSteps = 0;
+}
+
+void UAGX_Simulation::WaitForStepForward()
+{
+	FinishAsyncStep();
+}
+
+bool UAGX_Simulation::IsStepForwardInProgress() const
+{
+	return AsyncStepEvent.IsValid();
+}
+
+void UAGX_Simulation::SetEnableAsyncStepping(bool bEnable)
+{
+	if (!bEnable)
+		FinishAsyncStep();
+
+	bEnableAsyncStepping = bEnable;
+}
+
+bool UAGX_Simulation::GetEnableAsyncStepping() const
+{
+	return bEnableAsyncStepping;
+}
+
+ETickingGroup UAGX_Simulation::GetAsyncStepJoinTickGroup() const
+{
+	const ETickingGroup Group = AsyncStepJoinTickGroup.GetValue();
+	if (Group < TG_PrePhysics)
+		return TG_PrePhysics;
+	if (Group > TG_DuringPhysics)
+		return TG_DuringPhysics;
+	return Group;
+}
+
+void UAGX_Simulation::NotifyContactEventListenerCreated()
+{
+	++NumContactEventListeners;
+}
+
+void UAGX_Simulation::NotifyContactEventListenerDestroyed()
+{
+	// The count is reset when the native Simulation is released, listeners removed after that
+	// must not drive it negative.
+	NumContactEventListeners = FMath::Max(NumContactEventListeners - 1, 0);
+}
+
+UAGX_ShapeComponent* UAGX_Simulation::GetShapeComponentByGuid(const FGuid& GeometryGuid) const
+{
+	return AGX_Simulation_helpers::FindInRegistry(ShapesByGuid, GeometryGuid);
+}
+
+UAGX_RigidBodyComponent* UAGX_Simulation::GetRigidBodyComponentByGuid(const FGuid& Guid) const
+{
+	return AGX_Simulation_helpers::FindInRegistry(RigidBodiesByGuid, Guid);
+}
+
+UAGX_ShapeComponent* UAGX_Simulation::FindShapeComponentByGuid(const FGuid& GeometryGuid)
+{
+	// There is usually only a single Simulation with a native, or one per Play In Editor client.
+	for (TObjectIterator<UAGX_Simulation> It; It; ++It)
+	{
+		if (!It->HasNative())
+			continue;
+
+		if (UAGX_ShapeComponent* Shape = It->GetShapeComponentByGuid(GeometryGuid))
+			return Shape;
+	}
+	return nullptr;
+}
+
+UAGX_RigidBodyComponent* UAGX_Simulation::FindRigidBodyComponentByGuid(const FGuid& Guid)
+{
+	for (TObjectIterator<UAGX_Simulation> It; It; ++It)
+	{
+		if (!It->HasNative())
+			continue;
+
+		if (UAGX_RigidBodyComponent* Body = It->GetRigidBodyComponentByGuid(Guid))
+			return Body;
+	}
+	return nullptr;
+}
+
+void UAGX_Simulation::RegisterGuid(UAGX_ShapeComponent& Shape)
+{
+	if (!Shape.HasNative())
+		return;
+
+	ShapesByGuid.Add(Shape.GetNative()->GetGeometryGuid(), &Shape);
+}
+
+void UAGX_Simulation::RegisterGuid(UAGX_RigidBodyComponent& Body)
+{
+	if (!Body.HasNative())
+		return;
+
+	RigidBodiesByGuid.Add(Body.GetNative()->GetGuid(), &Body);
+}
+
+void UAGX_Simulation::AddToBatchedSync(UAGX_RigidBodyComponent& Body)
+{
+	if (Body.BatchedSyncIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	Body.BatchedSyncIndex = BatchedSyncBodies.Add(&Body);
+	EnsureStepperCreated();
+}
+
+void UAGX_Simulation::RemoveFromBatchedSync(UAGX_RigidBodyComponent& Body)
+{
+	const int32 Index = Body.BatchedSyncIndex;
+	Body.BatchedSyncIndex = INDEX_NONE;
+	if (!BatchedSyncBodies.IsValidIndex(Index) || BatchedSyncBodies[Index].Get() != &Body)
+	{
+		// The list has been cleared since the Rigid Body Component was added.
+		return;
+	}
+
+	// Move the last Rigid Body Component into the removed slot.
+	BatchedSyncBodies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (BatchedSyncBodies.IsValidIndex(Index))
+	{
+		if (UAGX_RigidBodyComponent* Moved = BatchedSyncBodies[Index].Get())
+		{
+			Moved->BatchedSyncIndex = Index;
+		}
+	}
+}
+
+void UAGX_Simulation::SynchronizeRigidBodies()
+{
+	if (BatchedSyncBodies.Num() == 0 || !HasNative())
+	{
+		return;
+	}
+
+	WaitForStepForward();
+
+	// Gather the Rigid Bodies that should be read this frame. A Rigid Body Component may be
+	// destroyed or lose its native without passing through EndPlay, e.g. during garbage
+	// collection at the end of a Play In Editor session, so those are skipped here.
+	FBatchedSyncBuffers& Buffers = BatchedSyncBuffers;
+	Buffers.Bodies.Reset();
+	Buffers.Barriers.Reset();
+	for (const TWeakObjectPtr<UAGX_RigidBodyComponent>& BodyPtr : BatchedSyncBodies)
+	{
+		UAGX_RigidBodyComponent* Body = BodyPtr.Get();
+		if (Body == nullptr || !Body->HasNative() || Body->MotionControl == MC_STATIC)
+		{
+			continue;
+		}
+
+		Buffers.Bodies.Add(Body);
+		Buffers.Barriers.Add(Body->GetNative());
+	}
+
+	NativeBarrier.GetRigidBodyStates(
+		Buffers.Barriers, Buffers.Positions, Buffers.Rotations, Buffers.Velocities,
+		Buffers.AngularVelocities);
+
+	// Moving Scene Components is not thread safe and may trigger user callbacks, e.g. On Begin
+	// Overlap, so the states are applied one by one on the game thread. A callback may remove or
+	// destroy any Rigid Body Component, so the list is not trusted beyond this point.
+	for (int32 I = 0; I < Buffers.Bodies.Num(); ++I)
+	{
+		UAGX_RigidBodyComponent* Body = Buffers.Bodies[I];
+		if (!IsValid(Body) || Body->BatchedSyncIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		Body->SynchronizeFromNative(
+			Buffers.Positions[I], Buffers.Rotations[I], Buffers.Velocities[I],
+			Buffers.AngularVelocities[I]);
+	}
+}
+
 void UAGX_Simulation::StepOnce()
 {
 	using namespace AGX_Simulation_helpers;
@@ -1358,6 +1733,8 @@ void UAGX_Simulation::StepOnce()
 	}
 #endif
 
+	FinishAsyncStep();
+
 	const uint64 StartCycle = FPlatformTime::Cycles64();
 	PreStep();
 	{
@@ -1370,11 +1747,11 @@ void UAGX_Simulation::StepOnce()
 	INC_FLOAT_STAT_BY(STAT_AGXU_StepTime, StepTime);
 	if (bEnableStatistics)
 	{
-		FAGX_Statistics Statistics = GetStatistics();
-		AccumulateFrameStatistics(Statistics);
+		RecordStepStatistics();
 		// We don't know if there are going to be more steps taken this frame or not, so we report
 		// step statistics every time just in case.
-		ReportStepStatistics(Statistics);
+		if (IsCollectingStats())
+			ReportStepStatistics(LastStepStatistics);
 	}
 
 	const auto SimTime = NativeBarrier.GetTimeStamp();
@@ -1601,7 +1978,22 @@ void UAGX_Simulation::SetGlobalNativeMergeSplitThresholds()
 
 void UAGX_Simulation::ReleaseNative()
 {
+	FinishAsyncStep();
+	NumContactEventListeners = 0;
+
+	for (const TWeakObjectPtr<UAGX_RigidBodyComponent>& Body : BatchedSyncBodies)
+	{
+		if (Body.IsValid())
+		{
+			Body->BatchedSyncIndex = INDEX_NONE;
+		}
+	}
+	BatchedSyncBodies.Empty();
+	ShapesByGuid.Empty();
+	RigidBodiesByGuid.Empty();
+
 	NativeBarrier.SetStatisticsEnabled(false);
+	GlobalContactEventListener.ReleaseNative();
 	NativeBarrier.ReleaseNative();
 
 	PreStepForward.Clear();
@@ -1669,7 +2061,7 @@ void UAGX_Simulation::PostStep()
 {
 	if (bEnableStatistics)
 	{
-		AGX_Simulation_helpers::AccumulateFrameStatistics(GetStatistics());
+		RecordStepStatistics();
 	}
 
 	if (!PostStepForwardInternal.IsBound() && !PostStepForward.IsBound())
@@ -1680,10 +2072,46 @@ void UAGX_Simulation::PostStep()
 	PostStepForward.Broadcast(SimTime);
 }
 
+void UAGX_Simulation::RecordStepStatistics()
+{
+	using namespace AGX_Simulation_helpers;
+
+	bool bSample = false;
+	if (bEnableStatisticsHistory)
+	{
+		++StepsSinceStatisticsSample;
+		bSample = StepsSinceStatisticsSample >= StatisticsSamplingPeriod;
+	}
+
+	// Reading the statistics from AGX Dynamics is a large number of string lookups, so only do it
+	// when someone is going to look at the result.
+	const bool bCollectingStats = IsCollectingStats();
+	if (!bSample && !bCollectingStats)
+		return;
+
+	LastStepStatistics = NativeBarrier.GetStatistics();
+
+	if (bCollectingStats)
+	{
+		AccumulateFrameStatistics(LastStepStatistics);
+	}
+
+	if (bSample)
+	{
+		StepsSinceStatisticsSample = 0;
+		if (StatisticsHistory.GetCapacity() != StatisticsHistorySize)
+			StatisticsHistory.SetCapacity(StatisticsHistorySize);
+		StatisticsHistory.Add(NativeBarrier.GetTimeStamp(), LastStepStatistics);
+	}
+}
+
 EAGX_KeepContactPolicy UAGX_Simulation::ImpactCallback(
 	double TimeStamp, FShapeContactBarrier& Contact)
 {
 	EAGX_KeepContactPolicy Policy {EAGX_KeepContactPolicy::KeepContact};
+	if (!OnImpact.IsBound())
+		return Policy;
+
 	FAGX_KeepContactPolicyHandle PolicyHandle {&Policy};
 	OnImpact.Broadcast(TimeStamp, FAGX_ShapeContact(Contact), PolicyHandle);
 	return Policy;
@@ -1693,45 +2121,23 @@ EAGX_KeepContactPolicy UAGX_Simulation::ContactCallback(
 	double TimeStamp, FShapeContactBarrier& Contact)
 {
 	EAGX_KeepContactPolicy Policy {EAGX_KeepContactPolicy::KeepContact};
+	if (!OnContact.IsBound())
+		return Policy;
+
 	FAGX_KeepContactPolicyHandle PolicyHandle {&Policy};
 	OnContact.Broadcast(TimeStamp, FAGX_ShapeContact(Contact), PolicyHandle);
 	return Policy;
 }
 
-namespace AGX_Simulation_helpers
-{
-	bool IsMatch(UAGX_ShapeComponent* Shape, const FGuid& Guid)
-	{
-		return Shape != nullptr && Shape->HasNative() &&
-			   Shape->GetNative()->GetGeometryGuid() == Guid;
-	}
-
-	template <typename UComponent>
-	UComponent* FindComponentByGuid(const FGuid& Guid, UWorld& World)
-	{
-		return FAGX_ObjectUtilities::FindComponentByPredicate<UComponent>(
-			World, [&Guid](UComponent* Component) { return IsMatch(Component, Guid); });
-	}
-}
-
 void UAGX_Simulation::SeparationCallback(
 	double TimeStamp, FAnyShapeBarrier& FirstShapeBarrier, FAnyShapeBarrier& SecondShapeBarrier)
 {
-	using namespace AGX_Simulation_helpers;
-	UWorld* World = GetWorld();
-	if (World == nullptr)
-	{
-		UE_LOG(
-			LogAGX, Warning,
-			TEXT("Contact Event Listener AGX Simulation cannot find Shape Components because it "
-				 "does "
-				 "not have a world."));
+	if (!OnSeparation.IsBound())
 		return;
-	}
-	UAGX_ShapeComponent* FirstShape =
-		FindComponentByGuid<UAGX_ShapeComponent>(FirstShapeBarrier.GetGeometryGuid(), *World);
+
+	UAGX_ShapeComponent* FirstShape = GetShapeComponentByGuid(FirstShapeBarrier.GetGeometryGuid());
 	UAGX_ShapeComponent* SecondShape =
-		FindComponentByGuid<UAGX_ShapeComponent>(SecondShapeBarrier.GetGeometryGuid(), *World);
+		GetShapeComponentByGuid(SecondShapeBarrier.GetGeometryGuid());
 
 	// Nullptr First Shape or Second Shape means that AGX Dynamics reported a separation for a
 	// Geometry that exists in the simulation but doesn't have an AGX Dynamics for Unreal
@@ -19,6 +19,18 @@ AAGX_Stepper::AAGX_Stepper()
 	// Only tick if the AGX Dynamics license is valid.
 	PrimaryActorTick.bCanEverTick = FAGX_Environment::GetInstance().EnsureAGXDynamicsLicenseValid();
 	PrimaryActorTick.TickGroup = TG_PrePhysics;
+
+	// The join Tick Function is a no-op unless the Simulation uses asynchronous stepping. The
+	// actual Tick Group is read from the Simulation when the Tick Function is registered.
+	JoinTickFunction.bCanEverTick = PrimaryActorTick.bCanEverTick;
+	JoinTickFunction.bStartWithTickEnabled = true;
+	JoinTickFunction.TickGroup = TG_DuringPhysics;
+
+	// Same Tick Group as the Rigid Body Components' own Tick Component, which the sync Tick
+	// Function replaces when batched Rigid Body synchronization is enabled.
+	SyncTickFunction.bCanEverTick = PrimaryActorTick.bCanEverTick;
+	SyncTickFunction.bStartWithTickEnabled = true;
+	SyncTickFunction.TickGroup = TG_PostPhysics;
 }
 
 AAGX_Stepper::~AAGX_Stepper()
@@ -58,7 +70,106 @@ void AAGX_Stepper::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	UGameInstance* Game = GetGameInstance();
 	UAGX_Simulation* Simulation = Game->GetSubsystem<UAGX_Simulation>();
+	Simulation->WaitForStepForward();
 
 	if (EndPlayReason == EEndPlayReason::LevelTransition)
 		Simulation->OnLevelTransition();
 }
+
+void AAGX_Stepper::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
+
+	if (bRegister)
+	{
+		if (!JoinTickFunction.bCanEverTick)
+			return;
+
+		UGameInstance* Game = GetGameInstance();
+		UAGX_Simulation* Simulation =
+			Game != nullptr ? Game->GetSubsystem<UAGX_Simulation>() : nullptr;
+		if (Simulation != nullptr)
+		{
+			JoinTickFunction.TickGroup = Simulation->GetAsyncStepJoinTickGroup();
+			JoinTickFunction.EndTickGroup = JoinTickFunction.TickGroup;
+		}
+
+		JoinTickFunction.Target = this;
+		JoinTickFunction.SetTickFunctionEnable(true);
+		JoinTickFunction.RegisterTickFunction(GetLevel());
+
+		// The join must never run before the step has been started, which could otherwise happen
+		// when both Tick Functions are in the Pre Physics Tick Group.
+		JoinTickFunction.AddPrerequisite(this, PrimaryActorTick);
+
+		// The sync Tick Function is cheap when no Rigid Body uses batched synchronization, so it
+		// is always registered. Rigid Bodies read Enable Batched Rigid Body Sync on Begin Play.
+		SyncTickFunction.Target = this;
+		SyncTickFunction.SetTickFunctionEnable(true);
+		SyncTickFunction.RegisterTickFunction(GetLevel());
+		SyncTickFunction.AddPrerequisite(this, JoinTickFunction);
+	}
+	else
+	{
+		if (SyncTickFunction.IsTickFunctionRegistered())
+		{
+			SyncTickFunction.RemovePrerequisite(this, JoinTickFunction);
+			SyncTickFunction.UnRegisterTickFunction();
+		}
+		if (JoinTickFunction.IsTickFunctionRegistered())
+		{
+			JoinTickFunction.RemovePrerequisite(this, PrimaryActorTick);
+			JoinTickFunction.UnRegisterTickFunction();
+		}
+	}
+}
+
+void AAGX_Stepper::JoinStep()
+{
+	UGameInstance* Game = GetGameInstance();
+	UAGX_Simulation* Simulation = Game != nullptr ? Game->GetSubsystem<UAGX_Simulation>() : nullptr;
+	if (Simulation == nullptr)
+		return;
+
+	Simulation->WaitForStepForward();
+}
+
+void AAGX_Stepper::SynchronizeRigidBodies()
+{
+	UGameInstance* Game = GetGameInstance();
+	UAGX_Simulation* Simulation = Game != nullptr ? Game->GetSubsystem<UAGX_Simulation>() : nullptr;
+	if (Simulation == nullptr)
+		return;
+
+	Simulation->SynchronizeRigidBodies();
+}
+
+void FAGX_StepperJoinTickFunction::ExecuteTick(
+	float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target == nullptr || !IsValid(Target))
+		return;
+
+	Target->JoinStep();
+}
+
+FString FAGX_StepperJoinTickFunction::DiagnosticMessage()
+{
+	return TEXT("FAGX_StepperJoinTickFunction");
+}
+
+void FAGX_StepperSyncTickFunction::ExecuteTick(
+	float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target == nullptr || !IsValid(Target))
+		return;
+
+	Target->SynchronizeRigidBodies();
+}
+
+FString FAGX_StepperSyncTickFunction::DiagnosticMessage()
+{
+	return TEXT("FAGX_StepperSyncTickFunction");
+}
@@ -584,6 +584,9 @@ void UAGX_CableComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	// Update Visuals reads the segment transforms of the native Cable.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
 	UpdateVisuals();
 }
 
@@ -4,6 +4,7 @@
 
 // AGX Dynamics for Unreal includes.
 #include "AGX_LogCategory.h"
+#include "AGX_Simulation.h"
 #include "Constraints/AGX_Constraint1DofComponent.h"
 #include "Constraints/AGX_Constraint2DofComponent.h"
 #include "Constraints/AGX_Constraint2DOFFreeDOF.h"
@@ -117,6 +118,10 @@ void UAGX_InputTargetSpeed::TickComponent(
 		return;
 	}
 
+	// The speed controller must not be written while a step is using it.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
+
 	const bool bForward = PlayerController->IsInputKeyDown(ForwardKey);
 	const bool bBackward = PlayerController->IsInputKeyDown(BackwardKey);
 	if (bForward && bBackward)
@@ -8,7 +8,6 @@
 #include "Contacts/ContactListenerBarrier.h"
 #include "Shapes/AGX_ShapeComponent.h"
 #include "Shapes/AnyShapeBarrier.h"
-#include "Utilities/AGX_ObjectUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
 
 // Unreal Engine includes.
@@ -20,9 +19,15 @@ void UAGX_ContactEventListenerComponent::BeginPlay()
 
 	// Create an AGX Dynamics Contact Event Listener that calls our ImpactCallback, ContactCallback,
 	// and SeparationCallback member functions via lambda functions.
-	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
-	FSimulationBarrier* SimulationBarrier = Simulation->GetNative();
-	CreateContactEventListener(
+	UAGX_Simulation* Sim = UAGX_Simulation::GetFrom(this);
+	FSimulationBarrier* SimulationBarrier = Sim->GetNative();
+	Sim->NotifyContactEventListenerCreated();
+	Simulation = Sim;
+
+	// A step that is in flight must not see the listener being added, and must not call its
+	// callbacks on the worker thread.
+	Sim->WaitForStepForward();
+	NativeBarrier.AllocateNative(
 		*SimulationBarrier,
 		[this](double TimeStamp, FShapeContactBarrier& ShapeContact)
 		{ return ImpactCallback(TimeStamp, ShapeContact); },
@@ -32,6 +37,21 @@ void UAGX_ContactEventListenerComponent::BeginPlay()
 		{ SeparationCallback(TimeStamp, FirstShape, SecondShape); });
 }
 
+void UAGX_ContactEventListenerComponent::EndPlay(const EEndPlayReason::Type Reason)
+{
+	Super::EndPlay(Reason);
+
+	if (!NativeBarrier.HasNative())
+		return;
+
+	// Remove the listener so that the callbacks, which capture this, are no longer called and so
+	// that the Simulation may step asynchronously again once no listeners remain.
+	NativeBarrier.ReleaseNative();
+	if (UAGX_Simulation* Sim = Simulation.Get())
+		Sim->NotifyContactEventListenerDestroyed();
+	Simulation = nullptr;
+}
+
 EAGX_KeepContactPolicy UAGX_ContactEventListenerComponent::ImpactCallback(
 	double TimeStamp, FShapeContactBarrier& ContactBarrier)
 {
@@ -62,33 +82,16 @@ EAGX_KeepContactPolicy UAGX_ContactEventListenerComponent::ContactCallback(
 	return Policy;
 }
 
-namespace AGX_ContactEventListenerComponent_helpers
-{
-	bool IsMatch(UAGX_ShapeComponent* Shape, const FGuid& Guid)
-	{
-		return Shape->GetNative()->GetGeometryGuid() == Guid;
-	}
-
-	template <typename UComponent>
-	UComponent* FindComponentByGuid(const FGuid& Guid, UWorld& World)
-	{
-		return FAGX_ObjectUtilities::FindComponentByPredicate<UComponent>(
-			World, [&Guid](UComponent* Component) { return IsMatch(Component, Guid); });
-	}
-}
-
 void UAGX_ContactEventListenerComponent::SeparationCallback(
 	double TimeStamp, FAnyShapeBarrier& FirstShapeBarrier, FAnyShapeBarrier& SecondShapeBarrier)
 {
-	using namespace AGX_ContactEventListenerComponent_helpers;
-
-	UWorld* World = GetWorld();
-	if (World == nullptr)
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
+	if (Simulation == nullptr)
 	{
 		UE_LOG(
 			LogAGX, Warning,
 			TEXT("Contact Event Listener '%s' in '%s' cannot find Shape Components because it does "
-				 "not have a world."),
+				 "not have a Simulation."),
 			*GetName(), *GetLabelSafe(GetOwner()));
 		return;
 	}
@@ -96,9 +99,9 @@ void UAGX_ContactEventListenerComponent::SeparationCallback(
 	OnSeparationBarrier.Broadcast(TimeStamp, FirstShapeBarrier, SecondShapeBarrier);
 
 	UAGX_ShapeComponent* FirstShape =
-		FindComponentByGuid<UAGX_ShapeComponent>(FirstShapeBarrier.GetGeometryGuid(), *World);
+		Simulation->GetShapeComponentByGuid(FirstShapeBarrier.GetGeometryGuid());
 	UAGX_ShapeComponent* SecondShape =
-		FindComponentByGuid<UAGX_ShapeComponent>(SecondShapeBarrier.GetGeometryGuid(), *World);
+		Simulation->GetShapeComponentByGuid(SecondShapeBarrier.GetGeometryGuid());
 
 	Separation(TimeStamp, FirstShape, SecondShape);
 	OnSeparation.Broadcast(TimeStamp, FirstShape, SecondShape);
@@ -5,11 +5,9 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_LogCategory.h"
 #include "AGX_RigidBodyComponent.h"
+#include "AGX_Simulation.h"
 #include "Shapes/AGX_ShapeComponent.h"
 
-// Unreal Engine includes.
-#include "UObject/UObjectIterator.h"
-
 FAGX_ShapeContact::FAGX_ShapeContact(const FShapeContactBarrier& InBarrier)
 	: Barrier(InBarrier)
 {
@@ -231,48 +229,6 @@ namespace AGX_ShapeContact_helpers
 		return TestHasNative(ShapeContact, AttributeName) &&
 			   IsValidPointIndex(ShapeContact, PointIndex, AttributeName);
 	}
-
-	bool IsMatch(UAGX_ShapeComponent* Shape, const FGuid& Guid)
-	{
-		if (!Shape || !Shape->HasNative() || !Guid.IsValid())
-		{
-			return false;
-		}
-
-		return Shape->GetNative()->GetGeometryGuid() == Guid;
-	}
-
-	bool IsMatch(UAGX_RigidBodyComponent* Body, const FGuid& Guid)
-	{
-		if (!Body || !Body->HasNative() || !Guid.IsValid())
-		{
-			return false;
-		}
-
-		return Body->GetNative()->GetGuid() == Guid;
-	}
-
-	template <typename T>
-	T* GetFromGuid(const FGuid& Guid)
-	{
-		/// @todo Are we sure this will work? That is, are we guaranteed that it will find a T
-		/// within the same World as we got the GUID from? I don't think so. And it seems really
-		/// expensive to iterate all objects in the entire universe.
-		///
-		/// We should consider keeping a table of (GUID -> Unreal Engine class instances) instead,
-		/// alternatively store a pointer to the Unreal Engine class instance somewhere in the
-		/// AGX Dynamics object. For some things there is setCustomData, but not all things.
-		for (TObjectIterator<T> ObjectIt; ObjectIt; ++ObjectIt)
-		{
-			T* Obj = *ObjectIt;
-			if (IsMatch(Obj, Guid))
-			{
-				return Obj;
-			}
-		}
-
-		return nullptr;
-	}
 }
 
 bool UAGX_ShapeContact_FL::HasNative(FAGX_ShapeContact& ShapeContact)
@@ -301,7 +257,7 @@ UAGX_ShapeComponent* UAGX_ShapeContact_FL::GetFirstShape(FAGX_ShapeContact& Shap
 	{
 		return nullptr;
 	}
-	return GetFromGuid<UAGX_ShapeComponent>(ShapeContact.GetShape1().GetGeometryGuid());
+	return UAGX_Simulation::FindShapeComponentByGuid(ShapeContact.GetShape1().GetGeometryGuid());
 }
 
 FShapeBarrier UAGX_ShapeContact_FL::GetFirstShapeBarrier(const FAGX_ShapeContact& ShapeContact)
@@ -325,7 +281,7 @@ UAGX_ShapeComponent* UAGX_ShapeContact_FL::GetSecondShape(FAGX_ShapeContact& Sha
 	{
 		return nullptr;
 	}
-	return GetFromGuid<UAGX_ShapeComponent>(ShapeContact.GetShape2().GetGeometryGuid());
+	return UAGX_Simulation::FindShapeComponentByGuid(ShapeContact.GetShape2().GetGeometryGuid());
 }
 
 FShapeBarrier UAGX_ShapeContact_FL::GetSecondShapeBarrier(const FAGX_ShapeContact& ShapeContact)
@@ -349,7 +305,7 @@ UAGX_RigidBodyComponent* UAGX_ShapeContact_FL::GetFirstBody(FAGX_ShapeContact& S
 	{
 		return nullptr;
 	}
-	return GetFromGuid<UAGX_RigidBodyComponent>(ShapeContact.GetBody1().GetGuid());
+	return UAGX_Simulation::FindRigidBodyComponentByGuid(ShapeContact.GetBody1().GetGuid());
 }
 
 FRigidBodyBarrier UAGX_ShapeContact_FL::GetFirstBodyBarrier(const FAGX_ShapeContact& ShapeContact)
@@ -373,7 +329,7 @@ UAGX_RigidBodyComponent* UAGX_ShapeContact_FL::GetSecondBody(FAGX_ShapeContact&
 	{
 		return nullptr;
 	}
-	return GetFromGuid<UAGX_RigidBodyComponent>(ShapeContact.GetBody2().GetGuid());
+	return UAGX_Simulation::FindRigidBodyComponentByGuid(ShapeContact.GetBody2().GetGuid());
 }
 
 FRigidBodyBarrier UAGX_ShapeContact_FL::GetSecondBodyBarrier(const FAGX_ShapeContact& ShapeContact)
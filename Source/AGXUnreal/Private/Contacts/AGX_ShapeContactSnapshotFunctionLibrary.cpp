@@ -0,0 +1,153 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Contacts/AGX_ShapeContactSnapshotFunctionLibrary.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+
+namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers
+{
+	// FVector is not zero initialized by its default constructor.
+	template <typename T>
+	T Zero()
+	{
+		return T();
+	}
+
+	template <>
+	FVector Zero<FVector>()
+	{
+		return FVector::ZeroVector;
+	}
+
+	/**
+	 * Read one element of a snapshot array, or log an error and return a zero value if the index is
+	 * out of range.
+	 */
+	template <typename T>
+	T GetElement(
+		const TArray<T>& Array, int32 Index, const TCHAR* AttributeName, const TCHAR* IndexName)
+	{
+		if (Array.IsValidIndex(Index))
+		{
+			return Array[Index];
+		}
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Trying to access %s at %s index %d in a Shape Contact Snapshot that only has "
+				 "%d."),
+			AttributeName, IndexName, Index, Array.Num());
+		return Zero<T>();
+	}
+
+	template <typename T>
+	T GetShapeContactElement(const TArray<T>& Array, int32 Index, const TCHAR* AttributeName)
+	{
+		return GetElement(Array, Index, AttributeName, TEXT("Shape Contact"));
+	}
+
+	template <typename T>
+	T GetPointElement(const TArray<T>& Array, int32 Index, const TCHAR* AttributeName)
+	{
+		return GetElement(Array, Index, AttributeName, TEXT("Contact Point"));
+	}
+}
+
+int32 UAGX_ShapeContactSnapshot_FL::GetNumShapeContacts(FAGX_ShapeContactSnapshot& Snapshot)
+{
+	return Snapshot.GetNumShapeContacts();
+}
+
+int32 UAGX_ShapeContactSnapshot_FL::GetNumContactPoints(FAGX_ShapeContactSnapshot& Snapshot)
+{
+	return Snapshot.GetNumContactPoints();
+}
+
+FGuid UAGX_ShapeContactSnapshot_FL::GetFirstShapeGuid(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetShapeContactElement(
+		Snapshot.FirstShapeGuids, ShapeContactIndex, TEXT("First Shape Guid"));
+}
+
+FGuid UAGX_ShapeContactSnapshot_FL::GetSecondShapeGuid(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetShapeContactElement(
+		Snapshot.SecondShapeGuids, ShapeContactIndex, TEXT("Second Shape Guid"));
+}
+
+FGuid UAGX_ShapeContactSnapshot_FL::GetFirstBodyGuid(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetShapeContactElement(
+		Snapshot.FirstBodyGuids, ShapeContactIndex, TEXT("First Body Guid"));
+}
+
+FGuid UAGX_ShapeContactSnapshot_FL::GetSecondBodyGuid(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetShapeContactElement(
+		Snapshot.SecondBodyGuids, ShapeContactIndex, TEXT("Second Body Guid"));
+}
+
+int32 UAGX_ShapeContactSnapshot_FL::GetFirstPointIndex(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetShapeContactElement(
+		Snapshot.FirstPoints, ShapeContactIndex, TEXT("First Point Index"));
+}
+
+int32 UAGX_ShapeContactSnapshot_FL::GetNumPoints(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	if (!Snapshot.FirstPoints.IsValidIndex(ShapeContactIndex))
+	{
+		// Logs the error and returns zero.
+		return GetShapeContactElement(
+			Snapshot.FirstPoints, ShapeContactIndex, TEXT("Num Points"));
+	}
+	return Snapshot.GetNumContactPoints(ShapeContactIndex);
+}
+
+FVector UAGX_ShapeContactSnapshot_FL::GetLocation(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetPointElement(Snapshot.Locations, PointIndex, TEXT("Location"));
+}
+
+FVector UAGX_ShapeContactSnapshot_FL::GetNormal(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetPointElement(Snapshot.Normals, PointIndex, TEXT("Normal"));
+}
+
+double UAGX_ShapeContactSnapshot_FL::GetDepth(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetPointElement(Snapshot.Depths, PointIndex, TEXT("Depth"));
+}
+
+FVector UAGX_ShapeContactSnapshot_FL::GetForce(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetPointElement(Snapshot.Forces, PointIndex, TEXT("Force"));
+}
+
+int32 UAGX_ShapeContactSnapshot_FL::GetShapeContactIndex(
+	FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex)
+{
+	using namespace AGX_ShapeContactSnapshotFunctionLibrary_helpers;
+	return GetPointElement(
+		Snapshot.ShapeContactIndices, PointIndex, TEXT("Shape Contact Index"));
+}
@@ -368,6 +368,10 @@ FAGX_Importer::FAGX_Importer()
 	Context.PLXMaterialOverrides = MakeUnique<TMap<FGuid, FOpenPLXMaterialBarrier>>();
 	Context.RenderStaticMeshes = MakeUnique<TMap<FGuid, UStaticMesh*>>();
 	Context.CollisionStaticMeshes = MakeUnique<TMap<FGuid, UStaticMesh*>>();
+	Context.RenderStaticMeshesByContent =
+		MakeUnique<TMap<FAGX_ImportContext::FMeshContentKey, UStaticMesh*>>();
+	Context.CollisionStaticMeshesByContent =
+		MakeUnique<TMap<FAGX_ImportContext::FMeshContentKey, UStaticMesh*>>();
 	Context.MSThresholds = MakeUnique<TMap<FGuid, UAGX_MergeSplitThresholdsBase*>>();
 	Context.ShapeMaterials = MakeUnique<TMap<FGuid, UAGX_ShapeMaterial*>>();
 	Context.ContactMaterials = MakeUnique<TMap<FGuid, UAGX_ContactMaterial*>>();
@@ -0,0 +1,205 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "ROS2/AGX_ROS2AsyncPublisher.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+
+// Unreal Engine includes.
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+FAGX_ROS2AsyncPublisher::FAGX_ROS2AsyncPublisher(
+	int32 InQueueCapacity, EAGX_ROS2QueueFullPolicy InQueueFullPolicy)
+	: QueueCapacity(FMath::Max(InQueueCapacity, 1))
+	, QueueFullPolicy(InQueueFullPolicy)
+{
+	WorkAvailable = FPlatformProcess::GetSynchEventFromPool(false);
+	MessagePublished = FPlatformProcess::GetSynchEventFromPool(false);
+	if (FPlatformProcess::SupportsMultithreading())
+		Thread = FRunnableThread::Create(this, TEXT("AGX ROS2 Publisher"));
+	if (Thread == nullptr)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Could not create the ROS2 asynchronous publishing thread. Messages will be "
+				 "published when queued instead."));
+	}
+}
+
+FAGX_ROS2AsyncPublisher::~FAGX_ROS2AsyncPublisher()
+{
+	if (Thread != nullptr)
+	{
+		// Kill calls Stop and waits for Run to return.
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkAvailable);
+	FPlatformProcess::ReturnSynchEventToPool(MessagePublished);
+}
+
+bool FAGX_ROS2AsyncPublisher::Enqueue(
+	int32 TopicIndex, const FString& Topic, FPublishFunction Publish)
+{
+	check(TopicIndex >= 0);
+	if (bStopping)
+		return false;
+
+	if (Thread == nullptr)
+		return Publish();
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (TopicIndex >= Topics.Num())
+			Topics.SetNum(TopicIndex + 1);
+		if (Topics[TopicIndex].Topic.IsEmpty())
+			Topics[TopicIndex].Topic = Topic;
+
+		while (Topics[TopicIndex].Messages.Num() >= QueueCapacity)
+		{
+			if (QueueFullPolicy == EAGX_ROS2QueueFullPolicy::DropOldest)
+			{
+				Topics[TopicIndex].Messages.RemoveAt(0);
+				++Topics[TopicIndex].NumDropped;
+				continue;
+			}
+
+			// Block until the thread has published something. The lock must not be held while
+			// waiting since the thread needs it to take the next message.
+			{
+				FScopeUnlock ScopeUnlock(&Lock);
+				MessagePublished->Wait(10);
+			}
+			if (bStopping)
+				return false;
+		}
+
+		Topics[TopicIndex].Messages.Add({MoveTemp(Publish), FPlatformTime::Seconds()});
+	}
+
+	WorkAvailable->Trigger();
+	return true;
+}
+
+void FAGX_ROS2AsyncPublisher::Flush()
+{
+	if (Thread == nullptr)
+		return;
+
+	while (!bStopping)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (IsIdle())
+				return;
+		}
+		MessagePublished->Wait(10);
+	}
+}
+
+FAGX_ROS2PublisherStatistics FAGX_ROS2AsyncPublisher::GetStatistics(const FString& Topic) const
+{
+	FAGX_ROS2PublisherStatistics Statistics;
+	FScopeLock ScopeLock(&Lock);
+	const FTopicQueue* Found =
+		Topics.FindByPredicate([&Topic](const FTopicQueue& Queue) { return Queue.Topic == Topic; });
+	if (Found == nullptr)
+		return Statistics;
+
+	const FTopicQueue& Queue = *Found;
+	Statistics.NumPublished = Queue.NumPublished;
+	Statistics.NumDropped = Queue.NumDropped;
+	Statistics.NumQueued = Queue.Messages.Num();
+	Statistics.MaxLatency = Queue.MaxLatency;
+	if (Queue.NumPublished > 0)
+		Statistics.AverageLatency = Queue.TotalLatency / static_cast<double>(Queue.NumPublished);
+
+	const double Duration = Queue.LastPublishTime - Queue.FirstPublishTime;
+	if (Queue.NumPublished > 1 && Duration > 0.0)
+		Statistics.Throughput = static_cast<double>(Queue.NumPublished - 1) / Duration;
+
+	return Statistics;
+}
+
+uint32 FAGX_ROS2AsyncPublisher::Run()
+{
+	while (!bStopping)
+	{
+		FQueuedMessage Message;
+		int32 TopicIndex = INDEX_NONE;
+		{
+			FScopeLock ScopeLock(&Lock);
+			for (int32 I = 0; I < Topics.Num(); ++I)
+			{
+				const int32 Candidate = (NextTopic + I) % Topics.Num();
+				if (Topics[Candidate].Messages.Num() > 0)
+				{
+					TopicIndex = Candidate;
+					break;
+				}
+			}
+
+			if (TopicIndex != INDEX_NONE)
+			{
+				FTopicQueue& Queue = Topics[TopicIndex];
+				Message = MoveTemp(Queue.Messages[0]);
+				Queue.Messages.RemoveAt(0);
+				Queue.bPublishing = true;
+				NextTopic = (TopicIndex + 1) % Topics.Num();
+			}
+		}
+
+		if (TopicIndex == INDEX_NONE)
+		{
+			WorkAvailable->Wait();
+			continue;
+		}
+
+		// Conversion to the native message and publishing happen here, without the lock.
+		const bool bPublished = Message.Publish();
+		const double Now = FPlatformTime::Seconds();
+		{
+			FScopeLock ScopeLock(&Lock);
+			FTopicQueue& Queue = Topics[TopicIndex];
+			Queue.bPublishing = false;
+			if (bPublished)
+			{
+				const double Latency = Now - Message.EnqueueTime;
+				if (Queue.NumPublished == 0)
+					Queue.FirstPublishTime = Now;
+				Queue.LastPublishTime = Now;
+				++Queue.NumPublished;
+				Queue.TotalLatency += Latency;
+				Queue.MaxLatency = FMath::Max(Queue.MaxLatency, Latency);
+			}
+		}
+
+		MessagePublished->Trigger();
+	}
+
+	return 0;
+}
+
+void FAGX_ROS2AsyncPublisher::Stop()
+{
+	bStopping = true;
+	WorkAvailable->Trigger();
+	MessagePublished->Trigger();
+}
+
+bool FAGX_ROS2AsyncPublisher::IsIdle() const
+{
+	for (const FTopicQueue& Queue : Topics)
+	{
+		if (Queue.bPublishing || Queue.Messages.Num() > 0)
+			return false;
+	}
+
+	return true;
+}
@@ -15,23 +15,87 @@ UAGX_ROS2PublisherComponent::UAGX_ROS2PublisherComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+FAGX_ROS2PublisherStatistics UAGX_ROS2PublisherComponent::GetTopicStatistics(
+	const FString& Topic) const
+{
+	if (AsyncPublisher == nullptr)
+		return FAGX_ROS2PublisherStatistics();
+
+	return AsyncPublisher->GetStatistics(Topic);
+}
+
+void UAGX_ROS2PublisherComponent::FlushAsyncQueue()
+{
+	if (AsyncPublisher != nullptr)
+		AsyncPublisher->Flush();
+}
+
+void UAGX_ROS2PublisherComponent::EndPlay(const EEndPlayReason::Type Reason)
+{
+	Super::EndPlay(Reason);
+
+	// Stops the background thread. Messages not yet published are discarded. Must be done before
+	// the Barriers it publishes through are released.
+	AsyncPublisher.Reset();
+
+	NativeBarriers.Empty();
+	BarrierIndices.Empty();
+	++TopicHandleGeneration;
+}
+
+template <typename MessageType>
+bool UAGX_ROS2PublisherComponent::Send(
+	EAGX_ROS2MessageType Type, MessageType&& Msg, const FString& Topic)
+{
+	const int32 Index = GetOrCreateBarrierIndex(Type, Topic);
+	if (Index == INDEX_NONE)
+		return false;
+
+	return Publish(Index, Forward<MessageType>(Msg), Topic);
+}
+
+template <typename MessageType>
+bool UAGX_ROS2PublisherComponent::Send(
+	EAGX_ROS2MessageType Type, MessageType&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	if (GetOrCreateBarrier(Type, Handle) == nullptr)
+		return false;
+
+	return Publish(Handle.Index, Forward<MessageType>(Msg), Handle.GetTopic());
+}
+
+template <typename MessageType>
+bool UAGX_ROS2PublisherComponent::Publish(
+	int32 BarrierIndex, MessageType&& Msg, const FString& Topic)
+{
+	FROS2PublisherBarrier* Barrier = NativeBarriers[BarrierIndex].Get();
+	if (!bPublishAsync)
+		return Barrier->SendMsg(Msg);
+
+	if (AsyncPublisher == nullptr)
+		AsyncPublisher = MakeUnique<FAGX_ROS2AsyncPublisher>(AsyncQueueCapacity, QueueFullPolicy);
+
+	// The queue takes its own message, copied if the caller still owns it and moved if not. The
+	// conversion to the native message type happens on the background thread, in SendMsg. The
+	// queue of the topic is the one with the same index as the Barrier.
+	return AsyncPublisher->Enqueue(
+		BarrierIndex, Topic, [Barrier, QueuedMsg = Forward<MessageType>(Msg)]()
+		{ return Barrier->SendMsg(QueuedMsg); });
+}
+
 //
 // AgxMsgs
 //
 
 bool UAGX_ROS2PublisherComponent::SendAgxMsgsAny(const FAGX_AgxMsgsAny& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAny, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::AgxMsgsAny, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequence(
 	const FAGX_AgxMsgsAnySequence& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAnySequence, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::AgxMsgsAnySequence, Msg, Topic);
 }
 
 //
@@ -41,17 +105,13 @@ bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequence(
 bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesTime(
 	const FAGX_BuiltinInterfacesTime& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesTime, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesTime, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDuration(
 	const FAGX_BuiltinInterfacesDuration& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Msg, Topic);
 }
 
 //
@@ -61,9 +121,7 @@ bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDuration(
 bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClock(
 	const FAGX_RosgraphMsgsClock& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::RosgraphMsgsClock, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::RosgraphMsgsClock, Msg, Topic);
 }
 
 //
@@ -72,222 +130,166 @@ bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClock(
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsBool(const FAGX_StdMsgsBool& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsBool, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsBool, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsByte(const FAGX_StdMsgsByte& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByte, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsByte, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsByteMultiArray(
 	const FAGX_StdMsgsByteMultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsChar(const FAGX_StdMsgsChar& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsChar, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsChar, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsColorRGBA(
 	const FAGX_StdMsgsColorRGBA& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsColorRGBA, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsColorRGBA, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsEmpty(
 	const FAGX_StdMsgsEmpty& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsEmpty, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsEmpty, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32(
 	const FAGX_StdMsgsFloat32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32MultiArray(
 	const FAGX_StdMsgsFloat32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64(
 	const FAGX_StdMsgsFloat64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64MultiArray(
 	const FAGX_StdMsgsFloat64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16(
 	const FAGX_StdMsgsInt16& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16MultiArray(
 	const FAGX_StdMsgsInt16MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32(
 	const FAGX_StdMsgsInt32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32MultiArray(
 	const FAGX_StdMsgsInt32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64(
 	const FAGX_StdMsgsInt64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64MultiArray(
 	const FAGX_StdMsgsInt64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8(const FAGX_StdMsgsInt8& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8MultiArray(
 	const FAGX_StdMsgsInt8MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsString(
 	const FAGX_StdMsgsString& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsString, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsString, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16(
 	const FAGX_StdMsgsUInt16& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16MultiArray(
 	const FAGX_StdMsgsUInt16MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32(
 	const FAGX_StdMsgsUInt32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32MultiArray(
 	const FAGX_StdMsgsUInt32MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64(
 	const FAGX_StdMsgsUInt64& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64MultiArray(
 	const FAGX_StdMsgsUInt64MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8(
 	const FAGX_StdMsgsUInt8& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8MultiArray(
 	const FAGX_StdMsgsUInt8MultiArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendStdMsgsHeader(
 	const FAGX_StdMsgsHeader& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsHeader, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::StdMsgsHeader, Msg, Topic);
 }
 
 //
@@ -297,241 +299,175 @@ bool UAGX_ROS2PublisherComponent::SendStdMsgsHeader(
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3(
 	const FAGX_GeometryMsgsVector3& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternion(
 	const FAGX_GeometryMsgsQuaternion& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccel(
 	const FAGX_GeometryMsgsAccel& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccel, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccel, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelStamped(
 	const FAGX_GeometryMsgsAccelStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovariance(
 	const FAGX_GeometryMsgsAccelWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceStamped(
 	const FAGX_GeometryMsgsAccelWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertia(
 	const FAGX_GeometryMsgsInertia& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertia, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertia, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaStamped(
 	const FAGX_GeometryMsgsInertiaStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint(
 	const FAGX_GeometryMsgsPoint& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint32(
 	const FAGX_GeometryMsgsPoint32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint32, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointStamped(
 	const FAGX_GeometryMsgsPointStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygon(
 	const FAGX_GeometryMsgsPolygon& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygon, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygon, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonStamped(
 	const FAGX_GeometryMsgsPolygonStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose(
 	const FAGX_GeometryMsgsPose& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose2D(
 	const FAGX_GeometryMsgsPose2D& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose2D, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose2D, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseArray(
 	const FAGX_GeometryMsgsPoseArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseStamped(
 	const FAGX_GeometryMsgsPoseStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovariance(
 	const FAGX_GeometryMsgsPoseWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceStamped(
 	const FAGX_GeometryMsgsPoseWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionStamped(
 	const FAGX_GeometryMsgsQuaternionStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransform(
 	const FAGX_GeometryMsgsTransform& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransform, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransform, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformStamped(
 	const FAGX_GeometryMsgsTransformStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwist(
 	const FAGX_GeometryMsgsTwist& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwist, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwist, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistStamped(
 	const FAGX_GeometryMsgsTwistStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovariance(
 	const FAGX_GeometryMsgsTwistWithCovariance& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceStamped(
 	const FAGX_GeometryMsgsTwistWithCovarianceStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3Stamped(
 	const FAGX_GeometryMsgsVector3Stamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrench(
 	const FAGX_GeometryMsgsWrench& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrench, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrench, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStamped(
 	const FAGX_GeometryMsgsWrenchStamped& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Msg, Topic);
 }
 
 //
@@ -541,276 +477,1854 @@ bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStamped(
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsBatteryState(
 	const FAGX_SensorMsgsBatteryState& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsBatteryState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsBatteryState, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsChannelFloat32(
 	const FAGX_SensorMsgsChannelFloat32& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsCompressedImage(
 	const FAGX_SensorMsgsCompressedImage& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsFluidPressure(
 	const FAGX_SensorMsgsFluidPressure& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsIlluminance(
 	const FAGX_SensorMsgsIlluminance& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsIlluminance, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsIlluminance, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsImage(
 	const FAGX_SensorMsgsImage& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImage, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsImage, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsImu(
 	const FAGX_SensorMsgsImu& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImu, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsImu, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJointState(
 	const FAGX_SensorMsgsJointState& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJointState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJointState, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoy(
 	const FAGX_SensorMsgsJoy& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoy, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoy, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedback(
 	const FAGX_SensorMsgsJoyFeedback& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackArray(
 	const FAGX_SensorMsgsJoyFeedbackArray& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserEcho(
 	const FAGX_SensorMsgsLaserEcho& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserScan(
 	const FAGX_SensorMsgsLaserScan& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserScan, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserScan, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMagneticField(
 	const FAGX_SensorMsgsMagneticField& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMagneticField, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMagneticField, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiDOFJointState(
 	const FAGX_SensorMsgsMultiDOFJointState& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiEchoLaserScan(
 	const FAGX_SensorMsgsMultiEchoLaserScan& Msg, const FString& Topic)
 {
-	if (auto Barrier =
-			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatStatus(
 	const FAGX_SensorMsgsNavSatStatus& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatFix(
 	const FAGX_SensorMsgsNavSatFix& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud(
 	const FAGX_SensorMsgsPointCloud& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointField(
 	const FAGX_SensorMsgsPointField& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointField, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointField, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2(
 	const FAGX_SensorMsgsPointCloud2& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRange(
 	const FAGX_SensorMsgsRange& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRange, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRange, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRegionOfInterest(
 	const FAGX_SensorMsgsRegionOfInterest& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsCameraInfo(
 	const FAGX_SensorMsgsCameraInfo& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsRelativeHumidity(
 	const FAGX_SensorMsgsRelativeHumidity& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsTemperature(
 	const FAGX_SensorMsgsTemperature& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTemperature, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsTemperature, Msg, Topic);
 }
 
 bool UAGX_ROS2PublisherComponent::SendSensorMsgsTimeReference(
 	const FAGX_SensorMsgsTimeReference& Msg, const FString& Topic)
 {
-	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTimeReference, Topic))
-		return Barrier->SendMsg(Msg);
-	return false;
+	return Send(EAGX_ROS2MessageType::SensorMsgsTimeReference, Msg, Topic);
 }
 
-FROS2PublisherBarrier* UAGX_ROS2PublisherComponent::GetOrCreateBarrier(
-	EAGX_ROS2MessageType Type, const FString& Topic)
+//
+// Topic Handle variants.
+//
+
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnyByHandle(
+	const FAGX_AgxMsgsAny& Msg, FAGX_ROS2TopicHandle& Handle)
 {
-	FROS2PublisherBarrier* Barrier = NativeBarriers.Find(Topic);
-	if (Barrier == nullptr)
-	{
-		if (Topic.IsEmpty())
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
-					 "whith an empty Topic String. Ensure a Topic has been set."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
-		}
+	return Send(EAGX_ROS2MessageType::AgxMsgsAny, Msg, Handle);
+}
 
-		bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
-		if (!bIsPlaying)
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
-					 "when not inPlay. Only call this function during Play."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
-		}
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequenceByHandle(
+	const FAGX_AgxMsgsAnySequence& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::AgxMsgsAnySequence, Msg, Handle);
+}
 
-		Barrier = &NativeBarriers.Add(Topic, FROS2PublisherBarrier());
-		Barrier->AllocateNative(Type, Topic, Qos, DomainID);
-	}
-	else if (Barrier->GetMessageType() != Type)
-	{
-		UE_LOG(
-			LogAGX, Error,
-			TEXT("Existing Native ROS2 Publisher with different message type found in "
-				 "UAGX_ROS2Publisher::GetOrCreateBarrier for Topic: '%s', Publisher Component '%s' "
-				 "in Actor '%s'. Ensure only single message types are used for a specific Topic."),
-			*Topic, *GetName(), *GetLabelSafe(GetOwner()));
-		return nullptr;
-	}
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesTimeByHandle(
+	const FAGX_BuiltinInterfacesTime& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesTime, Msg, Handle);
+}
 
-	AGX_CHECK(Barrier->HasNative());
-	return Barrier;
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDurationByHandle(
+	const FAGX_BuiltinInterfacesDuration& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Msg, Handle);
 }
 
-#if WITH_EDITOR
-bool UAGX_ROS2PublisherComponent::CanEditChange(const FProperty* InProperty) const
+bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClockByHandle(
+	const FAGX_RosgraphMsgsClock& Msg, FAGX_ROS2TopicHandle& Handle)
 {
-	const bool SuperCanEditChange = Super::CanEditChange(InProperty);
-	if (!SuperCanEditChange)
-		return false;
+	return Send(EAGX_ROS2MessageType::RosgraphMsgsClock, Msg, Handle);
+}
 
-	if (InProperty->GetFName().IsEqual(GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, Qos)) ||
+bool UAGX_ROS2PublisherComponent::SendStdMsgsBoolByHandle(
+	const FAGX_StdMsgsBool& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsBool, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByteByHandle(
+	const FAGX_StdMsgsByte& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByte, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByteMultiArrayByHandle(
+	const FAGX_StdMsgsByteMultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsCharByHandle(
+	const FAGX_StdMsgsChar& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsChar, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsColorRGBAByHandle(
+	const FAGX_StdMsgsColorRGBA& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsColorRGBA, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsEmptyByHandle(
+	const FAGX_StdMsgsEmpty& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsEmpty, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32ByHandle(
+	const FAGX_StdMsgsFloat32& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32MultiArrayByHandle(
+	const FAGX_StdMsgsFloat32MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64ByHandle(
+	const FAGX_StdMsgsFloat64& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64MultiArrayByHandle(
+	const FAGX_StdMsgsFloat64MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16ByHandle(
+	const FAGX_StdMsgsInt16& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16MultiArrayByHandle(
+	const FAGX_StdMsgsInt16MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32ByHandle(
+	const FAGX_StdMsgsInt32& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32MultiArrayByHandle(
+	const FAGX_StdMsgsInt32MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64ByHandle(
+	const FAGX_StdMsgsInt64& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64MultiArrayByHandle(
+	const FAGX_StdMsgsInt64MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8ByHandle(
+	const FAGX_StdMsgsInt8& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8MultiArrayByHandle(
+	const FAGX_StdMsgsInt8MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsStringByHandle(
+	const FAGX_StdMsgsString& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsString, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16ByHandle(
+	const FAGX_StdMsgsUInt16& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16MultiArrayByHandle(
+	const FAGX_StdMsgsUInt16MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32ByHandle(
+	const FAGX_StdMsgsUInt32& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32MultiArrayByHandle(
+	const FAGX_StdMsgsUInt32MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64ByHandle(
+	const FAGX_StdMsgsUInt64& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64MultiArrayByHandle(
+	const FAGX_StdMsgsUInt64MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8ByHandle(
+	const FAGX_StdMsgsUInt8& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8MultiArrayByHandle(
+	const FAGX_StdMsgsUInt8MultiArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsHeaderByHandle(
+	const FAGX_StdMsgsHeader& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsHeader, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3ByHandle(
+	const FAGX_GeometryMsgsVector3& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionByHandle(
+	const FAGX_GeometryMsgsQuaternion& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelByHandle(
+	const FAGX_GeometryMsgsAccel& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccel, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelStampedByHandle(
+	const FAGX_GeometryMsgsAccelStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceByHandle(
+	const FAGX_GeometryMsgsAccelWithCovariance& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceStampedByHandle(
+	const FAGX_GeometryMsgsAccelWithCovarianceStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaByHandle(
+	const FAGX_GeometryMsgsInertia& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertia, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaStampedByHandle(
+	const FAGX_GeometryMsgsInertiaStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointByHandle(
+	const FAGX_GeometryMsgsPoint& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint32ByHandle(
+	const FAGX_GeometryMsgsPoint32& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint32, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointStampedByHandle(
+	const FAGX_GeometryMsgsPointStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonByHandle(
+	const FAGX_GeometryMsgsPolygon& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygon, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonStampedByHandle(
+	const FAGX_GeometryMsgsPolygonStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseByHandle(
+	const FAGX_GeometryMsgsPose& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose2DByHandle(
+	const FAGX_GeometryMsgsPose2D& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose2D, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseArrayByHandle(
+	const FAGX_GeometryMsgsPoseArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseStampedByHandle(
+	const FAGX_GeometryMsgsPoseStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceByHandle(
+	const FAGX_GeometryMsgsPoseWithCovariance& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceStampedByHandle(
+	const FAGX_GeometryMsgsPoseWithCovarianceStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionStampedByHandle(
+	const FAGX_GeometryMsgsQuaternionStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformByHandle(
+	const FAGX_GeometryMsgsTransform& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransform, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformStampedByHandle(
+	const FAGX_GeometryMsgsTransformStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistByHandle(
+	const FAGX_GeometryMsgsTwist& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwist, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistStampedByHandle(
+	const FAGX_GeometryMsgsTwistStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceByHandle(
+	const FAGX_GeometryMsgsTwistWithCovariance& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceStampedByHandle(
+	const FAGX_GeometryMsgsTwistWithCovarianceStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3StampedByHandle(
+	const FAGX_GeometryMsgsVector3Stamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchByHandle(
+	const FAGX_GeometryMsgsWrench& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrench, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStampedByHandle(
+	const FAGX_GeometryMsgsWrenchStamped& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsBatteryStateByHandle(
+	const FAGX_SensorMsgsBatteryState& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsBatteryState, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsChannelFloat32ByHandle(
+	const FAGX_SensorMsgsChannelFloat32& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCompressedImageByHandle(
+	const FAGX_SensorMsgsCompressedImage& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsFluidPressureByHandle(
+	const FAGX_SensorMsgsFluidPressure& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsIlluminanceByHandle(
+	const FAGX_SensorMsgsIlluminance& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsIlluminance, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImageByHandle(
+	const FAGX_SensorMsgsImage& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImage, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImuByHandle(
+	const FAGX_SensorMsgsImu& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImu, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJointStateByHandle(
+	const FAGX_SensorMsgsJointState& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJointState, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyByHandle(
+	const FAGX_SensorMsgsJoy& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoy, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackByHandle(
+	const FAGX_SensorMsgsJoyFeedback& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackArrayByHandle(
+	const FAGX_SensorMsgsJoyFeedbackArray& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserEchoByHandle(
+	const FAGX_SensorMsgsLaserEcho& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserScanByHandle(
+	const FAGX_SensorMsgsLaserScan& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserScan, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMagneticFieldByHandle(
+	const FAGX_SensorMsgsMagneticField& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMagneticField, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiDOFJointStateByHandle(
+	const FAGX_SensorMsgsMultiDOFJointState& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiEchoLaserScanByHandle(
+	const FAGX_SensorMsgsMultiEchoLaserScan& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatStatusByHandle(
+	const FAGX_SensorMsgsNavSatStatus& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatFixByHandle(
+	const FAGX_SensorMsgsNavSatFix& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloudByHandle(
+	const FAGX_SensorMsgsPointCloud& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointFieldByHandle(
+	const FAGX_SensorMsgsPointField& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointField, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2ByHandle(
+	const FAGX_SensorMsgsPointCloud2& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRangeByHandle(
+	const FAGX_SensorMsgsRange& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRange, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRegionOfInterestByHandle(
+	const FAGX_SensorMsgsRegionOfInterest& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCameraInfoByHandle(
+	const FAGX_SensorMsgsCameraInfo& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRelativeHumidityByHandle(
+	const FAGX_SensorMsgsRelativeHumidity& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTemperatureByHandle(
+	const FAGX_SensorMsgsTemperature& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTemperature, Msg, Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTimeReferenceByHandle(
+	const FAGX_SensorMsgsTimeReference& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTimeReference, Msg, Handle);
+}
+
+//
+// Rvalue variants.
+//
+
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAny(FAGX_AgxMsgsAny&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::AgxMsgsAny, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequence(
+	FAGX_AgxMsgsAnySequence&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::AgxMsgsAnySequence, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesTime(
+	FAGX_BuiltinInterfacesTime&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesTime, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDuration(
+	FAGX_BuiltinInterfacesDuration&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesDuration, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClock(
+	FAGX_RosgraphMsgsClock&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::RosgraphMsgsClock, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsBool(FAGX_StdMsgsBool&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsBool, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByte(FAGX_StdMsgsByte&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByte, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByteMultiArray(
+	FAGX_StdMsgsByteMultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByteMultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsChar(FAGX_StdMsgsChar&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsChar, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsColorRGBA(
+	FAGX_StdMsgsColorRGBA&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsColorRGBA, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsEmpty(FAGX_StdMsgsEmpty&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsEmpty, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32(
+	FAGX_StdMsgsFloat32&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32MultiArray(
+	FAGX_StdMsgsFloat32MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64(
+	FAGX_StdMsgsFloat64&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64MultiArray(
+	FAGX_StdMsgsFloat64MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16(FAGX_StdMsgsInt16&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16MultiArray(
+	FAGX_StdMsgsInt16MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32(FAGX_StdMsgsInt32&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32MultiArray(
+	FAGX_StdMsgsInt32MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64(FAGX_StdMsgsInt64&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64MultiArray(
+	FAGX_StdMsgsInt64MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8(FAGX_StdMsgsInt8&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8MultiArray(
+	FAGX_StdMsgsInt8MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsString(FAGX_StdMsgsString&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsString, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16(FAGX_StdMsgsUInt16&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16MultiArray(
+	FAGX_StdMsgsUInt16MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32(FAGX_StdMsgsUInt32&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32MultiArray(
+	FAGX_StdMsgsUInt32MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64(FAGX_StdMsgsUInt64&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64MultiArray(
+	FAGX_StdMsgsUInt64MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8(FAGX_StdMsgsUInt8&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8MultiArray(
+	FAGX_StdMsgsUInt8MultiArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsHeader(FAGX_StdMsgsHeader&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsHeader, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3(
+	FAGX_GeometryMsgsVector3&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternion(
+	FAGX_GeometryMsgsQuaternion&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternion, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccel(
+	FAGX_GeometryMsgsAccel&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccel, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelStamped(
+	FAGX_GeometryMsgsAccelStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovariance(
+	FAGX_GeometryMsgsAccelWithCovariance&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceStamped(
+	FAGX_GeometryMsgsAccelWithCovarianceStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertia(
+	FAGX_GeometryMsgsInertia&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertia, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaStamped(
+	FAGX_GeometryMsgsInertiaStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint(
+	FAGX_GeometryMsgsPoint&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint32(
+	FAGX_GeometryMsgsPoint32&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint32, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointStamped(
+	FAGX_GeometryMsgsPointStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPointStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygon(
+	FAGX_GeometryMsgsPolygon&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygon, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonStamped(
+	FAGX_GeometryMsgsPolygonStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose(
+	FAGX_GeometryMsgsPose&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose2D(
+	FAGX_GeometryMsgsPose2D&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose2D, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseArray(
+	FAGX_GeometryMsgsPoseArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseStamped(
+	FAGX_GeometryMsgsPoseStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovariance(
+	FAGX_GeometryMsgsPoseWithCovariance&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceStamped(
+	FAGX_GeometryMsgsPoseWithCovarianceStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionStamped(
+	FAGX_GeometryMsgsQuaternionStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransform(
+	FAGX_GeometryMsgsTransform&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransform, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformStamped(
+	FAGX_GeometryMsgsTransformStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwist(
+	FAGX_GeometryMsgsTwist&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwist, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistStamped(
+	FAGX_GeometryMsgsTwistStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovariance(
+	FAGX_GeometryMsgsTwistWithCovariance&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceStamped(
+	FAGX_GeometryMsgsTwistWithCovarianceStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3Stamped(
+	FAGX_GeometryMsgsVector3Stamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrench(
+	FAGX_GeometryMsgsWrench&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrench, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStamped(
+	FAGX_GeometryMsgsWrenchStamped&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsBatteryState(
+	FAGX_SensorMsgsBatteryState&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsBatteryState, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsChannelFloat32(
+	FAGX_SensorMsgsChannelFloat32&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCompressedImage(
+	FAGX_SensorMsgsCompressedImage&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCompressedImage, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsFluidPressure(
+	FAGX_SensorMsgsFluidPressure&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsFluidPressure, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsIlluminance(
+	FAGX_SensorMsgsIlluminance&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsIlluminance, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImage(
+	FAGX_SensorMsgsImage&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImage, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImu(FAGX_SensorMsgsImu&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImu, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJointState(
+	FAGX_SensorMsgsJointState&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJointState, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoy(FAGX_SensorMsgsJoy&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoy, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedback(
+	FAGX_SensorMsgsJoyFeedback&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackArray(
+	FAGX_SensorMsgsJoyFeedbackArray&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserEcho(
+	FAGX_SensorMsgsLaserEcho&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserEcho, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserScan(
+	FAGX_SensorMsgsLaserScan&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserScan, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMagneticField(
+	FAGX_SensorMsgsMagneticField&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMagneticField, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiDOFJointState(
+	FAGX_SensorMsgsMultiDOFJointState&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiEchoLaserScan(
+	FAGX_SensorMsgsMultiEchoLaserScan&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatStatus(
+	FAGX_SensorMsgsNavSatStatus&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatFix(
+	FAGX_SensorMsgsNavSatFix&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatFix, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud(
+	FAGX_SensorMsgsPointCloud&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointField(
+	FAGX_SensorMsgsPointField&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointField, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2(
+	FAGX_SensorMsgsPointCloud2&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud2, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRange(
+	FAGX_SensorMsgsRange&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRange, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRegionOfInterest(
+	FAGX_SensorMsgsRegionOfInterest&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCameraInfo(
+	FAGX_SensorMsgsCameraInfo&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCameraInfo, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRelativeHumidity(
+	FAGX_SensorMsgsRelativeHumidity&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTemperature(
+	FAGX_SensorMsgsTemperature&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTemperature, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTimeReference(
+	FAGX_SensorMsgsTimeReference&& Msg, const FString& Topic)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTimeReference, MoveTemp(Msg), Topic);
+}
+
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnyByHandle(
+	FAGX_AgxMsgsAny&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::AgxMsgsAny, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendAgxMsgsAnySequenceByHandle(
+	FAGX_AgxMsgsAnySequence&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::AgxMsgsAnySequence, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesTimeByHandle(
+	FAGX_BuiltinInterfacesTime&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesTime, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendBuiltinInterfacesDurationByHandle(
+	FAGX_BuiltinInterfacesDuration&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::BuiltinInterfacesDuration, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendRosgraphMsgsClockByHandle(
+	FAGX_RosgraphMsgsClock&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::RosgraphMsgsClock, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsBoolByHandle(
+	FAGX_StdMsgsBool&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsBool, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByteByHandle(
+	FAGX_StdMsgsByte&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByte, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsByteMultiArrayByHandle(
+	FAGX_StdMsgsByteMultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsByteMultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsCharByHandle(
+	FAGX_StdMsgsChar&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsChar, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsColorRGBAByHandle(
+	FAGX_StdMsgsColorRGBA&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsColorRGBA, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsEmptyByHandle(
+	FAGX_StdMsgsEmpty&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsEmpty, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32ByHandle(
+	FAGX_StdMsgsFloat32&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat32MultiArrayByHandle(
+	FAGX_StdMsgsFloat32MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64ByHandle(
+	FAGX_StdMsgsFloat64&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsFloat64MultiArrayByHandle(
+	FAGX_StdMsgsFloat64MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16ByHandle(
+	FAGX_StdMsgsInt16&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt16MultiArrayByHandle(
+	FAGX_StdMsgsInt16MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32ByHandle(
+	FAGX_StdMsgsInt32&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt32MultiArrayByHandle(
+	FAGX_StdMsgsInt32MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64ByHandle(
+	FAGX_StdMsgsInt64&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt64MultiArrayByHandle(
+	FAGX_StdMsgsInt64MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8ByHandle(
+	FAGX_StdMsgsInt8&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsInt8MultiArrayByHandle(
+	FAGX_StdMsgsInt8MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsStringByHandle(
+	FAGX_StdMsgsString&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsString, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16ByHandle(
+	FAGX_StdMsgsUInt16&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt16MultiArrayByHandle(
+	FAGX_StdMsgsUInt16MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32ByHandle(
+	FAGX_StdMsgsUInt32&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt32MultiArrayByHandle(
+	FAGX_StdMsgsUInt32MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64ByHandle(
+	FAGX_StdMsgsUInt64&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt64MultiArrayByHandle(
+	FAGX_StdMsgsUInt64MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8ByHandle(
+	FAGX_StdMsgsUInt8&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsUInt8MultiArrayByHandle(
+	FAGX_StdMsgsUInt8MultiArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendStdMsgsHeaderByHandle(
+	FAGX_StdMsgsHeader&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::StdMsgsHeader, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3ByHandle(
+	FAGX_GeometryMsgsVector3&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionByHandle(
+	FAGX_GeometryMsgsQuaternion&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternion, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelByHandle(
+	FAGX_GeometryMsgsAccel&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccel, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelStampedByHandle(
+	FAGX_GeometryMsgsAccelStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceByHandle(
+	FAGX_GeometryMsgsAccelWithCovariance&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsAccelWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsAccelWithCovarianceStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaByHandle(
+	FAGX_GeometryMsgsInertia&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertia, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsInertiaStampedByHandle(
+	FAGX_GeometryMsgsInertiaStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointByHandle(
+	FAGX_GeometryMsgsPoint&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoint32ByHandle(
+	FAGX_GeometryMsgsPoint32&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoint32, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPointStampedByHandle(
+	FAGX_GeometryMsgsPointStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPointStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonByHandle(
+	FAGX_GeometryMsgsPolygon&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygon, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPolygonStampedByHandle(
+	FAGX_GeometryMsgsPolygonStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseByHandle(
+	FAGX_GeometryMsgsPose&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPose2DByHandle(
+	FAGX_GeometryMsgsPose2D&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPose2D, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseArrayByHandle(
+	FAGX_GeometryMsgsPoseArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseStampedByHandle(
+	FAGX_GeometryMsgsPoseStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceByHandle(
+	FAGX_GeometryMsgsPoseWithCovariance&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsPoseWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsPoseWithCovarianceStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsQuaternionStampedByHandle(
+	FAGX_GeometryMsgsQuaternionStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformByHandle(
+	FAGX_GeometryMsgsTransform&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransform, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTransformStampedByHandle(
+	FAGX_GeometryMsgsTransformStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistByHandle(
+	FAGX_GeometryMsgsTwist&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwist, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistStampedByHandle(
+	FAGX_GeometryMsgsTwistStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceByHandle(
+	FAGX_GeometryMsgsTwistWithCovariance&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsTwistWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsTwistWithCovarianceStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsVector3StampedByHandle(
+	FAGX_GeometryMsgsVector3Stamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchByHandle(
+	FAGX_GeometryMsgsWrench&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrench, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendGeometryMsgsWrenchStampedByHandle(
+	FAGX_GeometryMsgsWrenchStamped&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsBatteryStateByHandle(
+	FAGX_SensorMsgsBatteryState&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsBatteryState, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsChannelFloat32ByHandle(
+	FAGX_SensorMsgsChannelFloat32&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCompressedImageByHandle(
+	FAGX_SensorMsgsCompressedImage&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCompressedImage, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsFluidPressureByHandle(
+	FAGX_SensorMsgsFluidPressure&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsFluidPressure, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsIlluminanceByHandle(
+	FAGX_SensorMsgsIlluminance&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsIlluminance, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImageByHandle(
+	FAGX_SensorMsgsImage&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImage, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsImuByHandle(
+	FAGX_SensorMsgsImu&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsImu, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJointStateByHandle(
+	FAGX_SensorMsgsJointState&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJointState, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyByHandle(
+	FAGX_SensorMsgsJoy&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoy, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackByHandle(
+	FAGX_SensorMsgsJoyFeedback&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsJoyFeedbackArrayByHandle(
+	FAGX_SensorMsgsJoyFeedbackArray&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserEchoByHandle(
+	FAGX_SensorMsgsLaserEcho&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserEcho, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsLaserScanByHandle(
+	FAGX_SensorMsgsLaserScan&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsLaserScan, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMagneticFieldByHandle(
+	FAGX_SensorMsgsMagneticField&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMagneticField, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiDOFJointStateByHandle(
+	FAGX_SensorMsgsMultiDOFJointState&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsMultiEchoLaserScanByHandle(
+	FAGX_SensorMsgsMultiEchoLaserScan&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatStatusByHandle(
+	FAGX_SensorMsgsNavSatStatus&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsNavSatFixByHandle(
+	FAGX_SensorMsgsNavSatFix&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsNavSatFix, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloudByHandle(
+	FAGX_SensorMsgsPointCloud&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointFieldByHandle(
+	FAGX_SensorMsgsPointField&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointField, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsPointCloud2ByHandle(
+	FAGX_SensorMsgsPointCloud2&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsPointCloud2, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRangeByHandle(
+	FAGX_SensorMsgsRange&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRange, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRegionOfInterestByHandle(
+	FAGX_SensorMsgsRegionOfInterest&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsCameraInfoByHandle(
+	FAGX_SensorMsgsCameraInfo&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsCameraInfo, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsRelativeHumidityByHandle(
+	FAGX_SensorMsgsRelativeHumidity&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTemperatureByHandle(
+	FAGX_SensorMsgsTemperature&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTemperature, MoveTemp(Msg), Handle);
+}
+
+bool UAGX_ROS2PublisherComponent::SendSensorMsgsTimeReferenceByHandle(
+	FAGX_SensorMsgsTimeReference&& Msg, FAGX_ROS2TopicHandle& Handle)
+{
+	return Send(EAGX_ROS2MessageType::SensorMsgsTimeReference, MoveTemp(Msg), Handle);
+}
+
+FROS2PublisherBarrier* UAGX_ROS2PublisherComponent::GetOrCreateBarrier(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	const int32 Index = GetOrCreateBarrierIndex(Type, Topic);
+	return Index != INDEX_NONE ? NativeBarriers[Index].Get() : nullptr;
+}
+
+FROS2PublisherBarrier* UAGX_ROS2PublisherComponent::GetOrCreateBarrier(
+	EAGX_ROS2MessageType Type, FAGX_ROS2TopicHandle& Handle)
+{
+	if (Handle.IsResolvedFor(*this, Type, TopicHandleGeneration))
+	{
+		return NativeBarriers[Handle.Index].Get();
+	}
+
+	Handle.Index = GetOrCreateBarrierIndex(Type, Handle.GetTopic());
+	if (Handle.Index == INDEX_NONE)
+		return nullptr;
+
+	Handle.Owner = this;
+	Handle.MessageType = Type;
+	Handle.Generation = TopicHandleGeneration;
+	return NativeBarriers[Handle.Index].Get();
+}
+
+FAGX_ROS2TopicHandle UAGX_ROS2PublisherComponent::GetTopicHandle(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	FAGX_ROS2TopicHandle Handle(Topic);
+	GetOrCreateBarrier(Type, Handle);
+	return Handle;
+}
+
+int32 UAGX_ROS2PublisherComponent::GetOrCreateBarrierIndex(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	const int32* Found = BarrierIndices.Find(Topic);
+	if (Found == nullptr)
+	{
+		if (Topic.IsEmpty())
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
+					 "whith an empty Topic String. Ensure a Topic has been set."),
+				*GetName(), *GetLabelSafe(GetOwner()));
+			return INDEX_NONE;
+		}
+
+		bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
+		if (!bIsPlaying)
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT("GetOrCreateBarrier was called on ROS2 Publisher Component '%s' in Actor '%s' "
+					 "when not inPlay. Only call this function during Play."),
+				*GetName(), *GetLabelSafe(GetOwner()));
+			return INDEX_NONE;
+		}
+
+		const int32 Index = NativeBarriers.Add(MakeUnique<FROS2PublisherBarrier>());
+		NativeBarriers[Index]->AllocateNative(Type, Topic, Qos, DomainID);
+		BarrierIndices.Add(Topic, Index);
+		return Index;
+	}
+	else if (NativeBarriers[*Found]->GetMessageType() != Type)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Existing Native ROS2 Publisher with different message type found in "
+				 "UAGX_ROS2Publisher::GetOrCreateBarrier for Topic: '%s', Publisher Component '%s' "
+				 "in Actor '%s'. Ensure only single message types are used for a specific Topic."),
+			*Topic, *GetName(), *GetLabelSafe(GetOwner()));
+		return INDEX_NONE;
+	}
+
+	AGX_CHECK(NativeBarriers[*Found]->HasNative());
+	return *Found;
+}
+
+#if WITH_EDITOR
+bool UAGX_ROS2PublisherComponent::CanEditChange(const FProperty* InProperty) const
+{
+	const bool SuperCanEditChange = Super::CanEditChange(InProperty);
+	if (!SuperCanEditChange)
+		return false;
+
+	if (InProperty->GetFName().IsEqual(GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, Qos)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, DomainID)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, bPublishAsync)) ||
+		InProperty->GetFName().IsEqual(
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, AsyncQueueCapacity)) ||
 		InProperty->GetFName().IsEqual(
-			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, DomainID)))
+			GET_MEMBER_NAME_CHECKED(UAGX_ROS2PublisherComponent, QueueFullPolicy)))
 	{
 		UWorld* World = GetWorld();
 		return World == nullptr || !World->IsGameWorld();
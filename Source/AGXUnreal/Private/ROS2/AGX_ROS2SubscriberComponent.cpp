@@ -15,6 +15,40 @@ UAGX_ROS2SubscriberComponent::UAGX_ROS2SubscriberComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UAGX_ROS2SubscriberComponent::EndPlay(const EEndPlayReason::Type Reason)
+{
+	Super::EndPlay(Reason);
+
+	NativeBarriers.Empty();
+	BarrierIndices.Empty();
+	++TopicHandleGeneration;
+}
+
+template <typename MessageType>
+int32 UAGX_ROS2SubscriberComponent::ReceiveBatch(
+	EAGX_ROS2MessageType Type, TArray<MessageType>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	OutMessages.Reset();
+	FROS2SubscriberBarrier* Barrier = GetOrCreateBarrier(Type, Topic);
+	if (Barrier == nullptr)
+		return 0;
+
+	if (bLatestOnly)
+		MaxMessages = FMath::Min(MaxMessages, 1);
+
+	// Look up the Barrier once and drain it natively, instead of one lookup per message.
+	while (OutMessages.Num() < MaxMessages)
+	{
+		MessageType Message;
+		if (!Barrier->ReceiveMessage(Message, bLatestOnly))
+			break;
+		OutMessages.Add(MoveTemp(Message));
+	}
+
+	return OutMessages.Num();
+}
+
 //
 // AgxMsgs
 //
@@ -761,51 +795,1559 @@ bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTimeReference(
 	return false;
 }
 
-FROS2SubscriberBarrier* UAGX_ROS2SubscriberComponent::GetOrCreateBarrier(
-	EAGX_ROS2MessageType Type, const FString& Topic)
+//
+// Topic Handle variants.
+//
+
+bool UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnyByHandle(
+	FAGX_AgxMsgsAny& OutMessage, FAGX_ROS2TopicHandle& Handle)
 {
-	FROS2SubscriberBarrier* Barrier = NativeBarriers.Find(Topic);
-	if (Barrier == nullptr)
-	{
-		if (Topic.IsEmpty())
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT(
-					"GetOrCreateBarrier was called on ROS2 Subscriber Component '%s' in Actor '%s' "
-					"with an empty Topic String. Ensure a Topic has been set."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
-		}
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAny, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
 
-		bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
-		if (!bIsPlaying)
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT(
-					"GetOrCreateBarrier was called on ROS2 Subscriber Component '%s' in Actor '%s' "
-					"when not in Play. Only call this function during Play."),
-				*GetName(), *GetLabelSafe(GetOwner()));
-			return nullptr;
-		}
+bool UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnySequenceByHandle(
+	FAGX_AgxMsgsAnySequence& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::AgxMsgsAnySequence, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
 
-		Barrier = &NativeBarriers.Add(Topic, FROS2SubscriberBarrier());
-		Barrier->AllocateNative(Type, Topic, Qos, DomainID);
-	}
-	else if (Barrier->GetMessageType() != Type)
-	{
-		UE_LOG(
-			LogAGX, Error,
-			TEXT("Existing Native ROS2 Subscriber with different message type found in "
-				 "UAGX_ROS2Subscriber::GetOrCreateBarrier for Topic: '%s', Publisher Compoent '%s' "
-				 "in Actor '%s'. Ensure only single message types are used for a specific Topic."),
-			*Topic, *GetName(), *GetLabelSafe(GetOwner()));
-		return nullptr;
+bool UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesTimeByHandle(
+	FAGX_BuiltinInterfacesTime& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesTime, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesDurationByHandle(
+	FAGX_BuiltinInterfacesDuration& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::BuiltinInterfacesDuration, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveRosgraphMsgsClockByHandle(
+	FAGX_RosgraphMsgsClock& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::RosgraphMsgsClock, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsBoolByHandle(
+	FAGX_StdMsgsBool& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsBool, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByteByHandle(
+	FAGX_StdMsgsByte& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByte, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByteMultiArrayByHandle(
+	FAGX_StdMsgsByteMultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsByteMultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsCharByHandle(
+	FAGX_StdMsgsChar& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsChar, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsColorRGBAByHandle(
+	FAGX_StdMsgsColorRGBA& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsColorRGBA, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsEmptyByHandle(
+	FAGX_StdMsgsEmpty& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsEmpty, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32ByHandle(
+	FAGX_StdMsgsFloat32& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32MultiArrayByHandle(
+	FAGX_StdMsgsFloat32MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64ByHandle(
+	FAGX_StdMsgsFloat64& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64MultiArrayByHandle(
+	FAGX_StdMsgsFloat64MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16ByHandle(
+	FAGX_StdMsgsInt16& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16MultiArrayByHandle(
+	FAGX_StdMsgsInt16MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt16MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32ByHandle(
+	FAGX_StdMsgsInt32& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32MultiArrayByHandle(
+	FAGX_StdMsgsInt32MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt32MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64ByHandle(
+	FAGX_StdMsgsInt64& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64MultiArrayByHandle(
+	FAGX_StdMsgsInt64MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt64MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8ByHandle(
+	FAGX_StdMsgsInt8& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8MultiArrayByHandle(
+	FAGX_StdMsgsInt8MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsInt8MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsStringByHandle(
+	FAGX_StdMsgsString& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsString, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16ByHandle(
+	FAGX_StdMsgsUInt16& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16MultiArrayByHandle(
+	FAGX_StdMsgsUInt16MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32ByHandle(
+	FAGX_StdMsgsUInt32& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32MultiArrayByHandle(
+	FAGX_StdMsgsUInt32MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64ByHandle(
+	FAGX_StdMsgsUInt64& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64MultiArrayByHandle(
+	FAGX_StdMsgsUInt64MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8ByHandle(
+	FAGX_StdMsgsUInt8& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8MultiArrayByHandle(
+	FAGX_StdMsgsUInt8MultiArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveStdMsgsHeaderByHandle(
+	FAGX_StdMsgsHeader& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::StdMsgsHeader, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3ByHandle(
+	FAGX_GeometryMsgsVector3& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternionByHandle(
+	FAGX_GeometryMsgsQuaternion& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternion, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelByHandle(
+	FAGX_GeometryMsgsAccel& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccel, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelStampedByHandle(
+	FAGX_GeometryMsgsAccelStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovarianceByHandle(
+	FAGX_GeometryMsgsAccelWithCovariance& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsAccelWithCovarianceStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertiaByHandle(
+	FAGX_GeometryMsgsInertia& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertia, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertiaStampedByHandle(
+	FAGX_GeometryMsgsInertiaStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPointByHandle(
+	FAGX_GeometryMsgsPoint& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoint32ByHandle(
+	FAGX_GeometryMsgsPoint32& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoint32, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPointStampedByHandle(
+	FAGX_GeometryMsgsPointStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPointStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygonByHandle(
+	FAGX_GeometryMsgsPolygon& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygon, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygonStampedByHandle(
+	FAGX_GeometryMsgsPolygonStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseByHandle(
+	FAGX_GeometryMsgsPose& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPose2DByHandle(
+	FAGX_GeometryMsgsPose2D& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPose2D, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseArrayByHandle(
+	FAGX_GeometryMsgsPoseArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseStampedByHandle(
+	FAGX_GeometryMsgsPoseStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovarianceByHandle(
+	FAGX_GeometryMsgsPoseWithCovariance& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsPoseWithCovarianceStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternionStampedByHandle(
+	FAGX_GeometryMsgsQuaternionStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransformByHandle(
+	FAGX_GeometryMsgsTransform& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransform, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransformStampedByHandle(
+	FAGX_GeometryMsgsTransformStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTransformStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistByHandle(
+	FAGX_GeometryMsgsTwist& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwist, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistStampedByHandle(
+	FAGX_GeometryMsgsTwistStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovarianceByHandle(
+	FAGX_GeometryMsgsTwistWithCovariance& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovarianceStampedByHandle(
+	FAGX_GeometryMsgsTwistWithCovarianceStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3StampedByHandle(
+	FAGX_GeometryMsgsVector3Stamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchByHandle(
+	FAGX_GeometryMsgsWrench& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrench, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchStampedByHandle(
+	FAGX_GeometryMsgsWrenchStamped& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsBatteryStateByHandle(
+	FAGX_SensorMsgsBatteryState& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsBatteryState, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsChannelFloat32ByHandle(
+	FAGX_SensorMsgsChannelFloat32& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsChannelFloat32, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCompressedImageByHandle(
+	FAGX_SensorMsgsCompressedImage& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCompressedImage, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsFluidPressureByHandle(
+	FAGX_SensorMsgsFluidPressure& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsFluidPressure, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsIlluminanceByHandle(
+	FAGX_SensorMsgsIlluminance& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsIlluminance, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImageByHandle(
+	FAGX_SensorMsgsImage& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImage, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImuByHandle(
+	FAGX_SensorMsgsImu& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsImu, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJointStateByHandle(
+	FAGX_SensorMsgsJointState& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJointState, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyByHandle(
+	FAGX_SensorMsgsJoy& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoy, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedbackByHandle(
+	FAGX_SensorMsgsJoyFeedback& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedback, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedbackArrayByHandle(
+	FAGX_SensorMsgsJoyFeedbackArray& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserEchoByHandle(
+	FAGX_SensorMsgsLaserEcho& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserEcho, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserScanByHandle(
+	FAGX_SensorMsgsLaserScan& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsLaserScan, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMagneticFieldByHandle(
+	FAGX_SensorMsgsMagneticField& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMagneticField, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiDOFJointStateByHandle(
+	FAGX_SensorMsgsMultiDOFJointState& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiEchoLaserScanByHandle(
+	FAGX_SensorMsgsMultiEchoLaserScan& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier =
+			GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatStatusByHandle(
+	FAGX_SensorMsgsNavSatStatus& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatStatus, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatFixByHandle(
+	FAGX_SensorMsgsNavSatFix& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsNavSatFix, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloudByHandle(
+	FAGX_SensorMsgsPointCloud& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointFieldByHandle(
+	FAGX_SensorMsgsPointField& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointField, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloud2ByHandle(
+	FAGX_SensorMsgsPointCloud2& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsPointCloud2, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRangeByHandle(
+	FAGX_SensorMsgsRange& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRange, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRegionOfInterestByHandle(
+	FAGX_SensorMsgsRegionOfInterest& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCameraInfoByHandle(
+	FAGX_SensorMsgsCameraInfo& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsCameraInfo, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRelativeHumidityByHandle(
+	FAGX_SensorMsgsRelativeHumidity& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTemperatureByHandle(
+	FAGX_SensorMsgsTemperature& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTemperature, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+bool UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTimeReferenceByHandle(
+	FAGX_SensorMsgsTimeReference& OutMessage, FAGX_ROS2TopicHandle& Handle)
+{
+	if (auto Barrier = GetOrCreateBarrier(EAGX_ROS2MessageType::SensorMsgsTimeReference, Handle))
+		return Barrier->ReceiveMessage(OutMessage);
+	return false;
+}
+
+//
+// Batch variants.
+//
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnyBatch(
+	TArray<FAGX_AgxMsgsAny>& OutMessages, const FString& Topic, int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::AgxMsgsAny, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveAgxMsgsAnySequenceBatch(
+	TArray<FAGX_AgxMsgsAnySequence>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::AgxMsgsAnySequence, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesTimeBatch(
+	TArray<FAGX_BuiltinInterfacesTime>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::BuiltinInterfacesTime, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveBuiltinInterfacesDurationBatch(
+	TArray<FAGX_BuiltinInterfacesDuration>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::BuiltinInterfacesDuration, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveRosgraphMsgsClockBatch(
+	TArray<FAGX_RosgraphMsgsClock>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::RosgraphMsgsClock, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsBoolBatch(
+	TArray<FAGX_StdMsgsBool>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsBool, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByteBatch(
+	TArray<FAGX_StdMsgsByte>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsByte, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsByteMultiArrayBatch(
+	TArray<FAGX_StdMsgsByteMultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsByteMultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsCharBatch(
+	TArray<FAGX_StdMsgsChar>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsChar, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsColorRGBABatch(
+	TArray<FAGX_StdMsgsColorRGBA>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsColorRGBA, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsEmptyBatch(
+	TArray<FAGX_StdMsgsEmpty>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsEmpty, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32Batch(
+	TArray<FAGX_StdMsgsFloat32>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsFloat32, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat32MultiArrayBatch(
+	TArray<FAGX_StdMsgsFloat32MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsFloat32MultiArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64Batch(
+	TArray<FAGX_StdMsgsFloat64>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsFloat64, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsFloat64MultiArrayBatch(
+	TArray<FAGX_StdMsgsFloat64MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsFloat64MultiArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16Batch(
+	TArray<FAGX_StdMsgsInt16>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt16, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt16MultiArrayBatch(
+	TArray<FAGX_StdMsgsInt16MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt16MultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32Batch(
+	TArray<FAGX_StdMsgsInt32>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt32, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt32MultiArrayBatch(
+	TArray<FAGX_StdMsgsInt32MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt32MultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64Batch(
+	TArray<FAGX_StdMsgsInt64>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt64, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt64MultiArrayBatch(
+	TArray<FAGX_StdMsgsInt64MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt64MultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8Batch(
+	TArray<FAGX_StdMsgsInt8>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt8, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsInt8MultiArrayBatch(
+	TArray<FAGX_StdMsgsInt8MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsInt8MultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsStringBatch(
+	TArray<FAGX_StdMsgsString>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsString, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16Batch(
+	TArray<FAGX_StdMsgsUInt16>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt16, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt16MultiArrayBatch(
+	TArray<FAGX_StdMsgsUInt16MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt16MultiArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32Batch(
+	TArray<FAGX_StdMsgsUInt32>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt32, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt32MultiArrayBatch(
+	TArray<FAGX_StdMsgsUInt32MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt32MultiArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64Batch(
+	TArray<FAGX_StdMsgsUInt64>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt64, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt64MultiArrayBatch(
+	TArray<FAGX_StdMsgsUInt64MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt64MultiArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8Batch(
+	TArray<FAGX_StdMsgsUInt8>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt8, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsUInt8MultiArrayBatch(
+	TArray<FAGX_StdMsgsUInt8MultiArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsUInt8MultiArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveStdMsgsHeaderBatch(
+	TArray<FAGX_StdMsgsHeader>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::StdMsgsHeader, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3Batch(
+	TArray<FAGX_GeometryMsgsVector3>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsVector3, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternionBatch(
+	TArray<FAGX_GeometryMsgsQuaternion>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsQuaternion, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelBatch(
+	TArray<FAGX_GeometryMsgsAccel>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsAccel, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelStampedBatch(
+	TArray<FAGX_GeometryMsgsAccelStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsAccelStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovarianceBatch(
+	TArray<FAGX_GeometryMsgsAccelWithCovariance>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsAccelWithCovariance, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsAccelWithCovarianceStampedBatch(
+	TArray<FAGX_GeometryMsgsAccelWithCovarianceStamped>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsAccelWithCovarianceStamped, OutMessages, Topic,
+		MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertiaBatch(
+	TArray<FAGX_GeometryMsgsInertia>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsInertia, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsInertiaStampedBatch(
+	TArray<FAGX_GeometryMsgsInertiaStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsInertiaStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPointBatch(
+	TArray<FAGX_GeometryMsgsPoint>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoint, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoint32Batch(
+	TArray<FAGX_GeometryMsgsPoint32>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoint32, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPointStampedBatch(
+	TArray<FAGX_GeometryMsgsPointStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPointStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygonBatch(
+	TArray<FAGX_GeometryMsgsPolygon>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPolygon, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPolygonStampedBatch(
+	TArray<FAGX_GeometryMsgsPolygonStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPolygonStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseBatch(
+	TArray<FAGX_GeometryMsgsPose>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPose, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPose2DBatch(
+	TArray<FAGX_GeometryMsgsPose2D>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPose2D, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseArrayBatch(
+	TArray<FAGX_GeometryMsgsPoseArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoseArray, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseStampedBatch(
+	TArray<FAGX_GeometryMsgsPoseStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoseStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovarianceBatch(
+	TArray<FAGX_GeometryMsgsPoseWithCovariance>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoseWithCovariance, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsPoseWithCovarianceStampedBatch(
+	TArray<FAGX_GeometryMsgsPoseWithCovarianceStamped>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsPoseWithCovarianceStamped, OutMessages, Topic,
+		MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsQuaternionStampedBatch(
+	TArray<FAGX_GeometryMsgsQuaternionStamped>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsQuaternionStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransformBatch(
+	TArray<FAGX_GeometryMsgsTransform>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTransform, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTransformStampedBatch(
+	TArray<FAGX_GeometryMsgsTransformStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTransformStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistBatch(
+	TArray<FAGX_GeometryMsgsTwist>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTwist, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistStampedBatch(
+	TArray<FAGX_GeometryMsgsTwistStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTwistStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovarianceBatch(
+	TArray<FAGX_GeometryMsgsTwistWithCovariance>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTwistWithCovariance, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsTwistWithCovarianceStampedBatch(
+	TArray<FAGX_GeometryMsgsTwistWithCovarianceStamped>& OutMessages, const FString& Topic,
+	int32 MaxMessages, bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsTwistWithCovarianceStamped, OutMessages, Topic,
+		MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsVector3StampedBatch(
+	TArray<FAGX_GeometryMsgsVector3Stamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsVector3Stamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchBatch(
+	TArray<FAGX_GeometryMsgsWrench>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsWrench, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveGeometryMsgsWrenchStampedBatch(
+	TArray<FAGX_GeometryMsgsWrenchStamped>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::GeometryMsgsWrenchStamped, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsBatteryStateBatch(
+	TArray<FAGX_SensorMsgsBatteryState>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsBatteryState, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsChannelFloat32Batch(
+	TArray<FAGX_SensorMsgsChannelFloat32>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsChannelFloat32, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCompressedImageBatch(
+	TArray<FAGX_SensorMsgsCompressedImage>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsCompressedImage, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsFluidPressureBatch(
+	TArray<FAGX_SensorMsgsFluidPressure>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsFluidPressure, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsIlluminanceBatch(
+	TArray<FAGX_SensorMsgsIlluminance>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsIlluminance, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImageBatch(
+	TArray<FAGX_SensorMsgsImage>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsImage, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsImuBatch(
+	TArray<FAGX_SensorMsgsImu>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsImu, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJointStateBatch(
+	TArray<FAGX_SensorMsgsJointState>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsJointState, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyBatch(
+	TArray<FAGX_SensorMsgsJoy>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsJoy, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedbackBatch(
+	TArray<FAGX_SensorMsgsJoyFeedback>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsJoyFeedback, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsJoyFeedbackArrayBatch(
+	TArray<FAGX_SensorMsgsJoyFeedbackArray>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsJoyFeedbackArray, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserEchoBatch(
+	TArray<FAGX_SensorMsgsLaserEcho>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsLaserEcho, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsLaserScanBatch(
+	TArray<FAGX_SensorMsgsLaserScan>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsLaserScan, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMagneticFieldBatch(
+	TArray<FAGX_SensorMsgsMagneticField>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsMagneticField, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiDOFJointStateBatch(
+	TArray<FAGX_SensorMsgsMultiDOFJointState>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsMultiDOFJointState, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsMultiEchoLaserScanBatch(
+	TArray<FAGX_SensorMsgsMultiEchoLaserScan>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsMultiEchoLaserScan, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatStatusBatch(
+	TArray<FAGX_SensorMsgsNavSatStatus>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsNavSatStatus, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsNavSatFixBatch(
+	TArray<FAGX_SensorMsgsNavSatFix>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsNavSatFix, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloudBatch(
+	TArray<FAGX_SensorMsgsPointCloud>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsPointCloud, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointFieldBatch(
+	TArray<FAGX_SensorMsgsPointField>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsPointField, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsPointCloud2Batch(
+	TArray<FAGX_SensorMsgsPointCloud2>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsPointCloud2, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRangeBatch(
+	TArray<FAGX_SensorMsgsRange>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsRange, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRegionOfInterestBatch(
+	TArray<FAGX_SensorMsgsRegionOfInterest>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsRegionOfInterest, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsCameraInfoBatch(
+	TArray<FAGX_SensorMsgsCameraInfo>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsCameraInfo, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsRelativeHumidityBatch(
+	TArray<FAGX_SensorMsgsRelativeHumidity>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsRelativeHumidity, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTemperatureBatch(
+	TArray<FAGX_SensorMsgsTemperature>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsTemperature, OutMessages, Topic, MaxMessages, bLatestOnly);
+}
+
+int32 UAGX_ROS2SubscriberComponent::ReceiveSensorMsgsTimeReferenceBatch(
+	TArray<FAGX_SensorMsgsTimeReference>& OutMessages, const FString& Topic, int32 MaxMessages,
+	bool bLatestOnly)
+{
+	return ReceiveBatch(
+		EAGX_ROS2MessageType::SensorMsgsTimeReference, OutMessages, Topic, MaxMessages,
+		bLatestOnly);
+}
+
+FROS2SubscriberBarrier* UAGX_ROS2SubscriberComponent::GetOrCreateBarrier(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	const int32 Index = GetOrCreateBarrierIndex(Type, Topic);
+	return Index != INDEX_NONE ? &NativeBarriers[Index] : nullptr;
+}
+
+FROS2SubscriberBarrier* UAGX_ROS2SubscriberComponent::GetOrCreateBarrier(
+	EAGX_ROS2MessageType Type, FAGX_ROS2TopicHandle& Handle)
+{
+	if (Handle.IsResolvedFor(*this, Type, TopicHandleGeneration))
+	{
+		return &NativeBarriers[Handle.Index];
+	}
+
+	Handle.Index = GetOrCreateBarrierIndex(Type, Handle.GetTopic());
+	if (Handle.Index == INDEX_NONE)
+		return nullptr;
+
+	Handle.Owner = this;
+	Handle.MessageType = Type;
+	Handle.Generation = TopicHandleGeneration;
+	return &NativeBarriers[Handle.Index];
+}
+
+FAGX_ROS2TopicHandle UAGX_ROS2SubscriberComponent::GetTopicHandle(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	FAGX_ROS2TopicHandle Handle(Topic);
+	GetOrCreateBarrier(Type, Handle);
+	return Handle;
+}
+
+int32 UAGX_ROS2SubscriberComponent::GetOrCreateBarrierIndex(
+	EAGX_ROS2MessageType Type, const FString& Topic)
+{
+	const int32* Found = BarrierIndices.Find(Topic);
+	if (Found == nullptr)
+	{
+		if (Topic.IsEmpty())
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT(
+					"GetOrCreateBarrier was called on ROS2 Subscriber Component '%s' in Actor '%s' "
+					"with an empty Topic String. Ensure a Topic has been set."),
+				*GetName(), *GetLabelSafe(GetOwner()));
+			return INDEX_NONE;
+		}
+
+		bool bIsPlaying = GetWorld() != nullptr && GetWorld()->IsGameWorld();
+		if (!bIsPlaying)
+		{
+			UE_LOG(
+				LogAGX, Error,
+				TEXT(
+					"GetOrCreateBarrier was called on ROS2 Subscriber Component '%s' in Actor '%s' "
+					"when not in Play. Only call this function during Play."),
+				*GetName(), *GetLabelSafe(GetOwner()));
+			return INDEX_NONE;
+		}
+
+		const int32 Index = NativeBarriers.Emplace();
+		NativeBarriers[Index].AllocateNative(Type, Topic, Qos, DomainID);
+		BarrierIndices.Add(Topic, Index);
+		return Index;
+	}
+	else if (NativeBarriers[*Found].GetMessageType() != Type)
+	{
+		UE_LOG(
+			LogAGX, Error,
+			TEXT("Existing Native ROS2 Subscriber with different message type found in "
+				 "UAGX_ROS2Subscriber::GetOrCreateBarrier for Topic: '%s', Publisher Compoent '%s' "
+				 "in Actor '%s'. Ensure only single message types are used for a specific Topic."),
+			*Topic, *GetName(), *GetLabelSafe(GetOwner()));
+		return INDEX_NONE;
 	}
 
-	AGX_CHECK(Barrier->HasNative());
-	return Barrier;
+	AGX_CHECK(NativeBarriers[*Found].HasNative());
+	return *Found;
 }
 
 #if WITH_EDITOR
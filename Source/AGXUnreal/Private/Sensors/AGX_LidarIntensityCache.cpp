@@ -0,0 +1,128 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Sensors/AGX_LidarIntensityCache.h"
+
+// AGX Dynamics for Unreal includes.
+#include "Sensors/AGX_LidarLambertianOpaqueMaterial.h"
+#include "Sensors/AGX_SurfaceMaterialAssetUserData.h"
+
+// Unreal Engine includes.
+#include "Components/PrimitiveComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace AGX_LidarIntensityCache_helpers
+{
+	double ReadReflectivity(const UMaterialInterface& Material)
+	{
+		FMaterialParameterInfo Info;
+		Info.Name = TEXT("Roughness");
+		float Roughness;
+		if (!Material.GetScalarParameterValue(Info, Roughness))
+			return 1.0;
+
+		return 1.0 - FMath::Clamp(static_cast<double>(Roughness), 0.0, 1.0);
+	}
+}
+
+FAGX_LidarIntensityCache::~FAGX_LidarIntensityCache()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+#endif
+}
+
+void FAGX_LidarIntensityCache::Init()
+{
+#if WITH_EDITOR
+	if (!ObjectPropertyChangedHandle.IsValid())
+	{
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(
+			this, &FAGX_LidarIntensityCache::OnObjectPropertyChanged);
+	}
+#endif
+}
+
+void FAGX_LidarIntensityCache::Reset()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif
+
+	FWriteScopeLock WriteLock(Lock);
+	Overrides.Empty();
+	Materials.Empty();
+	DynamicMaterials.Empty();
+}
+
+void FAGX_LidarIntensityCache::BeginScan()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Overrides.Reset();
+	DynamicMaterials.Reset();
+}
+
+double FAGX_LidarIntensityCache::GetReflectivity(UPrimitiveComponent& Component)
+{
+	using namespace AGX_LidarIntensityCache_helpers;
+
+	if (const UAGX_LidarLambertianOpaqueMaterial* Override = GetOverride(Component))
+		return FMath::Clamp(static_cast<double>(Override->GetReflectivity()), 0.0, 1.0);
+
+	UMaterialInterface* Material = Component.GetMaterial(0);
+	if (Material == nullptr)
+		return 1.0;
+
+	TMap<TObjectKey<UMaterialInterface>, double>& Cache =
+		Material->IsA<UMaterialInstanceDynamic>() ? DynamicMaterials : Materials;
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const double* Reflectivity = Cache.Find(Material))
+			return *Reflectivity;
+	}
+
+	// Several threads may read the same material at the same time, they all get the same result.
+	const double Reflectivity = ReadReflectivity(*Material);
+	FWriteScopeLock WriteLock(Lock);
+	Cache.Add(Material, Reflectivity);
+	return Reflectivity;
+}
+
+const UAGX_LidarLambertianOpaqueMaterial* FAGX_LidarIntensityCache::GetOverride(
+	UPrimitiveComponent& Component)
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const auto* Override = Overrides.Find(&Component))
+			return Override->Get();
+	}
+
+	const UAGX_LidarLambertianOpaqueMaterial* Override = nullptr;
+	if (auto Data = Cast<UAGX_SurfaceMaterialAssetUserData>(
+			Component.GetAssetUserDataOfClass(UAGX_SurfaceMaterialAssetUserData::StaticClass())))
+	{
+		Override = Cast<UAGX_LidarLambertianOpaqueMaterial>(Data->LidarSurfaceMaterial.Get());
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	Overrides.Add(&Component, Override);
+	return Override;
+}
+
+#if WITH_EDITOR
+void FAGX_LidarIntensityCache::OnObjectPropertyChanged(
+	UObject* Object, FPropertyChangedEvent& Event)
+{
+	if (Cast<UMaterialInterface>(Object) == nullptr)
+		return;
+
+	// A changed parameter is inherited by all material instances further down the hierarchy, so
+	// everything is read again.
+	FWriteScopeLock WriteLock(Lock);
+	Materials.Reset();
+	DynamicMaterials.Reset();
+}
+#endif
@@ -0,0 +1,56 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Sensors/AGX_LidarPointCloudBuffer.h"
+
+namespace AGX_LidarPointCloudBuffer_helpers
+{
+	template <typename PackedType, typename FuncT>
+	void PackValid(
+		const TArray<FAGX_LidarScanPoint>& Points, TArray<PackedType>& OutPacked, FuncT&& Pack)
+	{
+		// Sized for the worst case, all points valid, so the loop below never reallocates.
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+		OutPacked.SetNumUninitialized(Points.Num(), false);
+#else
+		OutPacked.SetNumUninitialized(Points.Num(), EAllowShrinking::No);
+#endif
+		int32 NumValid = 0;
+		for (const FAGX_LidarScanPoint& Point : Points)
+		{
+			if (Point.bIsValid)
+				OutPacked[NumValid++] = Pack(Point);
+		}
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+		OutPacked.SetNum(NumValid, false);
+#else
+		OutPacked.SetNum(NumValid, EAllowShrinking::No);
+#endif
+	}
+}
+
+void FAGX_LidarPointCloudUtilities::Pack(
+	const TArray<FAGX_LidarScanPoint>& Points, TArray<FAGX_LidarPackedPointXYZ>& OutPacked)
+{
+	AGX_LidarPointCloudBuffer_helpers::PackValid(
+		Points, OutPacked,
+		[](const FAGX_LidarScanPoint& P)
+		{
+			return FAGX_LidarPackedPointXYZ {
+				static_cast<float>(P.Position.X), static_cast<float>(P.Position.Y),
+				static_cast<float>(P.Position.Z)};
+		});
+}
+
+void FAGX_LidarPointCloudUtilities::Pack(
+	const TArray<FAGX_LidarScanPoint>& Points, TArray<FAGX_LidarPackedPointXYZI>& OutPacked)
+{
+	AGX_LidarPointCloudBuffer_helpers::PackValid(
+		Points, OutPacked,
+		[](const FAGX_LidarScanPoint& P)
+		{
+			return FAGX_LidarPackedPointXYZI {
+				static_cast<float>(P.Position.X), static_cast<float>(P.Position.Y),
+				static_cast<float>(P.Position.Z), static_cast<float>(P.Intensity)};
+		});
+}
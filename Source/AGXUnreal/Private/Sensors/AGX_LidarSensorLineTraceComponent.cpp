@@ -19,7 +19,7 @@
 #include "Containers/ArrayView.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
-#include "Materials/MaterialInterface.h"
+#include "WorldCollision.h"
 
 // Standard library includes.
 #include <algorithm>
@@ -51,25 +51,15 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 
 	double ApproximateIntensity(
 		const FHitResult& HitResult, const FVector_NetQuantizeNormal& Direction,
-		double BeamExitRadius, double BeamDivergenceRad)
+		double BeamExitRadius, double BeamDivergenceRad, FAGX_LidarIntensityCache& IntensityCache)
 	{
 		// Intensity based on angle of incident.
 		double Intensity = std::max(0.0, -Direction.Dot(HitResult.Normal));
 
-		// Take material Roughness into account.
-		if (HitResult.Component != nullptr)
+		// Take the reflectivity of the surface, e.g. material Roughness, into account.
+		if (UPrimitiveComponent* Component = HitResult.Component.Get())
 		{
-			UMaterialInterface* MaterialInterf = HitResult.Component->GetMaterial(0);
-			if (MaterialInterf != nullptr)
-			{
-				FMaterialParameterInfo Info;
-				Info.Name = TEXT("Roughness");
-				float Roughness;
-				if (MaterialInterf->GetScalarParameterValue(Info, Roughness))
-				{
-					Intensity *= (1.0 - FMath::Clamp(static_cast<double>(Roughness), 0.0, 1.0));
-				}
-			}
+			Intensity *= IntensityCache.GetReflectivity(*Component);
 		}
 
 		// Take beam divergence (drop off over distance) into account.
@@ -113,117 +103,276 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 		EAGX_LidarLineTraceScanPattern ScanPattern {
 			EAGX_LidarLineTraceScanPattern::HorizontalSweep};
 		bool bCalculateIntensity {true};
+		ECollisionChannel TraceChannel {ECC_Visibility};
+		bool bTraceComplex {true};
+		bool bCullAgainstRangeSphere {false};
+
+		// Local frame direction of every ray in the scan cycle, see ComputeRayDirections.
+		TArrayView<const FVector> RayDirections;
+
+		// Must be set if bCalculateIntensity is true.
+		FAGX_LidarIntensityCache* IntensityCache {nullptr};
 	};
 
-	TArrayView<FAGX_LidarScanPoint> PerformPartialScanCPU(
-		UWorld* World, const LidarScanRequestParams& Params, TArray<FAGX_LidarScanPoint>& OutData)
+	std::tuple<int32, int32> GetNumRaysCycle(const FVector2D& FOV, const FVector2D& Resolution)
 	{
-		if (World == nullptr || Params.FractionEnd <= Params.FractionStart || Params.Range <= 0.0)
-			return {};
+		return {
+			static_cast<int32>(FOV.X / Resolution.X), static_cast<int32>(FOV.Y / Resolution.Y)};
+	}
 
-		// The scan pattern implemented below is row-wise linear sweep.
+	/**
+	 * The horizontal and vertical angle [deg] of the given ray in the scan cycle.
+	 */
+	std::tuple<double, double> RayToAngles(
+		int32 Ray, int32 NumRaysCycleX, int32 NumRaysCycleY, const FVector2D& FOV,
+		const FVector2D& Resolution, EAGX_LidarLineTraceScanPattern ScanPattern)
+	{
+		switch (ScanPattern)
+		{
+			case EAGX_LidarLineTraceScanPattern::HorizontalSweep:
+			{
+				const int32 IndexX = Ray / NumRaysCycleY;
+				const int32 IndexY = Ray % NumRaysCycleY;
+				return {
+					-FOV.X / 2.0 + Resolution.X * static_cast<double>(IndexX),
+					-FOV.Y / 2.0 + Resolution.Y * static_cast<double>(IndexY)};
+			}
+			case EAGX_LidarLineTraceScanPattern::VerticalSweep:
+			{
+				const int32 IndexX = Ray % NumRaysCycleX;
+				const int32 IndexY = Ray / NumRaysCycleX;
+				return {
+					-FOV.X / 2.0 + Resolution.X * static_cast<double>(IndexX),
+					-FOV.Y / 2.0 + Resolution.Y * static_cast<double>(IndexY)};
+			}
+		}
+
+		UE_LOG(LogAGX, Warning, TEXT("Unknown Scan Pattern used in Lidar Sensor."));
+		return {0.0, 0.0};
+	}
 
-		const int32 NumRaysCycleX = static_cast<int32>(Params.FOV.X / Params.Resolution.X);
-		const int32 NumRaysCycleY = static_cast<int32>(Params.FOV.Y / Params.Resolution.Y);
+	/**
+	 * Compute the normalized direction, in the local frame of the Lidar Sensor, of every ray in
+	 * the scan cycle, in scan order. The directions only depend on the scan pattern parameters so
+	 * the scans don't need to do any trigonometry.
+	 */
+	void ComputeRayDirections(
+		const FVector2D& FOV, const FVector2D& Resolution,
+		EAGX_LidarLineTraceScanPattern ScanPattern, TArray<FVector>& OutDirections)
+	{
+		OutDirections.Reset();
+		if (Resolution.X <= 0.0 || Resolution.Y <= 0.0)
+			return;
+
+		const auto [NumRaysCycleX, NumRaysCycleY] = GetNumRaysCycle(FOV, Resolution);
 		if (NumRaysCycleX <= 0 || NumRaysCycleY <= 0)
-			return {};
+			return;
+
+		OutDirections.SetNumUninitialized(NumRaysCycleX * NumRaysCycleY);
+		for (int32 Ray = 0; Ray < OutDirections.Num(); ++Ray)
+		{
+			const auto [AngX, AngY] = RayToAngles(
+				Ray, NumRaysCycleX, NumRaysCycleY, FOV, Resolution, ScanPattern);
+			const double AngRadX = FMath::DegreesToRadians(AngX);
+			const double AngRadY = FMath::DegreesToRadians(AngY);
+
+			// Lidar sensors local coordinate system is x forwards, y to the right and z up. The
+			// horizontal angle rotates around z and the vertical angle tilts upwards.
+			OutDirections[Ray] = FVector(
+				FMath::Cos(AngRadX) * FMath::Cos(AngRadY), FMath::Sin(AngRadX) * FMath::Cos(AngRadY),
+				-FMath::Sin(AngRadY));
+		}
+	}
+
+	/**
+	 * The rays of the scan cycle that a partial scan covers.
+	 */
+	struct LidarScanRays
+	{
+		int32 FirstRay {0};
+		int32 NumRays {0};
+		int32 NumRaysCycleX {0};
+		int32 NumRaysCycleY {0};
+		bool bFullWindow {true};
+	};
+
+	bool GetScanRays(const LidarScanRequestParams& Params, LidarScanRays& OutRays)
+	{
+		if (Params.FractionEnd <= Params.FractionStart || Params.Range <= 0.0)
+			return false;
+
+		const auto [NumRaysCycleX, NumRaysCycleY] = GetNumRaysCycle(Params.FOV, Params.Resolution);
+		if (NumRaysCycleX <= 0 || NumRaysCycleY <= 0)
+			return false;
 
 		const int32 NumRaysCycle = NumRaysCycleX * NumRaysCycleY;
+		AGX_CHECK(Params.RayDirections.Num() == NumRaysCycle);
+		if (Params.RayDirections.Num() != NumRaysCycle)
+			return false;
+
 		const double NumRaysCycled = static_cast<double>(NumRaysCycle);
 		const int32 FirstRay =
 			std::max(static_cast<int32>(NumRaysCycled * Params.FractionStart), 0);
 		const int32 LastRay =
 			std::min(FMath::RoundToInt32(NumRaysCycled * Params.FractionEnd), NumRaysCycle - 1);
+		if (LastRay < FirstRay)
+			return false;
+
+		OutRays.FirstRay = FirstRay;
+		OutRays.NumRays = LastRay - FirstRay + 1;
+		OutRays.NumRaysCycleX = NumRaysCycleX;
+		OutRays.NumRaysCycleY = NumRaysCycleY;
+		OutRays.bFullWindow = Params.FOVWindowX.X <= -Params.FOV.X / 2.0 &&
+							  Params.FOVWindowX.Y >= Params.FOV.X / 2.0 &&
+							  Params.FOVWindowY.X <= -Params.FOV.Y / 2.0 &&
+							  Params.FOVWindowY.Y >= Params.FOV.Y / 2.0;
+		return true;
+	}
+
+	bool IsInFOVWindow(int32 Ray, const LidarScanRequestParams& Params, const LidarScanRays& Rays)
+	{
+		if (Rays.bFullWindow)
+			return true;
+
+		const auto [AngX, AngY] = RayToAngles(
+			Ray, Rays.NumRaysCycleX, Rays.NumRaysCycleY, Params.FOV, Params.Resolution,
+			Params.ScanPattern);
+		return AngX >= Params.FOVWindowX.X && AngX <= Params.FOVWindowX.Y &&
+			   AngY >= Params.FOVWindowY.X && AngY <= Params.FOVWindowY.Y;
+	}
+
+	/**
+	 * Bounding spheres of the objects that may block a ray of a scan, found by a single overlap
+	 * query against the sphere with the Lidar range as radius. Rays that don't pass through any of
+	 * the spheres cannot hit anything and need not be traced.
+	 */
+	struct LidarRangeCull
+	{
+		TArray<FSphere> Spheres;
+
+		// False if every ray must be traced, e.g. when culling is disabled or doesn't pay off.
+		bool bCullRays {false};
+
+		bool MayHit(const FVector& Start, const FVector& Direction, double Range) const
+		{
+			if (!bCullRays)
+				return true;
+
+			for (const FSphere& Sphere : Spheres)
+			{
+				const double T = FMath::Clamp((Sphere.Center - Start).Dot(Direction), 0.0, Range);
+				if (FVector::DistSquared(Start + Direction * T, Sphere.Center) <=
+					FMath::Square(Sphere.W))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	void BuildRangeCull(
+		UWorld& World, const LidarScanRequestParams& Params, const FCollisionQueryParams& CollParams,
+		LidarRangeCull& OutCull)
+	{
+		OutCull.Spheres.Reset();
+		OutCull.bCullRays = false;
+		if (!Params.bCullAgainstRangeSphere)
+			return;
+
+		// Testing every ray against many spheres costs more than the traces it saves.
+		static constexpr int32 MaxNumSpheres = 32;
+
+		const FVector Origin = Params.Origin.GetLocation();
+		TArray<FOverlapResult> Overlaps;
+		World.OverlapMultiByChannel(
+			Overlaps, Origin, FQuat::Identity, Params.TraceChannel,
+			FCollisionShape::MakeSphere(Params.Range), CollParams);
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			// Line traces only hit objects that block the channel.
+			const UPrimitiveComponent* Component = Overlap.GetComponent();
+			if (!Overlap.bBlockingHit || Component == nullptr)
+				continue;
+
+			const FSphere Sphere = Component->Bounds.GetSphere();
+			if (Sphere.IsInside(Origin) || OutCull.Spheres.Num() == MaxNumSpheres)
+			{
+				// Rays in every direction may hit something, e.g. the ground the Lidar stands on.
+				OutCull.Spheres.Reset();
+				return;
+			}
+
+			OutCull.Spheres.Add(Sphere);
+		}
+
+		OutCull.bCullRays = true;
+	}
+
+	TArrayView<FAGX_LidarScanPoint> PerformPartialScanCPU(
+		UWorld* World, const LidarScanRequestParams& Params, TArray<FAGX_LidarScanPoint>& OutData)
+	{
+		if (World == nullptr)
+			return {};
+
+		// The scan pattern implemented below is row-wise linear sweep.
+
+		LidarScanRays Rays;
+		if (!GetScanRays(Params, Rays))
+			return {};
 
 		const FVector StartGlobal = Params.Origin.GetLocation();
+		const FQuat RotationGlobal = Params.Origin.GetRotation();
 		const int32 NumPointsPreAppend = OutData.Num();
-		const int32 NumRays = LastRay - FirstRay + 1;
-		if (NumRays <= 0)
-			return {};
 
 		// Make room for the new points.
 #if UE_VERSION_OLDER_THAN(5, 5, 0)
-		OutData.SetNumUninitialized(NumPointsPreAppend + NumRays, false);
+		OutData.SetNumUninitialized(NumPointsPreAppend + Rays.NumRays, false);
 #else
-		OutData.SetNumUninitialized(NumPointsPreAppend + NumRays, EAllowShrinking::No);
+		OutData.SetNumUninitialized(NumPointsPreAppend + Rays.NumRays, EAllowShrinking::No);
 #endif
 
-		// This number is somewhat arbitrary, but a good starting point.
-		// The cost of starting several threads will at some point make single threaded execution
-		// a better option.
-		static constexpr int32 MinRaysForMultithread = 300;
-		const bool RunMultithreaded =
-			FPlatformProcess::SupportsMultithreading() && NumRays >= MinRaysForMultithread;
-		const int32 NumThreads =
-			RunMultithreaded ? FPlatformMisc::NumberOfWorkerThreadsToSpawn() : 1;
-		const int32 NumRaysPerThread = NumRays / NumThreads;
+		// The rays are split into many small tasks, instead of one per worker thread, so that
+		// threads that finish early, e.g. because their rays missed, pick up more work instead of
+		// waiting for the slowest thread. Below this many rays per task the cost of scheduling is
+		// larger than the gain.
+		static constexpr int32 RaysPerTask = 128;
+		const int32 NumTasks = FMath::DivideAndRoundUp(Rays.NumRays, RaysPerTask);
 		FCollisionQueryParams CollParams;
-		CollParams.bTraceComplex = true;
+		CollParams.bTraceComplex = Params.bTraceComplex;
 
-		auto RayToAngles = [&](int32 Ray) -> std::tuple<double, double>
-		{
-			switch (Params.ScanPattern)
-			{
-				case EAGX_LidarLineTraceScanPattern::HorizontalSweep:
-				{
-					const int32 IndexX = Ray / NumRaysCycleY;
-					const int32 IndexY = Ray % NumRaysCycleY;
-					return {
-						-Params.FOV.X / 2.0 + Params.Resolution.X * static_cast<double>(IndexX),
-						-Params.FOV.Y / 2.0 + Params.Resolution.Y * static_cast<double>(IndexY)};
-				}
-				case EAGX_LidarLineTraceScanPattern::VerticalSweep:
-				{
-					const int32 IndexX = Ray % NumRaysCycleX;
-					const int32 IndexY = Ray / NumRaysCycleX;
-					return {
-						-Params.FOV.X / 2.0 + Params.Resolution.X * static_cast<double>(IndexX),
-						-Params.FOV.Y / 2.0 + Params.Resolution.Y * static_cast<double>(IndexY)};
-				}
-			}
+		LidarRangeCull Cull;
+		BuildRangeCull(*World, Params, CollParams, Cull);
 
-			UE_LOG(LogAGX, Warning, TEXT("Unknown Scan Pattern used in Lidar Sensor."));
-			return {0.0, 0.0};
-		};
+		AGX_CHECK(!Params.bCalculateIntensity || Params.IntensityCache != nullptr);
+		const bool bCalculateIntensity =
+			Params.bCalculateIntensity && Params.IntensityCache != nullptr;
+		if (bCalculateIntensity)
+			Params.IntensityCache->BeginScan();
 
-		auto MultiThreadRayCasts = [&](int32 Thread)
+		auto RayCasts = [&](int32 Task)
 		{
-			const int32 ThreadFirstRay = FirstRay + Thread * NumRaysPerThread;
-			int32 ThreadLastRayPlusOne = FirstRay + (Thread + 1) * NumRaysPerThread;
-
-			// The last thread takes any extra rays that couldn't be evenly distributed over all
-			// thread.
-			if (Thread == NumThreads - 1)
-				ThreadLastRayPlusOne = LastRay + 1;
+			const int32 TaskFirstRay = Rays.FirstRay + Task * RaysPerTask;
+			const int32 TaskLastRayPlusOne =
+				std::min(TaskFirstRay + RaysPerTask, Rays.FirstRay + Rays.NumRays);
 
 			FHitResult HitResult;
-			for (int32 Ray = ThreadFirstRay; Ray < ThreadLastRayPlusOne; Ray++)
+			for (int32 Ray = TaskFirstRay; Ray < TaskLastRayPlusOne; Ray++)
 			{
-				const int32 OutDataIndex = Ray - FirstRay + NumPointsPreAppend;
-				const auto [AngX, AngY] = RayToAngles(Ray);
-				if (AngX < Params.FOVWindowX.X || AngX > Params.FOVWindowX.Y ||
-					AngY < Params.FOVWindowY.X || AngY > Params.FOVWindowY.Y)
+				const int32 OutDataIndex = Ray - Rays.FirstRay + NumPointsPreAppend;
+				if (!IsInFOVWindow(Ray, Params, Rays))
 				{
 					// Outside the FOVWindow, no need to scan this direction.
 					OutData[OutDataIndex] = FAGX_LidarScanPoint(false);
 					continue;
 				}
 
-				const double AngRadX = FMath::DegreesToRadians(AngX);
-				const double AngRadY = FMath::DegreesToRadians(AngY);
-
-				// Dir is the normalized vector following the current laser ray. Here X is
-				// horizontal and Y vertical.
-				const FVector Dir(
-					FMath::Sin(AngRadX) * FMath::Cos(AngRadY), FMath::Sin(AngRadY),
-					FMath::Cos(AngRadX) * FMath::Cos(AngRadY));
-
-				// Lidar sensors local coordinate system is x forwards, y to the right and z up.
-				const FVector EndLocal(
-					Dir.Z * Params.Range, Dir.X * Params.Range, -Dir.Y * Params.Range);
-				const FVector EndGlobal = Params.Origin.TransformPositionNoScale(EndLocal);
-				if (!World->LineTraceSingleByChannel(
-						HitResult, StartGlobal, EndGlobal, ECC_Visibility, CollParams))
+				const FVector DirGlobal = RotationGlobal.RotateVector(Params.RayDirections[Ray]);
+				const FVector EndGlobal = StartGlobal + DirGlobal * Params.Range;
+				if (!Cull.MayHit(StartGlobal, DirGlobal, Params.Range) ||
+					!World->LineTraceSingleByChannel(
+						HitResult, StartGlobal, EndGlobal, Params.TraceChannel, CollParams))
 				{
 					// Line trace miss.
 					OutData[OutDataIndex] = FAGX_LidarScanPoint(false);
@@ -233,12 +382,11 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 				const FVector LocalPoint =
 					Params.Origin.InverseTransformPositionNoScale(HitResult.Location);
 				double Intensity = 0.0;
-				if (Params.bCalculateIntensity)
+				if (bCalculateIntensity)
 				{
-					const FVector_NetQuantizeNormal DirGlobal(
-						(EndGlobal - StartGlobal).GetSafeNormal());
 					Intensity = ApproximateIntensity(
-						HitResult, DirGlobal, Params.BeamExitRadius, Params.BeamDivergenceRad);
+						HitResult, FVector_NetQuantizeNormal(DirGlobal), Params.BeamExitRadius,
+						Params.BeamDivergenceRad, *Params.IntensityCache);
 				}
 				OutData[OutDataIndex] = FAGX_LidarScanPoint(
 					FVector(LocalPoint.X, LocalPoint.Y, LocalPoint.Z), Params.TimeStamp, Intensity,
@@ -246,8 +394,63 @@ namespace AGX_LidarSensorLineTraceComponent_helpers
 			}
 		};
 
-		ParallelFor(NumThreads, MultiThreadRayCasts);
-		return MakeArrayView(&OutData[NumPointsPreAppend], NumRays);
+		ParallelFor(
+			NumTasks, RayCasts,
+			NumTasks < 2 || !FPlatformProcess::SupportsMultithreading()
+				? EParallelForFlags::ForceSingleThread
+				: EParallelForFlags::None);
+		return MakeArrayView(&OutData[NumPointsPreAppend], Rays.NumRays);
+	}
+
+	/**
+	 * Submit the line traces of a partial scan to the engine's asynchronous trace pipeline, with
+	 * the index of the ray's point in OutPoints as user data. Rays that are not traced get an
+	 * invalid point right away.
+	 *
+	 * Returns the number of line traces submitted, Delegate is executed once for each of them.
+	 */
+	int32 SubmitPartialScanAsync(
+		UWorld* World, const LidarScanRequestParams& Params, const FTraceDelegate& Delegate,
+		TArray<FAGX_LidarScanPoint>& OutPoints)
+	{
+		OutPoints.Reset();
+		if (World == nullptr)
+			return 0;
+
+		LidarScanRays Rays;
+		if (!GetScanRays(Params, Rays))
+			return 0;
+
+		FCollisionQueryParams CollParams;
+		CollParams.bTraceComplex = Params.bTraceComplex;
+
+		LidarRangeCull Cull;
+		BuildRangeCull(*World, Params, CollParams, Cull);
+
+		if (Params.bCalculateIntensity && Params.IntensityCache != nullptr)
+			Params.IntensityCache->BeginScan();
+
+		const FVector StartGlobal = Params.Origin.GetLocation();
+		const FQuat RotationGlobal = Params.Origin.GetRotation();
+		OutPoints.Init(FAGX_LidarScanPoint(false), Rays.NumRays);
+		int32 NumSubmitted = 0;
+		for (int32 Ray = Rays.FirstRay; Ray < Rays.FirstRay + Rays.NumRays; Ray++)
+		{
+			if (!IsInFOVWindow(Ray, Params, Rays))
+				continue;
+
+			const FVector DirGlobal = RotationGlobal.RotateVector(Params.RayDirections[Ray]);
+			if (!Cull.MayHit(StartGlobal, DirGlobal, Params.Range))
+				continue;
+
+			World->AsyncLineTraceByChannel(
+				EAsyncTraceType::Single, StartGlobal, StartGlobal + DirGlobal * Params.Range,
+				Params.TraceChannel, CollParams, FCollisionResponseParams::DefaultResponseParam,
+				&Delegate, static_cast<uint32>(Ray - Rays.FirstRay));
+			++NumSubmitted;
+		}
+
+		return NumSubmitted;
 	}
 }
 
@@ -291,10 +494,15 @@ void UAGX_LidarSensorLineTraceComponent::RequestManualScan(
 		Params.BeamDivergenceRad = FMath::DegreesToRadians(BeamDivergence);
 		Params.ScanPattern = ScanPattern;
 		Params.bCalculateIntensity = bCalculateIntensity;
+		Params.TraceChannel = TraceChannel;
+		Params.bTraceComplex = bTraceComplex;
+		Params.bCullAgainstRangeSphere = bCullAgainstRangeSphere;
+		Params.RayDirections = GetRayDirections();
+		Params.IntensityCache = &IntensityCache;
 	}
 
-	AGX_CHECK(Buffer.Num() == 0);
-	auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer);
+	AGX_CHECK(Buffer.IsValid() && Buffer->Data.Num() == 0);
+	auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer->Data);
 
 	if (bDebugRenderPoints)
 	{
@@ -303,13 +511,7 @@ void UAGX_LidarSensorLineTraceComponent::RequestManualScan(
 			DebugDrawPointLifetime);
 	}
 
-	PointCloudDataOutput.Broadcast(Buffer);
-
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
-	Buffer.SetNum(0, false);
-#else
-	Buffer.SetNum(0, EAllowShrinking::No);
-#endif
+	OutputBuffer();
 }
 
 void UAGX_LidarSensorLineTraceComponent::BeginPlay()
@@ -323,6 +525,11 @@ void UAGX_LidarSensorLineTraceComponent::BeginPlay()
 	LidarState.ScanCycleDuration = 1.0 / ScanFrequency;
 	LidarState.OutputCycleDuration = 1.0 / OutputFrequency;
 
+	// Build the ray direction table up front instead of during the first scan.
+	GetRayDirections();
+	IntensityCache.Init();
+	InitBufferPools();
+
 	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
 	{
 		PostStepForwardHandle =
@@ -335,6 +542,16 @@ void UAGX_LidarSensorLineTraceComponent::EndPlay(const EEndPlayReason::Type Reas
 {
 	Super::EndPlay(Reason);
 	PointCloudDataOutput.Clear();
+	IntensityCache.Reset();
+
+	// Line traces still in flight find no scan to write to and are ignored.
+	AsyncScans.Empty();
+
+	// Buffers kept by subscribers are deleted, instead of returned, when released.
+	Buffer.SafeRelease();
+	ScanPointPool.Reset();
+	PackedXYZPool.Reset();
+	PackedXYZIPool.Reset();
 
 	if (Reason != EEndPlayReason::EndPlayInEditor && Reason != EEndPlayReason::Quit &&
 		Reason != EEndPlayReason::LevelTransition)
@@ -365,6 +582,7 @@ bool UAGX_LidarSensorLineTraceComponent::CanEditChange(const FProperty* InProper
 		// List of names of properties that does not support editing after initialization.
 		static const TArray<FName> PropertiesNotEditableDuringPlay = {
 			GET_MEMBER_NAME_CHECKED(ThisClass, ExecutionMode),
+			GET_MEMBER_NAME_CHECKED(ThisClass, QueryMode),
 			GET_MEMBER_NAME_CHECKED(ThisClass, ScanFrequency),
 			GET_MEMBER_NAME_CHECKED(ThisClass, OutputFrequency),
 			GET_MEMBER_NAME_CHECKED(ThisClass, FOV /*clang-format padding*/),
@@ -381,6 +599,83 @@ bool UAGX_LidarSensorLineTraceComponent::CanEditChange(const FProperty* InProper
 }
 #endif
 
+void UAGX_LidarSensorLineTraceComponent::InitBufferPools()
+{
+	const int32 NumRaysCycle = GetRayDirections().Num();
+
+	// In Auto mode an output holds the rays of ScanFrequency / OutputFrequency scan cycles, give or
+	// take the rays of one step. Size classes up to twice the scan cycle leave room for that.
+	NumPointsPerOutput = ExecutionMode == EAGX_LidarLineTraceExecutonMode::Auto
+							 ? FMath::CeilToInt32(NumRaysCycle * ScanFrequency / OutputFrequency)
+							 : NumRaysCycle;
+
+	ScanPointPool = MakeShared<FAGX_LidarScanPointBufferPool, ESPMode::ThreadSafe>();
+	ScanPointPool->Configure(2 * NumRaysCycle);
+	PackedXYZPool = MakeShared<FAGX_LidarPackedXYZBufferPool, ESPMode::ThreadSafe>();
+	PackedXYZPool->Configure(2 * NumRaysCycle);
+	PackedXYZIPool = MakeShared<FAGX_LidarPackedXYZIBufferPool, ESPMode::ThreadSafe>();
+	PackedXYZIPool->Configure(2 * NumRaysCycle);
+
+	// When the pools are replaced during play the buffer being filled is kept, it goes back to its
+	// old pool once output.
+	if (!Buffer.IsValid())
+		Buffer = ScanPointPool->Acquire(NumPointsPerOutput);
+}
+
+void UAGX_LidarSensorLineTraceComponent::OutputBuffer()
+{
+	Buffer->TimeStamp = LidarState.ElapsedTime;
+	PointCloudDataOutput.Broadcast(Buffer->Data);
+	if (PointCloudBufferOutput.IsBound())
+	{
+		PointCloudBufferOutput.Broadcast(
+			TRefCountPtr<const FAGX_LidarScanPointBuffer>(Buffer.GetReference()));
+	}
+
+	if (PackedXYZOutput.IsBound())
+	{
+		TRefCountPtr<FAGX_LidarPackedXYZBuffer> Packed = PackedXYZPool->Acquire(Buffer->Data.Num());
+		FAGX_LidarPointCloudUtilities::Pack(Buffer->Data, Packed->Data);
+		Packed->TimeStamp = Buffer->TimeStamp;
+		PackedXYZOutput.Broadcast(
+			TRefCountPtr<const FAGX_LidarPackedXYZBuffer>(Packed.GetReference()));
+	}
+
+	if (PackedXYZIOutput.IsBound())
+	{
+		TRefCountPtr<FAGX_LidarPackedXYZIBuffer> Packed =
+			PackedXYZIPool->Acquire(Buffer->Data.Num());
+		FAGX_LidarPointCloudUtilities::Pack(Buffer->Data, Packed->Data);
+		Packed->TimeStamp = Buffer->TimeStamp;
+		PackedXYZIOutput.Broadcast(
+			TRefCountPtr<const FAGX_LidarPackedXYZIBuffer>(Packed.GetReference()));
+	}
+
+	// Subscribers may have kept the buffer, so the next points go into another one. If none did,
+	// the buffer goes back to the pool and is handed right back.
+	Buffer.SafeRelease();
+	Buffer = ScanPointPool->Acquire(NumPointsPerOutput);
+}
+
+TArrayView<const FVector> UAGX_LidarSensorLineTraceComponent::GetRayDirections()
+{
+	using namespace AGX_LidarSensorLineTraceComponent_helpers;
+	if (RayTable.FOV != FOV || RayTable.Resolution != Resolution ||
+		RayTable.ScanPattern != ScanPattern)
+	{
+		ComputeRayDirections(FOV, Resolution, ScanPattern, RayTable.Directions);
+		RayTable.FOV = FOV;
+		RayTable.Resolution = Resolution;
+		RayTable.ScanPattern = ScanPattern;
+
+		// The buffer pools are sized for the number of rays in a scan cycle, so a change of FOV
+		// or Resolution during play, e.g. from C++, must resize them.
+		if (ScanPointPool.IsValid())
+			InitBufferPools();
+	}
+	return RayTable.Directions;
+}
+
 bool UAGX_LidarSensorLineTraceComponent::CheckValid() const
 {
 	if (ScanFrequency <= 0.0 || OutputFrequency <= 0.0)
@@ -477,14 +772,38 @@ void UAGX_LidarSensorLineTraceComponent::ScanAutoCPU()
 		Params.BeamDivergenceRad = FMath::DegreesToRadians(BeamDivergence);
 		Params.ScanPattern = ScanPattern;
 		Params.bCalculateIntensity = bCalculateIntensity;
+		Params.TraceChannel = TraceChannel;
+		Params.bTraceComplex = bTraceComplex;
+		Params.bCullAgainstRangeSphere = bCullAgainstRangeSphere;
+		Params.RayDirections = GetRayDirections();
+		Params.IntensityCache = &IntensityCache;
 	}
 
-	auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer);
-	if (bDebugRenderPoints)
+	if (QueryMode == EAGX_LidarLineTraceQueryMode::Asynchronous)
 	{
-		DrawDebugPoints(
-			NewPoints, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
-			DebugDrawPointLifetime);
+		FAGX_LidarAsyncScan& Scan = AsyncScans.AddDefaulted_GetRef();
+		Scan.Id = NextAsyncScanId++;
+		Scan.Origin = Params.Origin;
+		Scan.TimeStamp = Params.TimeStamp;
+		Scan.BeamExitRadius = Params.BeamExitRadius;
+		Scan.BeamDivergenceRad = Params.BeamDivergenceRad;
+		Scan.bCalculateIntensity = Params.bCalculateIntensity;
+		const FTraceDelegate Delegate = FTraceDelegate::CreateUObject(
+			this, &UAGX_LidarSensorLineTraceComponent::OnAsyncTraceDone, Scan.Id);
+		Scan.Points = ScanPointPool->Acquire(GetRayDirections().Num());
+		Scan.NumPending = SubmitPartialScanAsync(GetWorld(), Params, Delegate, Scan.Points->Data);
+		if (Scan.NumPending == 0)
+			FlushAsyncScans();
+	}
+	else
+	{
+		auto NewPoints = PerformPartialScanCPU(GetWorld(), Params, Buffer->Data);
+		if (bDebugRenderPoints)
+		{
+			DrawDebugPoints(
+				NewPoints, GetWorld(), GetComponentTransform(), DebugDrawPointSize,
+				DebugDrawPointLifetime);
+		}
 	}
 
 	if (ScanCycleFraction >= 1.0)
@@ -494,6 +813,59 @@ void UAGX_LidarSensorLineTraceComponent::ScanAutoCPU()
 	}
 }
 
+void UAGX_LidarSensorLineTraceComponent::OnAsyncTraceDone(
+	const FTraceHandle& Handle, FTraceDatum& Datum, uint32 ScanId)
+{
+	using namespace AGX_LidarSensorLineTraceComponent_helpers;
+	FAGX_LidarAsyncScan* Scan = AsyncScans.FindByPredicate(
+		[ScanId](const FAGX_LidarAsyncScan& S) { return S.Id == ScanId; });
+	if (Scan == nullptr)
+		return; // The scan was discarded by EndPlay.
+
+	TArray<FAGX_LidarScanPoint>& Points = Scan->Points->Data;
+	const int32 Index = static_cast<int32>(Datum.UserData);
+	AGX_CHECK(Points.IsValidIndex(Index));
+	AGX_CHECK(Scan->NumPending > 0);
+	if (!Points.IsValidIndex(Index) || Scan->NumPending <= 0)
+		return;
+
+	if (const FHitResult* HitResult = FHitResult::GetFirstBlockingHit(Datum.OutHits))
+	{
+		const FVector DirGlobal = (Datum.End - Datum.Start).GetSafeNormal();
+		const FVector LocalPoint = Scan->Origin.InverseTransformPositionNoScale(HitResult->Location);
+		double Intensity = 0.0;
+		if (Scan->bCalculateIntensity)
+		{
+			Intensity = ApproximateIntensity(
+				*HitResult, FVector_NetQuantizeNormal(DirGlobal), Scan->BeamExitRadius,
+				Scan->BeamDivergenceRad, IntensityCache);
+		}
+		Points[Index] = FAGX_LidarScanPoint(LocalPoint, Scan->TimeStamp, Intensity, true);
+	}
+
+	if (--Scan->NumPending == 0)
+		FlushAsyncScans();
+}
+
+void UAGX_LidarSensorLineTraceComponent::FlushAsyncScans()
+{
+	using namespace AGX_LidarSensorLineTraceComponent_helpers;
+	int32 NumFlushed = 0;
+	for (; NumFlushed < AsyncScans.Num() && AsyncScans[NumFlushed].NumPending == 0; ++NumFlushed)
+	{
+		FAGX_LidarAsyncScan& Scan = AsyncScans[NumFlushed];
+		if (bDebugRenderPoints)
+		{
+			DrawDebugPoints(
+				Scan.Points->Data, GetWorld(), Scan.Origin, DebugDrawPointSize,
+				DebugDrawPointLifetime);
+		}
+		Buffer->Data.Append(Scan.Points->Data);
+	}
+
+	AsyncScans.RemoveAt(0, NumFlushed);
+}
+
 void UAGX_LidarSensorLineTraceComponent::OutputPointCloudDataIfReady()
 {
 	AGX_CHECK(bIsValid);
@@ -503,12 +875,7 @@ void UAGX_LidarSensorLineTraceComponent::OutputPointCloudDataIfReady()
 
 	if (OutputCycleTimeElapsed >= LidarState.OutputCycleDuration)
 	{
-		PointCloudDataOutput.Broadcast(Buffer);
-#if UE_VERSION_OLDER_THAN(5, 5, 0)
-		Buffer.SetNum(0, false);
-#else
-		Buffer.SetNum(0, EAllowShrinking::No);
-#endif
+		OutputBuffer();
 		LidarState.CurrentOutputCycleStartTime = LidarState.ElapsedTime;
 	}
 }
@@ -143,7 +143,8 @@ namespace AGX_SensorEnvironment_helpers
 		}
 
 		const float Radius = std::min(Lidar->Range.Max.GetValue(), MaxRadius);
-		if (!FMath::IsNearlyEqual(Sphere->GetUnscaledSphereRadius(), Radius))
+		const bool bRadiusChanged = !FMath::IsNearlyEqual(Sphere->GetUnscaledSphereRadius(), Radius);
+		if (bRadiusChanged)
 		{
 			Sphere->SetSphereRadius(Radius, /*bUpdateOverlaps*/ false);
 		}
@@ -153,28 +154,138 @@ namespace AGX_SensorEnvironment_helpers
 
 		Sphere->SetWorldLocation(TargetLocation); // Updates overlaps if moved.
 
-		// Update overlaps when location hasn't changed.
-		if (CurrentLocation.Equals(TargetLocation, SMALL_NUMBER))
+		// Objects that move into or out of a still sphere update their overlaps themselves, so the
+		// overlaps only need an explicit update when the radius changed without the sphere moving.
+		if (bRadiusChanged && CurrentLocation.Equals(TargetLocation, SMALL_NUMBER))
 			Sphere->UpdateOverlaps();
 	}
 
-	template <typename InMapType>
-	void UpdateTrackedMeshes(InMapType& MeshToInstance)
+	template <typename InComponentType, typename InDataType>
+	void UpdateTrackedMeshes(
+		TMap<TWeakObjectPtr<InComponentType>, InDataType>& MeshToInstance,
+		const TSet<TWeakObjectPtr<USceneComponent>>& MovedComponents)
 	{
-		// Update tracked static meshes and remove any invalid ones.
+		// Remove any invalid tracked meshes.
 		for (auto It = MeshToInstance.CreateIterator(); It; ++It)
 		{
 			if (!IsValid(It->Key.Get()))
-			{
 				It.RemoveCurrent();
+		}
+
+		// Only the meshes that have reported a transform update can have moved.
+		for (const TWeakObjectPtr<USceneComponent>& Moved : MovedComponents)
+		{
+			InComponentType* Mesh = Cast<InComponentType>(Moved.Get());
+			if (Mesh == nullptr)
+				continue;
+
+			InDataType* Data = MeshToInstance.Find(Mesh);
+			if (Data == nullptr)
+				continue;
+
+			const FTransform& CompTransform = Mesh->GetComponentTransform();
+			if (CompTransform.Equals(Data->InstanceData.Transform))
 				continue;
+
+			Data->InstanceData.SetTransform(CompTransform);
+		}
+	}
+
+	/**
+	 * Stop tracking the given mesh, if tracked, and unbind from its transform updates.
+	 */
+	template <typename InComponentType, typename InDataType>
+	bool RemoveTrackedMesh(
+		TMap<TWeakObjectPtr<InComponentType>, InDataType>& MeshToInstance, InComponentType* Mesh)
+	{
+		InDataType* Data = MeshToInstance.Find(Mesh);
+		if (Data == nullptr)
+			return false;
+
+		if (IsValid(Mesh))
+			Mesh->TransformUpdated.Remove(Data->TransformUpdatedHandle);
+
+		MeshToInstance.Remove(Mesh);
+		return true;
+	}
+
+	/**
+	 * Keep the tracked instances in sync with the instance indices of an Instanced Static Mesh
+	 * Component when instances are removed or moved to another index.
+	 */
+	void ApplyInstanceIndexUpdates(
+		FAGX_RtInstancedShapeInstanceData& InstancedShape,
+		TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> Updates)
+	{
+		using EUpdateType = FInstancedStaticMeshDelegates::FInstanceIndexUpdateData::EUpdateType;
+		TMap<int32, FAGX_RtInstanceData>& Instances = InstancedShape.InstancesData;
+		for (const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData& Update : Updates)
+		{
+			switch (Update.Type)
+			{
+				case EUpdateType::Added:
+					// New instances are added by the overlap events, if in range of a Lidar. See
+					// FindSpheresWithAddedInstances.
+					break;
+				case EUpdateType::Removed:
+					Instances.Remove(Update.Index);
+					break;
+				case EUpdateType::Relocated:
+				{
+					FAGX_RtInstanceData* Old = Instances.Find(Update.OldIndex);
+					if (Old == nullptr)
+						break;
+
+					FAGX_RtInstanceData Relocated(MoveTemp(*Old));
+					Instances.Remove(Update.OldIndex);
+					Instances.Remove(Update.Index);
+					Instances.Add(Update.Index, MoveTemp(Relocated));
+					break;
+				}
+				case EUpdateType::Cleared:
+				case EUpdateType::Destroyed:
+					Instances.Empty();
+					break;
 			}
+		}
+	}
+
+	/**
+	 * Find the Lidar collision spheres that the bounds of any instance added to an Instanced Static
+	 * Mesh Component is within. Adding an instance doesn't generate overlap events, so the found
+	 * spheres must update their overlaps for the instance to be added to the Sensor Environment.
+	 */
+	void FindSpheresWithAddedInstances(
+		const UInstancedStaticMeshComponent& Mesh,
+		TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> Updates,
+		const TMap<FAGX_LidarSensorReference, TObjectPtr<USphereComponent>>& Lidars,
+		TSet<TWeakObjectPtr<USphereComponent>>& OutSpheres)
+	{
+		using EUpdateType = FInstancedStaticMeshDelegates::FInstanceIndexUpdateData::EUpdateType;
+		if (!Mesh.GetGenerateOverlapEvents() || Mesh.GetStaticMesh() == nullptr)
+			return;
 
-			const FTransform& CompTransform = It->Key->GetComponentTransform();
-			if (CompTransform.Equals(It->Value.InstanceData.Transform))
+		const FBoxSphereBounds MeshBounds = Mesh.GetStaticMesh()->GetBounds();
+		for (const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData& Update : Updates)
+		{
+			if (Update.Type != EUpdateType::Added || !Mesh.IsValidInstance(Update.Index))
 				continue;
 
-			It->Value.InstanceData.SetTransform(CompTransform);
+			FTransform InstanceTransform;
+			Mesh.GetInstanceTransform(Update.Index, InstanceTransform, true);
+			const FVector Center = InstanceTransform.TransformPosition(MeshBounds.Origin);
+			const double Radius =
+				MeshBounds.SphereRadius * InstanceTransform.GetScale3D().GetAbsMax();
+			for (const auto& Lidar : Lidars)
+			{
+				USphereComponent* Sphere = Lidar.Value.Get();
+				if (Sphere == nullptr)
+					continue;
+
+				const double Reach = Sphere->GetScaledSphereRadius() + Radius;
+				if (FVector::DistSquared(Center, Sphere->GetComponentLocation()) <= Reach * Reach)
+					OutSpheres.Add(Sphere);
+			}
 		}
 	}
 
@@ -494,7 +605,8 @@ bool AAGX_SensorEnvironment::AddMesh(
 	if (!ShapeInstance.IsSet())
 		return false;
 
-	TrackedMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	FAGX_RtShapeInstanceData& Data = TrackedMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	TrackTransformUpdates(*Mesh, Data.TransformUpdatedHandle);
 	return true;
 }
 
@@ -521,7 +633,9 @@ bool AAGX_SensorEnvironment::AddMesh(
 	if (!ShapeInstance.IsSet())
 		return false;
 
-	TrackedAGXMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	FAGX_RtShapeInstanceData& Data =
+		TrackedAGXMeshes.Add(Mesh, std::move(ShapeInstance.GetValue()));
+	TrackTransformUpdates(*Mesh, Data.TransformUpdatedHandle);
 	return true;
 }
 
@@ -540,7 +654,9 @@ bool AAGX_SensorEnvironment::AddInstancedMesh(
 	if (!InstancedShapeInstance.Shape.AllocateNative(Vertices, Indices))
 		return false;
 
-	TrackedInstancedMeshes.Add(Mesh, std::move(InstancedShapeInstance));
+	FAGX_RtInstancedShapeInstanceData& Data =
+		TrackedInstancedMeshes.Add(Mesh, std::move(InstancedShapeInstance));
+	TrackTransformUpdates(*Mesh, Data.TransformUpdatedHandle);
 	return true;
 }
 
@@ -773,16 +889,15 @@ bool AAGX_SensorEnvironment::RemoveMesh(UStaticMeshComponent* Mesh)
 	if (Mesh == nullptr)
 		return false;
 
-	return TrackedMeshes.Remove(Mesh) > 0;
+	return AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedMeshes, Mesh);
 }
 
 bool AAGX_SensorEnvironment::RemoveInstancedMesh(UInstancedStaticMeshComponent* Mesh)
 {
-	if (Mesh == nullptr || !TrackedInstancedMeshes.Contains(Mesh))
+	if (Mesh == nullptr)
 		return false;
 
-	TrackedInstancedMeshes.Remove(Mesh);
-	return true;
+	return AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedInstancedMeshes, Mesh);
 }
 
 bool AAGX_SensorEnvironment::RemoveInstancedMeshInstance(
@@ -885,14 +1000,18 @@ void AAGX_SensorEnvironment::Tick(float DeltaSeconds)
 	if (!HasNative())
 		return;
 
+	// Adding, moving and removing sensor objects modifies the native Sensor Environment, which
+	// is updated as part of the Simulation step.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
+
 	UpdateTrackedLidars();
 	UpdateTrackedIMUs();
 	UpdateTrackedMeshes();
-
-	if (UpdateAddedInstancedMeshesTransforms)
-		UpdateTrackedInstancedMeshes();
-
+	UpdateTrackedInstancedMeshes();
 	UpdateTrackedAGXMeshes();
+	MovedComponents.Reset();
+
 	TickTrackedLidars();
 	TickTrackedIMUs();
 }
@@ -921,6 +1040,27 @@ void AAGX_SensorEnvironment::BeginPlay()
 
 	RegisterIMUs();
 
+	InstanceIndexUpdatedHandle = FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.AddWeakLambda(
+		this,
+		[this](
+			UInstancedStaticMeshComponent* Mesh,
+			TArrayView<const FInstancedStaticMeshDelegates::FInstanceIndexUpdateData> Updates)
+		{
+			if (bAutoAddObjects && Mesh != nullptr)
+			{
+				AGX_SensorEnvironment_helpers::FindSpheresWithAddedInstances(
+					*Mesh, Updates, TrackedLidars, SpheresWithAddedInstances);
+			}
+
+			FAGX_RtInstancedShapeInstanceData* InstancedShape = TrackedInstancedMeshes.Find(Mesh);
+			if (InstancedShape == nullptr)
+				return;
+
+			AGX_SensorEnvironment_helpers::ApplyInstanceIndexUpdates(*InstancedShape, Updates);
+			if (InstancedShape->InstancesData.Num() == 0)
+				RemoveInstancedMesh(Mesh);
+		});
+
 	if (bAutoAddObjects)
 	{
 		// Add Terrains.
@@ -948,11 +1088,26 @@ void AAGX_SensorEnvironment::EndPlay(const EEndPlayReason::Type Reason)
 {
 	Super::EndPlay(Reason);
 
+	FInstancedStaticMeshDelegates::OnInstanceIndexUpdated.Remove(InstanceIndexUpdatedHandle);
+	auto UnbindTransformUpdated = [](auto& MeshToInstance)
+	{
+		for (auto& It : MeshToInstance)
+		{
+			if (IsValid(It.Key.Get()))
+				It.Key->TransformUpdated.Remove(It.Value.TransformUpdatedHandle);
+		}
+	};
+	UnbindTransformUpdated(TrackedMeshes);
+	UnbindTransformUpdated(TrackedInstancedMeshes);
+	UnbindTransformUpdated(TrackedAGXMeshes);
+
 	TrackedIMUs.Empty();
 	TrackedLidars.Empty();
 	TrackedMeshes.Empty();
 	TrackedInstancedMeshes.Empty();
 	TrackedAGXMeshes.Empty();
+	MovedComponents.Empty();
+	SpheresWithAddedInstances.Empty();
 
 	if (AmbientMaterial != nullptr && AmbientMaterial->HasNative())
 		AmbientMaterial->ReleaseNative();
@@ -1155,6 +1310,15 @@ void AAGX_SensorEnvironment::UpdateTrackedLidars()
 			AGX_SensorEnvironment_helpers::UpdateCollisionSphere(
 				It->Key.GetLidarComponent(), It->Value.Get());
 	}
+
+	// Done here instead of when the instances are added since the instance bodies, that the
+	// overlap test is done against, may not have been created yet at that point.
+	for (const TWeakObjectPtr<USphereComponent>& Sphere : SpheresWithAddedInstances)
+	{
+		if (Sphere.IsValid())
+			Sphere->UpdateOverlaps();
+	}
+	SpheresWithAddedInstances.Reset();
 }
 
 void AAGX_SensorEnvironment::UpdateTrackedIMUs()
@@ -1170,30 +1334,38 @@ void AAGX_SensorEnvironment::UpdateTrackedIMUs()
 
 void AAGX_SensorEnvironment::UpdateTrackedMeshes()
 {
-	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedMeshes);
+	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedMeshes, MovedComponents);
 }
 
 void AAGX_SensorEnvironment::UpdateTrackedInstancedMeshes()
 {
 	for (auto It = TrackedInstancedMeshes.CreateIterator(); It; ++It)
 	{
-		if (!IsValid(It->Key.Get()))
+		UInstancedStaticMeshComponent* Mesh = It->Key.Get();
+		if (!IsValid(Mesh))
 		{
 			It.RemoveCurrent();
 			continue;
 		}
 
-		// Instance.
+		// Instances of Static Components never move. Instances of other Components are only
+		// polled if requested, but all of them are updated when the Component itself has moved.
+		// Removed and relocated instances are handled by the instance index update events.
+		const bool bPollInstances = UpdateAddedInstancedMeshesTransforms &&
+									Mesh->Mobility != EComponentMobility::Static;
+		if (!bPollInstances && !MovedComponents.Contains(Mesh))
+			continue;
+
 		for (auto Ite = It->Value.InstancesData.CreateIterator(); Ite; ++Ite)
 		{
-			if (!It->Key->IsValidInstance(Ite->Key))
+			if (!Mesh->IsValidInstance(Ite->Key))
 			{
 				Ite.RemoveCurrent();
 				continue;
 			}
 
 			FTransform InstanceTransform;
-			It->Key->GetInstanceTransform(Ite->Key, InstanceTransform, true);
+			Mesh->GetInstanceTransform(Ite->Key, InstanceTransform, true);
 			if (InstanceTransform.Equals(Ite->Value.Transform))
 				continue;
 
@@ -1204,7 +1376,23 @@ void AAGX_SensorEnvironment::UpdateTrackedInstancedMeshes()
 
 void AAGX_SensorEnvironment::UpdateTrackedAGXMeshes()
 {
-	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedAGXMeshes);
+	AGX_SensorEnvironment_helpers::UpdateTrackedMeshes(TrackedAGXMeshes, MovedComponents);
+}
+
+void AAGX_SensorEnvironment::TrackTransformUpdates(
+	USceneComponent& Component, FDelegateHandle& OutHandle)
+{
+	// Bound also for Static Components. They don't report any transform updates while Static, but
+	// their Mobility may be changed during Play and then they must be tracked from that point on.
+	OutHandle = Component.TransformUpdated.AddUObject(
+		this, &AAGX_SensorEnvironment::OnTrackedComponentTransformUpdated);
+}
+
+void AAGX_SensorEnvironment::OnTrackedComponentTransformUpdated(
+	USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport)
+{
+	// Components may move several times per frame, the new transform is read in the next Tick.
+	MovedComponents.Add(Component);
 }
 
 bool AAGX_SensorEnvironment::UpdateAmbientMaterial()
@@ -1361,7 +1549,7 @@ void AAGX_SensorEnvironment::OnLidarEndOverlapStaticMeshComponent(UStaticMeshCom
 	AGX_CHECK(ShapeInstanceData->InstanceData.RefCount > 0);
 	ShapeInstanceData->InstanceData.RefCount--;
 	if (ShapeInstanceData->InstanceData.RefCount == 0)
-		TrackedMeshes.Remove(&Mesh);
+		AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedMeshes, &Mesh);
 }
 
 void AAGX_SensorEnvironment::OnLidarEndOverlapInstancedStaticMeshComponent(
@@ -1398,7 +1586,7 @@ void AAGX_SensorEnvironment::OnLidarEndOverlapAGXMeshComponent(UAGX_SimpleMeshCo
 	AGX_CHECK(ShapeInstanceData->InstanceData.RefCount > 0);
 	ShapeInstanceData->InstanceData.RefCount--;
 	if (ShapeInstanceData->InstanceData.RefCount == 0)
-		TrackedAGXMeshes.Remove(&Mesh);
+		AGX_SensorEnvironment_helpers::RemoveTrackedMesh(TrackedAGXMeshes, &Mesh);
 }
 
 #if WITH_EDITOR
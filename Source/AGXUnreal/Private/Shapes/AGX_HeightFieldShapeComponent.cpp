@@ -136,7 +136,8 @@ void UAGX_HeightFieldShapeComponent::CreateNative()
 
 	const FVector StartPos = BoxBounds->Transform.TransformPositionNoScale(-BoxBounds->HalfExtent);
 	NativeBarrier = AGX_HeightFieldUtilities::CreateHeightField(
-		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0);
+		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0,
+		/*bUseHeightCache*/ true, this);
 	check(HasNative());
 
 	const FTransform Transform = BoxBounds->Transform;
@@ -171,3 +172,27 @@ void UAGX_HeightFieldShapeComponent::Serialize(FArchive& Archive)
 		HeightFieldBounds->bInfiniteBounds = true;
 	}
 }
+
+#if WITH_EDITOR
+void UAGX_HeightFieldShapeComponent::CookAdditionalFilesOverride(
+	const TCHAR* PackageFilename, const ITargetPlatform* TargetPlatform,
+	TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile)
+{
+	Super::CookAdditionalFilesOverride(PackageFilename, TargetPlatform, WriteAdditionalFile);
+
+	// Cook the heights that CreateNative reads, so that the cooked build doesn't have to read them
+	// from the Landscape.
+	if (SourceLandscape == nullptr || HeightFieldBounds == nullptr)
+		return;
+
+	TOptional<UAGX_HeightFieldBoundsComponent::FHeightFieldBoundsInfo> BoxBounds =
+		HeightFieldBounds->GetLandscapeAdjustedBounds();
+	if (!BoxBounds.IsSet())
+		return;
+
+	const FVector StartPos = BoxBounds->Transform.TransformPositionNoScale(-BoxBounds->HalfExtent);
+	AGX_HeightFieldUtilities::CookHeights(
+		*SourceLandscape, StartPos, BoxBounds->HalfExtent.X * 2.0, BoxBounds->HalfExtent.Y * 2.0,
+		PackageFilename, WriteAdditionalFile);
+}
+#endif
@@ -59,6 +59,14 @@ void UAGX_ShapeComponent::SetNativeAddress(uint64 NativeAddress)
 	if (HasNative())
 	{
 		MergeSplitProperties.BindBarrierToOwner(*GetNative());
+
+		// The native is being handed over from another Component, e.g. during Blueprint
+		// reconstruction, so it is already part of the Simulation. Make sure GUID lookups find
+		// this Component instead of the previous owner.
+		if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		{
+			Simulation->RegisterGuid(*this);
+		}
 	}
 }
 
@@ -393,6 +401,15 @@ namespace AGX_ShapeComponent_helpers
 		if (auto Existing = Context.RenderStaticMeshes->FindRef(RenderData.GetGuid()))
 			return Existing;
 
+		// Render Data with another GUID may hold an identical mesh, if so share its Static Mesh.
+		const FString ContentHash = AGX_MeshUtilities::ComputeMeshContentHash(RenderData);
+		const FAGX_ImportContext::FMeshContentKey ContentKey(ContentHash, Material);
+		if (Context.RenderStaticMeshesByContent != nullptr)
+		{
+			if (auto Existing = Context.RenderStaticMeshesByContent->FindRef(ContentKey))
+				return Existing;
+		}
+
 #if WITH_EDITOR
 		// In editor builds we can delay the build and do it in batch mode later. During import this
 		// is done at the end of `FAGX_Importer::Import.
@@ -416,7 +433,12 @@ namespace AGX_ShapeComponent_helpers
 			TEXT(""), /*flipV*/ true);
 
 		if (Mesh != nullptr)
+		{
 			Context.RenderStaticMeshes->Add(RenderData.GetGuid(), Mesh);
+			if (Context.RenderStaticMeshesByContent != nullptr)
+				Context.RenderStaticMeshesByContent->Add(ContentKey, Mesh);
+			AGX_MeshUtilities::SetMeshContentHash(*Mesh, ContentHash);
+		}
 
 		return Mesh;
 	}
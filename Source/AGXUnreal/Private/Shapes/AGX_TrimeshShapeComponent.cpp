@@ -95,6 +95,15 @@ namespace TrimshShapeComponent_helpers
 		if (auto Existing = Context.CollisionStaticMeshes->FindRef(Barrier.GetGuid()))
 			return Existing;
 
+		// A Trimesh with another GUID may hold an identical mesh, if so share its Static Mesh.
+		const FString ContentHash = AGX_MeshUtilities::ComputeMeshContentHash(Barrier);
+		const FAGX_ImportContext::FMeshContentKey ContentKey(ContentHash, Material);
+		if (Context.CollisionStaticMeshesByContent != nullptr)
+		{
+			if (auto Existing = Context.CollisionStaticMeshesByContent->FindRef(ContentKey))
+				return Existing;
+		}
+
 #if WITH_EDITOR
 		// In editor builds we can delay the build and do it in batch mode later.
 		const bool bBuild = false;
@@ -116,7 +125,12 @@ namespace TrimshShapeComponent_helpers
 			Barrier, *Context.Outer, Material, bBuild, bWithBoxCollision, NormalSource);
 
 		if (Mesh != nullptr)
+		{
 			Context.CollisionStaticMeshes->Add(Barrier.GetGuid(), Mesh);
+			if (Context.CollisionStaticMeshesByContent != nullptr)
+				Context.CollisionStaticMeshesByContent->Add(ContentKey, Mesh);
+			AGX_MeshUtilities::SetMeshContentHash(*Mesh, ContentHash);
+		}
 
 		return Mesh;
 	}
@@ -19,6 +19,7 @@
 #include "Utilities/AGX_StringUtilities.h"
 
 // Unreal Engine includes.
+#include "Async/ParallelFor.h"
 #include "Containers/Ticker.h"
 #include "Materials/MaterialInterface.h"
 
@@ -115,74 +116,83 @@ void UAGX_MovableTerrainComponent::ConnectMeshToNative()
 						if (!bHeightsInitialized && FetchNativeHeights())
 							RecreateMeshes();
 
-						auto ModifiedHeights = NativeBarrier.GetModifiedVertices();
-						FVector2D NativeTerrainSize = GetTerrainSize();
-
-						auto UpdateHeightMesh = [&](const HeightMesh& Mesh) -> void
-						{
-							// Callback to check if a Tile contain any ModifiedHeights
-							auto IsTileDirty = [&](const MeshTile& Tile) -> bool
-							{
-								FVector2D Epsilon = FVector2D(ElementSize, ElementSize);
-								FVector2D TilePlaneCenter = FVector2D(Tile.Center.X, Tile.Center.Y);
-								FBox2D TileBox = FBox2D(
-									TilePlaneCenter - Tile.Size / 2 - Epsilon,
-									TilePlaneCenter + Tile.Size / 2 + Epsilon);
-								for (auto& HeightVertexTuple : ModifiedHeights)
-								{
-									double x = std::get<0>(HeightVertexTuple);
-									double y = std::get<1>(HeightVertexTuple);
-									FVector2D ModifiedPos =
-										FVector2D(x, y) * ElementSize - NativeTerrainSize / 2;
-									if (TileBox.IsInside(ModifiedPos))
-									{
-										return true;
-									}
-								}
-
-								return false;
-							};
-
-							for (auto& Tile : Mesh.Tiles)
-							{
-								if (IsTileDirty(Tile))
-								{
-									// Create Mesh Description (Vertex Positions)
-									auto MeshDesc =
-										UAGX_TerrainMeshUtilities::CreateHeightMeshTileDescription(
-											Tile.Center, Tile.Size, Tile.Resolution, Mesh.Center,
-											Mesh.Size, Mesh.Uv0, Mesh.Uv1, Mesh.HeightFunc,
-											Mesh.EdgeHeightFunc, Mesh.bCreateEdges, Mesh.bFixSeams,
-											Mesh.bReverseWinding,
-											/*bCalcFastTerrainBedNormals*/ true);
-
-									// Update MeshSection (Re-Upload to GPU)
-									UpdateMeshSection(
-										Tile.MeshIndex, MeshDesc->Vertices, MeshDesc->Normals,
-										MeshDesc->UV0, MeshDesc->UV1, TArray<FVector2D>(),
-										TArray<FVector2D>(), MeshDesc->Colors, MeshDesc->Tangents);
-								}
-							}
-						};
-
-						if (ModifiedHeights.Num() > 0)
-						{
-							// Update CurrentHeights
-							NativeBarrier.GetHeights(CurrentHeights, true);
-
-							// Update Terrain
-							UpdateHeightMesh(TerrainMesh);
-
-							// Update Collision
-							bool bIsUnrealCollision =
-								AdditionalUnrealCollision != ECollisionEnabled::NoCollision;
-							if (bShowUnrealCollision || bIsUnrealCollision)
-								UpdateHeightMesh(CollisionMesh);
-						}
+						// Update CurrentHeights and, from that, the meshes.
+						const TArray<std::tuple<int32, int32>> ModifiedVertices =
+							NativeBarrier.GetModifiedHeights(CurrentHeights);
+						if (ModifiedVertices.Num() > 0)
+							UpdateDirtyMeshTiles(ModifiedVertices);
 					});
 	}
 }
 
+void UAGX_MovableTerrainComponent::UpdateDirtyMeshTiles(
+	const TArray<std::tuple<int32, int32>>& ModifiedVertices)
+{
+	const bool bIsUnrealCollision = AdditionalUnrealCollision != ECollisionEnabled::NoCollision;
+	const bool bUpdateCollision = bShowUnrealCollision || bIsUnrealCollision;
+
+	// The bins are built when the meshes are created, this only catches meshes replaced by other
+	// means.
+	if (TerrainMeshTileBins.NumTiles() != TerrainMesh.Tiles.Num())
+		TerrainMeshTileBins.Init(TerrainMesh, ElementSize);
+	if (bUpdateCollision && CollisionMeshTileBins.NumTiles() != CollisionMesh.Tiles.Num())
+		CollisionMeshTileBins.Init(CollisionMesh, ElementSize);
+
+	// Bin each modified vertex directly into the tiles containing it, for both meshes in a single
+	// pass over the modified vertices.
+	TBitArray<> TerrainDirty(false, TerrainMesh.Tiles.Num());
+	TBitArray<> CollisionDirty(false, bUpdateCollision ? CollisionMesh.Tiles.Num() : 0);
+	const FVector2D NativeTerrainSize = GetTerrainSize();
+	for (const std::tuple<int32, int32>& Vertex : ModifiedVertices)
+	{
+		const FVector2D ModifiedPos =
+			FVector2D(std::get<0>(Vertex), std::get<1>(Vertex)) * ElementSize -
+			NativeTerrainSize / 2;
+		TerrainMeshTileBins.MarkTiles(ModifiedPos, TerrainDirty);
+		if (bUpdateCollision)
+			CollisionMeshTileBins.MarkTiles(ModifiedPos, CollisionDirty);
+	}
+
+	struct FDirtyTile
+	{
+		const HeightMesh* Mesh;
+		const MeshTile* Tile;
+	};
+	TArray<FDirtyTile> DirtyTiles;
+	for (TConstSetBitIterator<> It(TerrainDirty); It; ++It)
+		DirtyTiles.Add({&TerrainMesh, &TerrainMesh.Tiles[It.GetIndex()]});
+	for (TConstSetBitIterator<> It(CollisionDirty); It; ++It)
+		DirtyTiles.Add({&CollisionMesh, &CollisionMesh.Tiles[It.GetIndex()]});
+
+	// Create the Mesh Descriptions (Vertex Positions) on worker threads. This only reads the
+	// height arrays, which are not modified until the next Step Forward.
+	TArray<TSharedPtr<FAGX_MeshDescription>> MeshDescs;
+	MeshDescs.SetNum(DirtyTiles.Num());
+	ParallelFor(
+		DirtyTiles.Num(),
+		[&DirtyTiles, &MeshDescs](int32 I)
+		{
+			const HeightMesh& Mesh = *DirtyTiles[I].Mesh;
+			const MeshTile& Tile = *DirtyTiles[I].Tile;
+			MeshDescs[I] = UAGX_TerrainMeshUtilities::CreateHeightMeshTileDescription(
+				Tile.Center, Tile.Size, Tile.Resolution, Mesh.Center, Mesh.Size, Mesh.Uv0,
+				Mesh.Uv1, Mesh.HeightFunc, Mesh.EdgeHeightFunc, Mesh.bCreateEdges,
+				Mesh.bFixSeams, Mesh.bReverseWinding,
+				/*bCalcFastTerrainBedNormals*/ true);
+		},
+		DirtyTiles.Num() < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Update MeshSection (Re-Upload to GPU), which must be done on the game thread.
+	for (int32 I = 0; I < DirtyTiles.Num(); ++I)
+	{
+		const TSharedPtr<FAGX_MeshDescription>& MeshDesc = MeshDescs[I];
+		UpdateMeshSection(
+			DirtyTiles[I].Tile->MeshIndex, MeshDesc->Vertices, MeshDesc->Normals, MeshDesc->UV0,
+			MeshDesc->UV1, TArray<FVector2D>(), TArray<FVector2D>(), MeshDesc->Colors,
+			MeshDesc->Tangents);
+	}
+}
+
 bool UAGX_MovableTerrainComponent::FetchNativeHeights()
 {
 	if (!HasNative())
@@ -328,6 +338,9 @@ void UAGX_MovableTerrainComponent::RecreateMeshes()
 		MeshIndex += CollisionMesh.Tiles.Num();
 	}
 
+	TerrainMeshTileBins.Init(TerrainMesh, ElementSize);
+	CollisionMeshTileBins.Init(CollisionMesh, ElementSize);
+
 	// BedMesh (Backside. Just a plane at the bottom if there is no BedShapes)
 	if (bIsUnrealCollision || bCloseMesh || bShowUnrealCollision)
 	{
@@ -1018,9 +1031,31 @@ bool UAGX_MovableTerrainComponent::UpdateNativeShapeMaterial()
 	return true;
 }
 
+int32 UAGX_MovableTerrainComponent::AddParticleDataSubscription(
+	EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback)
+{
+	return ParticleDataSubscriptions.Add(Fields, UpdateInterval, MoveTemp(Callback));
+}
+
+void UAGX_MovableTerrainComponent::RemoveParticleDataSubscription(int32 SubscriptionId)
+{
+	ParticleDataSubscriptions.Remove(SubscriptionId);
+}
+
 void UAGX_MovableTerrainComponent::UpdateParticleData()
 {
-	if (!HasNative() || !OnParticleData.IsBound())
+	if (!HasNative())
+		return;
+
+	if (!ParticleDataSubscriptions.IsEmpty())
+	{
+		ParticleDataSubscriptions.Update(
+			GetWorld()->GetTimeSeconds(),
+			[this](EParticleDataFlags Fields, FParticleDataById& OutParticleData)
+			{ NativeBarrier.GetParticleDataById(Fields, OutParticleData); });
+	}
+
+	if (!OnParticleData.IsBound())
 		return;
 
 	EParticleDataFlags ToInclude = EParticleDataFlags::Positions | EParticleDataFlags::Rotations |
@@ -0,0 +1,63 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
+
+int32 FAGX_ParticleDataSubscriptions::Add(
+	EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback)
+{
+	const int32 Id = NextId++;
+	Subscriptions.Add({Id, Fields, FMath::Max(UpdateInterval, 0.0), 0.0, MoveTemp(Callback)});
+	return Id;
+}
+
+void FAGX_ParticleDataSubscriptions::Remove(int32 SubscriptionId)
+{
+	Subscriptions.RemoveAll([SubscriptionId](const FSubscription& Subscription)
+							{ return Subscription.Id == SubscriptionId; });
+}
+
+bool FAGX_ParticleDataSubscriptions::IsEmpty() const
+{
+	return Subscriptions.Num() == 0;
+}
+
+void FAGX_ParticleDataSubscriptions::Update(
+	double Time, TFunctionRef<void(EParticleDataFlags, FParticleDataById&)> Fetch)
+{
+	auto IsDue = [Time](const FSubscription& Subscription)
+	{ return Subscription.NextUpdateTime <= Time && Subscription.Callback.IsBound(); };
+
+	// A due subscription for no fields at all still causes a read, since the Exists array is
+	// always read.
+	std::underlying_type<EParticleDataFlags>::type Fields = 0;
+	bool bAnyDue = false;
+	for (const FSubscription& Subscription : Subscriptions)
+	{
+		if (!IsDue(Subscription))
+			continue;
+
+		Fields |= Subscription.Fields;
+		bAnyDue = true;
+	}
+	if (!bAnyDue)
+		return;
+
+	Fetch(static_cast<EParticleDataFlags>(Fields), ParticleData);
+
+	// Iterate over a copy of the due subscriptions since a callback may add or remove
+	// subscriptions.
+	TArray<FSubscription, TInlineAllocator<4>> Due;
+	for (FSubscription& Subscription : Subscriptions)
+	{
+		if (!IsDue(Subscription))
+			continue;
+
+		Subscription.NextUpdateTime = Time + Subscription.UpdateInterval;
+		Due.Add(Subscription);
+	}
+
+	for (const FSubscription& Subscription : Due)
+	{
+		Subscription.Callback.ExecuteIfBound(ParticleData);
+	}
+}
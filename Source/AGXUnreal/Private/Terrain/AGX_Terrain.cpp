@@ -608,6 +608,28 @@ void AAGX_Terrain::PostLoad()
 			/*delay*/ 5.f);
 	}
 }
+
+void AAGX_Terrain::CookAdditionalFilesOverride(
+	const TCHAR* PackageFilename, const ITargetPlatform* TargetPlatform,
+	TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile)
+{
+	Super::CookAdditionalFilesOverride(PackageFilename, TargetPlatform, WriteAdditionalFile);
+
+	// Cook the heights that CreateNative reads, so that the cooked build doesn't have to read them
+	// from the Landscape. The Terrain Pager reads its tiles on demand instead.
+	if (SourceLandscape == nullptr || bEnableTerrainPaging || TerrainBounds == nullptr)
+		return;
+
+	TOptional<UAGX_HeightFieldBoundsComponent::FHeightFieldBoundsInfo> Bounds =
+		TerrainBounds->GetLandscapeAdjustedBounds();
+	if (!Bounds.IsSet())
+		return;
+
+	const FVector StartPos = Bounds->Transform.TransformPositionNoScale(-Bounds->HalfExtent);
+	AGX_HeightFieldUtilities::CookHeights(
+		*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0,
+		PackageFilename, WriteAdditionalFile);
+}
 #endif // WITH_EDITOR
 
 void AAGX_Terrain::BeginPlay()
@@ -662,6 +684,7 @@ void AAGX_Terrain::EndPlay(const EEndPlayReason::Type Reason)
 	{
 		NativeTerrainPagerBarrier.ReleaseNative();
 	}
+	HeightSnapshot.Reset();
 	if (HasNative())
 	{
 		NativeBarrier.ReleaseNative();
@@ -675,6 +698,7 @@ void AAGX_Terrain::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	UpdateParticlesArrays();
+	PrefetchTerrainPagerHeights();
 }
 
 bool AAGX_Terrain::FetchHeights(
@@ -682,80 +706,11 @@ bool AAGX_Terrain::FetchHeights(
 {
 	/*
 	 * This function will be called by the native Terrain Pager from a worker thread, meaning we
-	 * have to make sure that what we do here is thread safe. For example, we protect the
-	 * OriginalHeights array here since it may be read from the main thread in
-	 * UpdateDisplacementMap.
+	 * have to make sure that what we do here is thread safe. The height snapshot is safe to read
+	 * from any thread without locking, and it is also what UpdateDisplacementMap reads the original
+	 * heights from on the game thread.
 	 */
-
-	if (SourceLandscape == nullptr || !HasNative())
-		return false;
-
-	const double QuadSizeX = SourceLandscape->GetActorScale().X;
-	const double QuadSizeY = SourceLandscape->GetActorScale().Y;
-	const FVector PosStartLocal =
-		SourceLandscape->GetTransform().InverseTransformPositionNoScale(WorldPosStart);
-	const int32 StartVertX = FMath::RoundToInt(PosStartLocal.X / QuadSizeX);
-	const int32 StartVertY = FMath::RoundToInt(PosStartLocal.Y / QuadSizeY);
-
-	const FVector NativePosLocal = SourceLandscape->GetTransform().InverseTransformPositionNoScale(
-		GetNativeTransform().GetLocation());
-	const int32 BoundsCornerMinX =
-		FMath::RoundToInt(NativePosLocal.X / QuadSizeX) - NumVerticesX / 2;
-	const int32 BoundsCornerMinY =
-		FMath::RoundToInt(NativePosLocal.Y / QuadSizeY) - NumVerticesY / 2;
-	const int32 BoundsCornerMaxX =
-		FMath::RoundToInt(NativePosLocal.X / QuadSizeX) + NumVerticesX / 2;
-	const int32 BoundsCornerMaxY =
-		FMath::RoundToInt(NativePosLocal.Y / QuadSizeY) + NumVerticesY / 2;
-
-	// Check that we are not asked to read outside the bounds.
-	if (StartVertX < BoundsCornerMinX || StartVertY < BoundsCornerMinY ||
-		StartVertX + VertsX - 1 > BoundsCornerMaxX || StartVertY + VertsY - 1 > BoundsCornerMaxY)
-	{
-		return false;
-	}
-
-	OutHeights.Reserve(VertsX * VertsY);
-
-	{
-		std::lock_guard<std::mutex> ScopedOrigHeightsLock(OriginalHeightsMutex);
-
-		// AGX Dynamics coordinate systems are mapped with Y-axis flipped.
-		for (int Y = StartVertY + VertsY - 1; Y >= StartVertY; Y--)
-		{
-			for (int X = StartVertX; X < StartVertX + VertsX; X++)
-			{
-				const FVector SamplePosLocal = FVector(
-					static_cast<double>(X) * QuadSizeX, static_cast<double>(Y) * QuadSizeY, 0.0);
-				const FVector SamplePosGlobal =
-					SourceLandscape->GetTransform().TransformPositionNoScale(SamplePosLocal);
-
-				if (auto Height = SourceLandscape->GetHeightAtLocation(SamplePosGlobal))
-				{
-					FVector HeightPointLocal =
-						SourceLandscape->GetTransform().InverseTransformPositionNoScale(
-							FVector(SamplePosGlobal.X, SamplePosGlobal.Y, *Height));
-					OutHeights.Add(HeightPointLocal.Z);
-					OriginalHeights
-						[(X - BoundsCornerMinX) + (Y - BoundsCornerMinY) * NumVerticesX] =
-							HeightPointLocal.Z;
-				}
-				else
-				{
-					UE_LOG(
-						LogAGX, Warning,
-						TEXT("Height read unsuccessful in Terrain. World sample pos: %s"),
-						*SamplePosGlobal.ToString());
-					OutHeights.Add(SourceLandscape->GetActorLocation().Z);
-					OriginalHeights
-						[(X - BoundsCornerMinX) + (Y - BoundsCornerMinY) * NumVerticesX] =
-							SourceLandscape->GetActorLocation().Z;
-				}
-			}
-		}
-	}
-
-	return true;
+	return HeightSnapshot.GetHeights(WorldPosStart, VertsX, VertsY, OutHeights);
 }
 
 FTransform AAGX_Terrain::GetNativeTransform() const
@@ -1032,7 +987,8 @@ bool AAGX_Terrain::CreateNative()
 		else
 		{
 			return AGX_HeightFieldUtilities::CreateHeightField(
-				*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0);
+				*SourceLandscape, StartPos, Bounds->HalfExtent.X * 2.0, Bounds->HalfExtent.Y * 2.0,
+				/*bUseHeightCache*/ true, this);
 		}
 	}();
 
@@ -1165,6 +1121,9 @@ bool AAGX_Terrain::CreateNativeTerrainPager()
 		return false;
 	}
 
+	HeightSnapshot.Init(
+		*SourceLandscape, GetNativeTransform().GetLocation(), NumVerticesX, NumVerticesY);
+
 	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this);
 	if (Simulation == nullptr)
 	{
@@ -1356,6 +1315,35 @@ void AAGX_Terrain::AddTerrainPagerBodies()
 	}
 }
 
+void AAGX_Terrain::PrefetchTerrainPagerHeights()
+{
+	if (!HasNativeTerrainPager() || !HeightSnapshot.IsInitialized())
+		return;
+
+	// Sample the Landscape heights ahead of each tracked Rigid Body on background threads, so that
+	// they are ready when the Terrain Pager asks for the tiles that the body is heading towards.
+	for (const FAGX_TerrainPagingBodyReference& TrackedBody :
+		 TerrainPagingSettings.TrackedRigidBodies)
+	{
+		UAGX_RigidBodyComponent* Body = TrackedBody.RigidBody.GetRigidBody();
+		if (Body == nullptr || !Body->HasNative())
+			continue;
+
+		// Step along the predicted path with steps no longer than the prefetch radius so that no
+		// part of the path is left out. Chunks already requested are skipped by Prefetch, so in
+		// steady state this is only a handful of flag checks per body.
+		const FVector Position = Body->GetPosition();
+		const FVector Ahead = Body->GetVelocity() * TerrainPagingSettings.HeightPrefetchTime;
+		const double Radius = TrackedBody.PreloadRadius.GetValue() + TerrainPagingSettings.TileSize;
+		const int32 NumSteps = FMath::Min(FMath::CeilToInt(Ahead.Size() / Radius), 16);
+		for (int32 Step = 0; Step <= NumSteps; ++Step)
+		{
+			const double Fraction = NumSteps > 0 ? static_cast<double>(Step) / NumSteps : 0.0;
+			HeightSnapshot.Prefetch(Position + Ahead * Fraction, Radius);
+		}
+	}
+}
+
 void AAGX_Terrain::InitializeRendering()
 {
 	if (bEnableDisplacementRendering)
@@ -1506,6 +1494,7 @@ void AAGX_Terrain::InitializeDisplacementMap()
 
 	DisplacementData.SetNum(NumVerticesX * NumVerticesY);
 	DisplacementMapRegions.Add(FUpdateTextureRegion2D(0, 0, 0, 0, NumVerticesX, NumVerticesY));
+	bDisplacementMapNeedsFullUpload = true;
 
 	/// \todo I'm not sure why we need this. Does the texture sampler "fudge the
 	/// values" when using non-linear gamma?
@@ -1524,8 +1513,72 @@ void AAGX_Terrain::InitializeDisplacementMap()
 	DisplacementMapInitialized = true;
 }
 
+namespace AGX_Terrain_helpers
+{
+	// Side length, in vertices, of the blocks that modified vertices are binned into when
+	// computing the dirty regions of the displacement map.
+	constexpr int32 DisplacementMapBlockSize = 32;
+
+	// If the dirty regions cover more than this fraction of the displacement map then the entire
+	// displacement map is uploaded instead, since one large upload is cheaper than many small.
+	constexpr double DisplacementMapFullUploadFraction = 0.5;
+
+	/**
+	 * Compute texture regions covering all modified vertices. The vertices are binned into blocks
+	 * and runs of dirty blocks on the same block row are merged into a single region.
+	 *
+	 * @param DirtyBlocks Scratch memory, kept between calls to avoid reallocations.
+	 * @return The number of pixels covered by the regions.
+	 */
+	int64 GetDirtyRegions(
+		const TArray<std::tuple<int32, int32>>& ModifiedVertices, int32 NumVerticesX,
+		int32 NumVerticesY, TBitArray<>& DirtyBlocks, TArray<FUpdateTextureRegion2D>& OutRegions)
+	{
+		const int32 NumBlocksX = FMath::DivideAndRoundUp(NumVerticesX, DisplacementMapBlockSize);
+		const int32 NumBlocksY = FMath::DivideAndRoundUp(NumVerticesY, DisplacementMapBlockSize);
+		DirtyBlocks.Init(false, NumBlocksX * NumBlocksY);
+		for (const auto& VertexTuple : ModifiedVertices)
+		{
+			const int32 BlockX = std::get<0>(VertexTuple) / DisplacementMapBlockSize;
+			const int32 BlockY = std::get<1>(VertexTuple) / DisplacementMapBlockSize;
+			DirtyBlocks[BlockX + BlockY * NumBlocksX] = true;
+		}
+
+		int64 NumDirtyPixels = 0;
+		for (int32 BlockY = 0; BlockY < NumBlocksY; ++BlockY)
+		{
+			const int32 Y = BlockY * DisplacementMapBlockSize;
+			const int32 Height = FMath::Min(DisplacementMapBlockSize, NumVerticesY - Y);
+			int32 BlockX = 0;
+			while (BlockX < NumBlocksX)
+			{
+				if (!DirtyBlocks[BlockX + BlockY * NumBlocksX])
+				{
+					++BlockX;
+					continue;
+				}
+
+				const int32 RunStart = BlockX;
+				while (BlockX < NumBlocksX && DirtyBlocks[BlockX + BlockY * NumBlocksX])
+				{
+					++BlockX;
+				}
+
+				const int32 X = RunStart * DisplacementMapBlockSize;
+				const int32 Width =
+					FMath::Min(BlockX * DisplacementMapBlockSize, NumVerticesX) - X;
+				OutRegions.Add(FUpdateTextureRegion2D(X, Y, X, Y, Width, Height));
+				NumDirtyPixels += static_cast<int64>(Width) * Height;
+			}
+		}
+
+		return NumDirtyPixels;
+	}
+}
+
 void AAGX_Terrain::UpdateDisplacementMap()
 {
+	using namespace AGX_Terrain_helpers;
 	if (!DisplacementMapInitialized)
 	{
 		return;
@@ -1549,27 +1602,51 @@ void AAGX_Terrain::UpdateDisplacementMap()
 	}
 	else
 	{
-		NativeBarrier.GetHeights(CurrentHeights, true);
-		ModifiedVertices = NativeBarrier.GetModifiedVertices();
+		ModifiedVertices = NativeBarrier.GetModifiedHeights(CurrentHeights);
 	}
 
+	// Nothing has changed, so the texture is already up to date. Unless this is the first update,
+	// in which case the texture content is undefined.
+	if (ModifiedVertices.Num() == 0 && !bDisplacementMapNeedsFullUpload)
 	{
-		std::lock_guard<std::mutex> ScopedOrigHeightsLock(OriginalHeightsMutex);
-		for (const auto& VertexTuple : ModifiedVertices)
-		{
-			const int32 VertX = std::get<0>(VertexTuple);
-			const int32 VertY = std::get<1>(VertexTuple);
-			const int32 Index = VertX + VertY * NumVerticesX;
-			const float HeightChange = CurrentHeights[Index] - OriginalHeights[Index];
-			DisplacementData[Index] = static_cast<FFloat16>(HeightChange);
-		}
+		return;
+	}
+
+	for (const auto& VertexTuple : ModifiedVertices)
+	{
+		const int32 VertX = std::get<0>(VertexTuple);
+		const int32 VertY = std::get<1>(VertexTuple);
+		const int32 Index = VertX + VertY * NumVerticesX;
+		const float OriginalHeight = bEnableTerrainPaging ? HeightSnapshot.GetHeight(VertX, VertY)
+														  : OriginalHeights[Index];
+		const float HeightChange = CurrentHeights[Index] - OriginalHeight;
+		DisplacementData[Index] = static_cast<FFloat16>(HeightChange);
 	}
 
 	const uint32 BytesPerPixel = sizeof(FFloat16);
 	uint8* PixelData = reinterpret_cast<uint8*>(DisplacementData.GetData());
+
+	// Only upload the parts of the texture that have changed, unless most of it has changed.
+	if (!bDisplacementMapNeedsFullUpload)
+	{
+		TArray<FUpdateTextureRegion2D> DirtyRegions;
+		const int64 NumDirtyPixels = GetDirtyRegions(
+			ModifiedVertices, NumVerticesX, NumVerticesY, DisplacementMapDirtyBlocks,
+			DirtyRegions);
+		const int64 NumPixels = static_cast<int64>(NumVerticesX) * NumVerticesY;
+		if (NumDirtyPixels <= NumPixels * DisplacementMapFullUploadFraction)
+		{
+			FAGX_RenderUtilities::UpdateRenderTextureRegions(
+				*LandscapeDisplacementMap, MoveTemp(DirtyRegions), NumVerticesX * BytesPerPixel,
+				BytesPerPixel, PixelData);
+			return;
+		}
+	}
+
 	FAGX_RenderUtilities::UpdateRenderTextureRegions(
 		*LandscapeDisplacementMap, 1, DisplacementMapRegions.GetData(),
 		NumVerticesX * BytesPerPixel, BytesPerPixel, PixelData, false);
+	bDisplacementMapNeedsFullUpload = false;
 }
 
 void AAGX_Terrain::ClearDisplacementMap()
@@ -1603,20 +1680,44 @@ void AAGX_Terrain::ClearDisplacementMap()
 		NumVerticesX * BytesPerPixel, BytesPerPixel, PixelData, false);
 }
 
+int32 AAGX_Terrain::AddParticleDataSubscription(
+	EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback)
+{
+	return ParticleDataSubscriptions.Add(Fields, UpdateInterval, MoveTemp(Callback));
+}
+
+void AAGX_Terrain::RemoveParticleDataSubscription(int32 SubscriptionId)
+{
+	ParticleDataSubscriptions.Remove(SubscriptionId);
+}
+
 void AAGX_Terrain::UpdateParticlesArrays()
 {
-	if (!NativeBarrier.HasNative() || !OnParticleData.IsBound())
+	if (!NativeBarrier.HasNative())
 	{
 		return;
 	}
 
+	if (!ParticleDataSubscriptions.IsEmpty())
+	{
+		ParticleDataSubscriptions.Update(
+			GetWorld()->GetTimeSeconds(),
+			[this](EParticleDataFlags Fields, FParticleDataById& OutParticleData)
+			{
+				if (bEnableTerrainPaging)
+					NativeTerrainPagerBarrier.GetParticleDataById(Fields, OutParticleData);
+				else
+					NativeBarrier.GetParticleDataById(Fields, OutParticleData);
+			});
+	}
+
+	if (!OnParticleData.IsBound())
+	{
+		return;
+	}
 
-	// Copy data with holes.
-	// 
-	// TODO: Change the way this data broadcasting is done by letting the user
-	// request only the subset of data that the user wants.This is to avoid fetching, 
-	// converting, packing, and passing data that will never be looked at. Right now
-	// we fetch everything but may not look at everything. 
+	// On Particle Data always gets everything, packed as FVector4s. Subscribers that only need
+	// some of the data should use a particle data subscription instead.
 	EParticleDataFlags ToInclude = EParticleDataFlags::Positions | EParticleDataFlags::Rotations |
 								   EParticleDataFlags::Radii | EParticleDataFlags::Velocities | EParticleDataFlags::Masses;
 	const FParticleDataById ParticleData =
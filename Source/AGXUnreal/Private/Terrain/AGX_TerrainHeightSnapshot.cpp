@@ -0,0 +1,264 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Terrain/AGX_TerrainHeightSnapshot.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+
+// Unreal Engine includes.
+#include "Async/ParallelFor.h"
+#include "Landscape.h"
+
+namespace AGX_TerrainHeightSnapshot_helpers
+{
+	/**
+	 * Side length of a chunk in vertices. Small enough that a Terrain Pager tile only pulls in a few
+	 * chunks, large enough that each chunk is a worthwhile unit of parallel work.
+	 */
+	constexpr int32 ChunkSize = 32;
+}
+
+FAGX_TerrainHeightSnapshot::~FAGX_TerrainHeightSnapshot()
+{
+	Reset();
+}
+
+void FAGX_TerrainHeightSnapshot::Init(
+	const ALandscape& InLandscape, const FVector& BoundsCenter, int32 NumVerticesX,
+	int32 NumVerticesY)
+{
+	using namespace AGX_TerrainHeightSnapshot_helpers;
+	Reset();
+
+	Landscape = &InLandscape;
+	LandscapeTransform = InLandscape.GetTransform();
+	QuadSize = FVector2D(InLandscape.GetActorScale().X, InLandscape.GetActorScale().Y);
+	FallbackHeight = static_cast<float>(InLandscape.GetActorLocation().Z);
+
+	const FVector CenterLocal = LandscapeTransform.InverseTransformPositionNoScale(BoundsCenter);
+	CornerMin = FIntPoint(
+		FMath::RoundToInt(CenterLocal.X / QuadSize.X) - NumVerticesX / 2,
+		FMath::RoundToInt(CenterLocal.Y / QuadSize.Y) - NumVerticesY / 2);
+	NumVertices = FIntPoint(NumVerticesX, NumVerticesY);
+	NumChunks = FIntPoint(
+		FMath::DivideAndRoundUp(NumVerticesX, ChunkSize),
+		FMath::DivideAndRoundUp(NumVerticesY, ChunkSize));
+
+	const int32 NumChunksTotal = NumChunks.X * NumChunks.Y;
+	Chunks = MakeUnique<std::atomic<FChunk*>[]>(NumChunksTotal);
+	ChunkRequested = MakeUnique<std::atomic<bool>[]>(NumChunksTotal);
+	for (int32 I = 0; I < NumChunksTotal; ++I)
+	{
+		Chunks[I].store(nullptr, std::memory_order_relaxed);
+		ChunkRequested[I].store(false, std::memory_order_relaxed);
+	}
+}
+
+void FAGX_TerrainHeightSnapshot::Reset()
+{
+	if (PrefetchTasks.Num() > 0)
+	{
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(PrefetchTasks);
+		PrefetchTasks.Empty();
+	}
+
+	ReleaseChunks();
+	Chunks.Reset();
+	ChunkRequested.Reset();
+	Landscape = nullptr;
+	NumVertices = FIntPoint(0, 0);
+	NumChunks = FIntPoint(0, 0);
+}
+
+bool FAGX_TerrainHeightSnapshot::IsInitialized() const
+{
+	return Landscape != nullptr;
+}
+
+bool FAGX_TerrainHeightSnapshot::GetHeights(
+	const FVector& WorldPosStart, int32 VertsX, int32 VertsY, TArray<float>& OutHeights)
+{
+	using namespace AGX_TerrainHeightSnapshot_helpers;
+	if (!IsInitialized())
+		return false;
+
+	const FVector PosStartLocal = LandscapeTransform.InverseTransformPositionNoScale(WorldPosStart);
+	const int32 StartX = FMath::RoundToInt(PosStartLocal.X / QuadSize.X) - CornerMin.X;
+	const int32 StartY = FMath::RoundToInt(PosStartLocal.Y / QuadSize.Y) - CornerMin.Y;
+
+	// Check that we are not asked to read outside the bounds.
+	if (StartX < 0 || StartY < 0 || VertsX <= 0 || VertsY <= 0 ||
+		StartX + VertsX > NumVertices.X || StartY + VertsY > NumVertices.Y)
+	{
+		return false;
+	}
+
+	// Sample the chunks that are missing, typically because the tile was not prefetched, all at
+	// once so that they are sampled in parallel with each other.
+	const FIntPoint FirstChunk(StartX / ChunkSize, StartY / ChunkSize);
+	const FIntPoint LastChunk((StartX + VertsX - 1) / ChunkSize, (StartY + VertsY - 1) / ChunkSize);
+	TArray<int32, TInlineAllocator<16>> MissingChunks;
+	for (int32 ChunkY = FirstChunk.Y; ChunkY <= LastChunk.Y; ++ChunkY)
+	{
+		for (int32 ChunkX = FirstChunk.X; ChunkX <= LastChunk.X; ++ChunkX)
+		{
+			const int32 ChunkIndex = ChunkX + ChunkY * NumChunks.X;
+			if (Chunks[ChunkIndex].load(std::memory_order_acquire) == nullptr)
+				MissingChunks.Add(ChunkIndex);
+		}
+	}
+	ParallelFor(
+		MissingChunks.Num(), [this, &MissingChunks](int32 I)
+		{ GetOrSampleChunk(MissingChunks[I]); });
+
+	OutHeights.Reset(VertsX * VertsY);
+
+	// AGX Dynamics coordinate systems are mapped with Y-axis flipped.
+	for (int32 Y = StartY + VertsY - 1; Y >= StartY; --Y)
+	{
+		const int32 ChunkY = Y / ChunkSize;
+		const int32 LocalY = Y - ChunkY * ChunkSize;
+		for (int32 X = StartX; X < StartX + VertsX;)
+		{
+			const int32 ChunkX = X / ChunkSize;
+			const int32 LocalX = X - ChunkX * ChunkSize;
+			const int32 NumInChunk = FMath::Min(ChunkSize - LocalX, StartX + VertsX - X);
+			const FChunk& Chunk = GetOrSampleChunk(ChunkX + ChunkY * NumChunks.X);
+			OutHeights.Append(&Chunk.Heights[LocalX + LocalY * ChunkSize], NumInChunk);
+			X += NumInChunk;
+		}
+	}
+
+	return true;
+}
+
+float FAGX_TerrainHeightSnapshot::GetHeight(int32 VertexX, int32 VertexY)
+{
+	using namespace AGX_TerrainHeightSnapshot_helpers;
+	check(VertexX >= 0 && VertexX < NumVertices.X && VertexY >= 0 && VertexY < NumVertices.Y);
+
+	const int32 ChunkX = VertexX / ChunkSize;
+	const int32 ChunkY = VertexY / ChunkSize;
+	const int32 LocalX = VertexX - ChunkX * ChunkSize;
+	const int32 LocalY = VertexY - ChunkY * ChunkSize;
+	const FChunk& Chunk = GetOrSampleChunk(ChunkX + ChunkY * NumChunks.X);
+	return Chunk.Heights[LocalX + LocalY * ChunkSize];
+}
+
+void FAGX_TerrainHeightSnapshot::Prefetch(const FVector& WorldPosition, double Radius)
+{
+	using namespace AGX_TerrainHeightSnapshot_helpers;
+	check(IsInGameThread());
+	if (!IsInitialized())
+		return;
+
+	PrefetchTasks.RemoveAll([](const FGraphEventRef& Task) { return Task->IsComplete(); });
+
+	const FVector PosLocal = LandscapeTransform.InverseTransformPositionNoScale(WorldPosition);
+	const double ChunkSizeX = ChunkSize * QuadSize.X;
+	const double ChunkSizeY = ChunkSize * QuadSize.Y;
+	const double MinX = PosLocal.X - Radius - CornerMin.X * QuadSize.X;
+	const double MinY = PosLocal.Y - Radius - CornerMin.Y * QuadSize.Y;
+	const double MaxX = PosLocal.X + Radius - CornerMin.X * QuadSize.X;
+	const double MaxY = PosLocal.Y + Radius - CornerMin.Y * QuadSize.Y;
+	const int32 FirstChunkX = FMath::Max(FMath::FloorToInt(MinX / ChunkSizeX), 0);
+	const int32 FirstChunkY = FMath::Max(FMath::FloorToInt(MinY / ChunkSizeY), 0);
+	const int32 LastChunkX = FMath::Min(FMath::FloorToInt(MaxX / ChunkSizeX), NumChunks.X - 1);
+	const int32 LastChunkY = FMath::Min(FMath::FloorToInt(MaxY / ChunkSizeY), NumChunks.Y - 1);
+
+	for (int32 ChunkY = FirstChunkY; ChunkY <= LastChunkY; ++ChunkY)
+	{
+		for (int32 ChunkX = FirstChunkX; ChunkX <= LastChunkX; ++ChunkX)
+		{
+			const int32 ChunkIndex = ChunkX + ChunkY * NumChunks.X;
+			if (ChunkRequested[ChunkIndex].exchange(true, std::memory_order_relaxed))
+				continue;
+
+			PrefetchTasks.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+				[this, ChunkIndex]() { GetOrSampleChunk(ChunkIndex); }, TStatId(), nullptr,
+				ENamedThreads::AnyBackgroundThreadNormalTask));
+		}
+	}
+}
+
+const FAGX_TerrainHeightSnapshot::FChunk& FAGX_TerrainHeightSnapshot::GetOrSampleChunk(
+	int32 ChunkIndex)
+{
+	check(ChunkIndex >= 0 && ChunkIndex < NumChunks.X * NumChunks.Y);
+	std::atomic<FChunk*>& Slot = Chunks[ChunkIndex];
+	if (FChunk* Chunk = Slot.load(std::memory_order_acquire))
+		return *Chunk;
+
+	// Two threads may sample the same chunk at the same time. Both produce the same heights and
+	// the one that loses the race to publish discards its copy.
+	ChunkRequested[ChunkIndex].store(true, std::memory_order_relaxed);
+	FChunk* Sampled = SampleChunk(ChunkIndex);
+	FChunk* Expected = nullptr;
+	if (!Slot.compare_exchange_strong(
+			Expected, Sampled, std::memory_order_acq_rel, std::memory_order_acquire))
+	{
+		delete Sampled;
+		return *Expected;
+	}
+	return *Sampled;
+}
+
+FAGX_TerrainHeightSnapshot::FChunk* FAGX_TerrainHeightSnapshot::SampleChunk(
+	int32 ChunkIndex) const
+{
+	using namespace AGX_TerrainHeightSnapshot_helpers;
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("AGXUnreal:FAGX_TerrainHeightSnapshot::SampleChunk"));
+
+	const int32 ChunkX = ChunkIndex % NumChunks.X;
+	const int32 ChunkY = ChunkIndex / NumChunks.X;
+	const int32 FirstX = ChunkX * ChunkSize;
+	const int32 FirstY = ChunkY * ChunkSize;
+	const int32 NumX = FMath::Min(ChunkSize, NumVertices.X - FirstX);
+	const int32 NumY = FMath::Min(ChunkSize, NumVertices.Y - FirstY);
+
+	FChunk* Chunk = new FChunk();
+	Chunk->Heights.SetNumZeroed(ChunkSize * ChunkSize);
+
+	// Each row writes to its own part of the heights array, so rows can be sampled in parallel.
+	ParallelFor(
+		NumY,
+		[&](int32 LocalY)
+		{
+			const int32 Y = CornerMin.Y + FirstY + LocalY;
+			for (int32 LocalX = 0; LocalX < NumX; ++LocalX)
+			{
+				const int32 X = CornerMin.X + FirstX + LocalX;
+				const FVector SamplePosLocal(X * QuadSize.X, Y * QuadSize.Y, 0.0);
+				const FVector SamplePosGlobal =
+					LandscapeTransform.TransformPositionNoScale(SamplePosLocal);
+
+				float Height = FallbackHeight;
+				if (auto LandscapeHeight = Landscape->GetHeightAtLocation(SamplePosGlobal))
+				{
+					Height = LandscapeTransform
+								 .InverseTransformPositionNoScale(FVector(
+									 SamplePosGlobal.X, SamplePosGlobal.Y, *LandscapeHeight))
+								 .Z;
+				}
+				else
+				{
+					UE_LOG(
+						LogAGX, Warning,
+						TEXT("Height read unsuccessful in Terrain. World sample pos: %s"),
+						*SamplePosGlobal.ToString());
+				}
+				Chunk->Heights[LocalX + LocalY * ChunkSize] = Height;
+			}
+		});
+
+	return Chunk;
+}
+
+void FAGX_TerrainHeightSnapshot::ReleaseChunks()
+{
+	const int32 NumChunksTotal = NumChunks.X * NumChunks.Y;
+	for (int32 I = 0; I < NumChunksTotal; ++I)
+	{
+		delete Chunks[I].exchange(nullptr, std::memory_order_acq_rel);
+	}
+}
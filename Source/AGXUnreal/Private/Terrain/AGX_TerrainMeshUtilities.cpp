@@ -396,3 +396,82 @@ float UAGX_TerrainMeshUtilities::GetBedHeight(
 
 	return h;
 }
+
+void FAGX_MeshTileBins::Init(const HeightMesh& Mesh, double Margin)
+{
+	// Upper limit on the number of cells along each axis, to bound the memory used by very fine
+	// tilings.
+	constexpr int32 MaxCellsPerAxis = 256;
+
+	Bounds.Init();
+	TileBoxes.Reset(Mesh.Tiles.Num());
+	Cells.Reset();
+	NumCells = FIntPoint(0, 0);
+
+	FVector2D MinTileSize(TNumericLimits<double>::Max());
+	const FVector2D Epsilon(Margin, Margin);
+	for (const MeshTile& Tile : Mesh.Tiles)
+	{
+		const FVector2D TilePlaneCenter(Tile.Center.X, Tile.Center.Y);
+		const FBox2D TileBox(
+			TilePlaneCenter - Tile.Size / 2 - Epsilon, TilePlaneCenter + Tile.Size / 2 + Epsilon);
+		TileBoxes.Add(TileBox);
+		Bounds += TileBox;
+		MinTileSize = FVector2D::Min(MinTileSize, TileBox.GetSize());
+	}
+
+	if (TileBoxes.Num() == 0)
+		return;
+
+	const FVector2D BoundsSize = Bounds.GetSize();
+	NumCells.X = FMath::Clamp(
+		FMath::CeilToInt(BoundsSize.X / FMath::Max(MinTileSize.X, UE_KINDA_SMALL_NUMBER)), 1,
+		MaxCellsPerAxis);
+	NumCells.Y = FMath::Clamp(
+		FMath::CeilToInt(BoundsSize.Y / FMath::Max(MinTileSize.Y, UE_KINDA_SMALL_NUMBER)), 1,
+		MaxCellsPerAxis);
+	CellSize = FVector2D(BoundsSize.X / NumCells.X, BoundsSize.Y / NumCells.Y);
+	Cells.SetNum(NumCells.X * NumCells.Y);
+
+	auto ToCell = [this](const FVector2D& Position)
+	{
+		const FVector2D Cell = (Position - Bounds.Min) / CellSize;
+		return FIntPoint(
+			FMath::Clamp(FMath::FloorToInt(Cell.X), 0, NumCells.X - 1),
+			FMath::Clamp(FMath::FloorToInt(Cell.Y), 0, NumCells.Y - 1));
+	};
+
+	for (int32 TileIndex = 0; TileIndex < TileBoxes.Num(); ++TileIndex)
+	{
+		const FIntPoint Min = ToCell(TileBoxes[TileIndex].Min);
+		const FIntPoint Max = ToCell(TileBoxes[TileIndex].Max);
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				Cells[Y * NumCells.X + X].Add(TileIndex);
+			}
+		}
+	}
+}
+
+int32 FAGX_MeshTileBins::NumTiles() const
+{
+	return TileBoxes.Num();
+}
+
+void FAGX_MeshTileBins::MarkTiles(const FVector2D& Position, TBitArray<>& OutTiles) const
+{
+	check(OutTiles.Num() == TileBoxes.Num());
+	if (Cells.Num() == 0 || !Bounds.IsInside(Position))
+		return;
+
+	const FVector2D Cell = (Position - Bounds.Min) / CellSize;
+	const int32 X = FMath::Clamp(FMath::FloorToInt(Cell.X), 0, NumCells.X - 1);
+	const int32 Y = FMath::Clamp(FMath::FloorToInt(Cell.Y), 0, NumCells.Y - 1);
+	for (int32 TileIndex : Cells[Y * NumCells.X + X])
+	{
+		if (!OutTiles[TileIndex] && TileBoxes[TileIndex].IsInside(Position))
+			OutTiles[TileIndex] = true;
+	}
+}
@@ -6,9 +6,14 @@
 #include "AGX_LogCategory.h"
 #include "Terrain/AGX_Terrain.h"
 #include "Terrain/AGX_MovableTerrainComponent.h"
+#include "Terrain/ParticleRendering/AGX_UpsamplingParticleRendererComponent.h"
+#include "Terrain/ParticleRendering/ParticleUpsamplingDataHandler.h"
 #include "Utilities/AGX_StringUtilities.h"
 
 // Unreal Engine includes.
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Async/ParallelFor.h"
 #include "Components/ActorComponent.h"
 #include "Components/SceneComponent.h"
 #include "NiagaraComponent.h"
@@ -94,6 +99,165 @@ UAGX_MovableTerrainComponent* AGX_ParticleRenderingUtilities::GetParentMovableTe
 	return MovableTerrainComponent;
 }
 
+int32 AGX_ParticleRenderingUtilities::AddParticleDataSubscription(
+	USceneComponent& Renderer, EParticleDataFlags Fields, FAGX_ParticleDataCallback Callback)
+{
+	if (AAGX_Terrain* Terrain = GetParentTerrainActor(&Renderer, /*SkipWarnings*/ true))
+	{
+		return Terrain->AddParticleDataSubscription(Fields, 0.0, MoveTemp(Callback));
+	}
+
+	if (UAGX_MovableTerrainComponent* MovableTerrain =
+			GetParentMovableTerrainComponent(Renderer, /*SkipWarnings*/ true))
+	{
+		return MovableTerrain->AddParticleDataSubscription(Fields, 0.0, MoveTemp(Callback));
+	}
+
+	return INDEX_NONE;
+}
+
+void AGX_ParticleRenderingUtilities::RemoveParticleDataSubscription(
+	USceneComponent& Renderer, int32 SubscriptionId)
+{
+	if (SubscriptionId == INDEX_NONE)
+		return;
+
+	if (AAGX_Terrain* Terrain = GetParentTerrainActor(&Renderer, /*SkipWarnings*/ true))
+	{
+		Terrain->RemoveParticleDataSubscription(SubscriptionId);
+	}
+	else if (
+		UAGX_MovableTerrainComponent* MovableTerrain =
+			GetParentMovableTerrainComponent(Renderer, /*SkipWarnings*/ true))
+	{
+		MovableTerrain->RemoveParticleDataSubscription(SubscriptionId);
+	}
+}
+
+namespace AGX_ParticleRenderingUtilities_helpers
+{
+	constexpr int32 VoxelKeyBits = 21;
+	constexpr int32 VoxelKeyOffset = 1 << (VoxelKeyBits - 1);
+	constexpr uint64 VoxelKeyMask = (uint64(1) << VoxelKeyBits) - 1;
+
+	uint64 PackVoxelKey(const FIntVector& Voxel)
+	{
+		return (uint64(Voxel.X + VoxelKeyOffset) & VoxelKeyMask) << (2 * VoxelKeyBits) |
+			   (uint64(Voxel.Y + VoxelKeyOffset) & VoxelKeyMask) << VoxelKeyBits |
+			   (uint64(Voxel.Z + VoxelKeyOffset) & VoxelKeyMask);
+	}
+
+	FIntVector4 UnpackVoxelKey(uint64 Key)
+	{
+		return FIntVector4(
+			int32((Key >> (2 * VoxelKeyBits)) & VoxelKeyMask) - VoxelKeyOffset,
+			int32((Key >> VoxelKeyBits) & VoxelKeyMask) - VoxelKeyOffset,
+			int32(Key & VoxelKeyMask) - VoxelKeyOffset, 0);
+	}
+
+	/**
+	 * Append the packed indices of the voxels that the bounding box of a coarse particle
+	 * intersects with.
+	 */
+	void AppendActiveVoxelKeys(
+		TArray<uint64>& OutKeys, const FVector& Position, float Radius, float VoxelSize)
+	{
+		const float AABBRadius = VOLUME_MOD * Radius / 2;
+		const FVector VSPosition = Position / VoxelSize;
+
+		FVector OffsetPosition(
+			FMath::Sign(VSPosition.X), FMath::Sign(VSPosition.Y), FMath::Sign(VSPosition.Z));
+		OffsetPosition *= 0.5;
+		OffsetPosition += VSPosition;
+
+		const FVector VSParticleVoxelPos(
+			(double) (int) OffsetPosition.X, (double) (int) OffsetPosition.Y,
+			(double) (int) OffsetPosition.Z);
+
+		const FVector VSVoxelSize2(0.5);
+		const int n = (int) (AABBRadius / VoxelSize + 1);
+		for (int x = -n; x <= n; x++)
+		{
+			for (int y = -n; y <= n; y++)
+			{
+				for (int z = -n; z <= n; z++)
+				{
+					FVector VSVoxelPos = VSParticleVoxelPos + FVector(x, y, z);
+					const FVector VSVoxelToParticle = VSPosition - VSVoxelPos;
+					const FVector VSToEdge = FVector::Max(VSVoxelToParticle, -VSVoxelToParticle) -
+											 AABBRadius / VoxelSize;
+					if (FVector::Max(VSToEdge, VSVoxelSize2) == VSVoxelSize2)
+					{
+						VSVoxelPos += FVector(
+										  FMath::Sign(VSVoxelPos.X), FMath::Sign(VSVoxelPos.Y),
+										  FMath::Sign(VSVoxelPos.Z)) *
+									  0.5;
+						OutKeys.Add(PackVoxelKey(FIntVector(VSVoxelPos)));
+					}
+				}
+			}
+		}
+	}
+
+	/// Sort and remove duplicates, in place.
+	void SortUnique(TArray<uint64>& Keys)
+	{
+		Algo::Sort(Keys);
+		const int32 NumUnique = Algo::Unique(Keys);
+		Keys.SetNum(NumUnique, EAllowShrinking::No);
+	}
+}
+
+void AGX_ParticleRenderingUtilities::GetActiveVoxels(
+	TArrayView<const FCoarseParticle> Particles, float VoxelSize,
+	FAGX_ActiveVoxelsBuffers& Buffers, TArray<FIntVector4>& OutActiveVoxels)
+{
+	using namespace AGX_ParticleRenderingUtilities_helpers;
+
+	// Below this many particles per task the cost of waking worker threads is larger than the
+	// gain.
+	constexpr int32 ParticlesPerTask = 1024;
+	const int32 NumParticles = Particles.Num();
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumParticles, ParticlesPerTask);
+	Buffers.TaskVoxelKeys.SetNum(NumTasks);
+
+	// Each task collects the voxels of a contiguous range of particles. Neighboring particles
+	// share most of their voxels, so deduplicating within the task makes the final merge small.
+	ParallelFor(
+		NumTasks,
+		[&](int32 Task)
+		{
+			TArray<uint64>& Keys = Buffers.TaskVoxelKeys[Task];
+			Keys.Reset();
+			const int32 Begin = Task * ParticlesPerTask;
+			const int32 End = FMath::Min(Begin + ParticlesPerTask, NumParticles);
+			for (int32 I = Begin; I < End; ++I)
+			{
+				const FVector4f& PositionAndRadius = Particles[I].PositionAndRadius;
+				AppendActiveVoxelKeys(
+					Keys, FVector(PositionAndRadius), PositionAndRadius.W, VoxelSize);
+			}
+			SortUnique(Keys);
+		},
+		NumTasks < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	Buffers.VoxelKeys.Reset();
+	for (const TArray<uint64>& Keys : Buffers.TaskVoxelKeys)
+	{
+		Buffers.VoxelKeys.Append(Keys);
+	}
+	if (NumTasks > 1)
+	{
+		SortUnique(Buffers.VoxelKeys);
+	}
+
+	OutActiveVoxels.SetNumUninitialized(Buffers.VoxelKeys.Num(), EAllowShrinking::No);
+	for (int32 I = 0; I < Buffers.VoxelKeys.Num(); ++I)
+	{
+		OutActiveVoxels[I] = UnpackVoxelKey(Buffers.VoxelKeys[I]);
+	}
+}
+
 UNiagaraComponent* AGX_ParticleRenderingUtilities::InitializeNiagaraParticleSystemComponent(
 	UNiagaraSystem* ParticleSystemAsset, UActorComponent* ActorComponent)
 {
@@ -118,12 +118,13 @@ void UAGX_ParticleUpsamplingDI::ProvidePerInstanceDataForRenderThread(
 	FParticleUpsamplingDIProxy::ProvidePerInstanceDataForRenderThread(DataForRenderThread, PerInstanceData, SystemInstance);
 }
 
-void UAGX_ParticleUpsamplingDI::SetCoarseParticles(TArray<FCoarseParticle> NewCoarseParticles)
+void UAGX_ParticleUpsamplingDI::SetCoarseParticles(
+	const TArray<FCoarseParticle>& NewCoarseParticles)
 {
 	LocalData.CoarseParticles = NewCoarseParticles;
 }
 
-void UAGX_ParticleUpsamplingDI::SetActiveVoxelIndices(TArray<FIntVector4> AVIs)
+void UAGX_ParticleUpsamplingDI::SetActiveVoxelIndices(const TArray<FIntVector4>& AVIs)
 {
 	LocalData.ActiveVoxelIndices = AVIs;
 }
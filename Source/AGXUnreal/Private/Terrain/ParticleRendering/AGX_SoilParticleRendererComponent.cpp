@@ -16,6 +16,7 @@
 #include "NiagaraDataInterfaceArrayFunctionLibrary.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraDataInterfaceArray.h"
+#include "NiagaraSystem.h"
 #include "NiagaraSystemInstance.h"
 #include "NiagaraEmitterInstance.h"
 #include "NiagaraSystemInstanceController.h"
@@ -32,28 +33,12 @@ void UAGX_SoilParticleRendererComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Bind to terrain data delegate from either a Terrain Actor or Movable Terrain Component.
-	bool IsTerrainDataBound = false;
-	if (auto ParentTerrainActor =
-			AGX_ParticleRenderingUtilities::GetParentTerrainActor(this, /*SkipWarnings*/ true))
-	{
-		ParentTerrainActor->OnParticleData.AddDynamic(
-			this, &UAGX_SoilParticleRendererComponent::HandleParticleData);
-		IsTerrainDataBound = true;
-	}
-	else // No Terrain Actor found.
-	{
-		if (auto ParentMovableTerrain =
-				AGX_ParticleRenderingUtilities::GetParentMovableTerrainComponent(
-					*this, /*SkipWarnings*/ true))
-		{
-			ParentMovableTerrain->OnParticleData.AddDynamic(
-				this, &UAGX_SoilParticleRendererComponent::HandleParticleData);
-			IsTerrainDataBound = true;
-		}
-	}
-
-	if (!IsTerrainDataBound)
+	// Subscribe to particle data from either a Terrain Actor or Movable Terrain Component.
+	ResolveNiagaraBindings(ParticleSystemAsset);
+	ParticleDataSubscriptionId = AGX_ParticleRenderingUtilities::AddParticleDataSubscription(
+		*this, NiagaraBindings.GetFields(),
+		FAGX_ParticleDataCallback::CreateUObject(this, &ThisClass::HandleParticleData));
+	if (ParticleDataSubscriptionId == INDEX_NONE)
 	{
 		const FString Msg = FString::Printf(
 			TEXT("UAGX_SoilParticleRendererComponent '%s' in '%s' was unable to "
@@ -74,6 +59,14 @@ void UAGX_SoilParticleRendererComponent::BeginPlay()
 	ParticleSystemComponent->SetActive(bEnableParticleRendering);
 }
 
+void UAGX_SoilParticleRendererComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	AGX_ParticleRenderingUtilities::RemoveParticleDataSubscription(
+		*this, ParticleDataSubscriptionId);
+	ParticleDataSubscriptionId = INDEX_NONE;
+	Super::EndPlay(EndPlayReason);
+}
+
 void UAGX_SoilParticleRendererComponent::SetEnableParticleRendering(bool bEnabled)
 {
 	if (ParticleSystemComponent)
@@ -83,6 +76,7 @@ void UAGX_SoilParticleRendererComponent::SetEnableParticleRendering(bool bEnable
 	}
 
 	bEnableParticleRendering = bEnabled;
+	bNiagaraParticleDataDirty = true;
 }
 
 bool UAGX_SoilParticleRendererComponent::GetEnableParticleRendering() const
@@ -100,13 +94,8 @@ const UNiagaraComponent* UAGX_SoilParticleRendererComponent::GetParticleSystemCo
 	return ParticleSystemComponent;
 }
 
-void UAGX_SoilParticleRendererComponent::HandleParticleData(FDelegateParticleData& Data)
+namespace AGX_SoilParticleRendererComponent_helpers
 {
-	if (ParticleSystemComponent == nullptr || !bEnableParticleRendering)
-	{
-		return;
-	}
-
 	static const FName PositionsAndRadiiName {TEXT("User.Positions And Radii")};
 	static const FName VelocitiesAndMassesName {TEXT("User.Velocities And Masses")};
 	static const FName OrientationsName {TEXT("User.Orientations")};
@@ -116,49 +105,174 @@ void UAGX_SoilParticleRendererComponent::HandleParticleData(FDelegateParticleDat
 	static const FName Vector4ArrayName {TEXT("NiagaraDataInterfaceArrayFloat4")};
 	static const FName BoolArrayName {TEXT("NiagaraDataInterfaceArrayBool")};
 	static const FName Int32Name {TEXT("NiagaraInt32")};
+}
 
-	const FNiagaraParameterStore& UserParams = ParticleSystemComponent->GetOverrideParameters();
-	TArray<FNiagaraVariable> Params;
-	UserParams.GetParameters(Params);
+EParticleDataFlags UAGX_SoilParticleRendererComponent::FNiagaraBindings::GetFields() const
+{
+	std::underlying_type<EParticleDataFlags>::type Fields = 0;
+	if (bPositionsAndRadii)
+		Fields |= EParticleDataFlags::Positions | EParticleDataFlags::Radii;
+	if (bOrientations)
+		Fields |= EParticleDataFlags::Rotations;
+	if (bVelocitiesAndMasses)
+		Fields |= EParticleDataFlags::Velocities | EParticleDataFlags::Masses;
+	return static_cast<EParticleDataFlags>(Fields);
+}
 
-	// Check for the default particle system parameters.
-	// Otherwise the engine throws warnings each time we set them...
-	for (FNiagaraVariable& Param : Params)
+void UAGX_SoilParticleRendererComponent::ResolveNiagaraBindings(const UNiagaraSystem* System)
+{
+	using namespace AGX_SoilParticleRendererComponent_helpers;
+
+	NiagaraBindings = FNiagaraBindings();
+	NiagaraBindings.System = System;
+	bNiagaraParticleDataDirty = true;
+	if (System == nullptr)
+		return;
+
+	// Only bind the parameters that the Niagara System declares, otherwise the engine throws
+	// warnings each time we set them...
+	TArray<FNiagaraVariable> Params;
+	System->GetExposedParameters().GetParameters(Params);
+	for (const FNiagaraVariable& Param : Params)
 	{
 		const FName ParamName = Param.GetName();
 		const FName ParamType = Param.GetType().GetFName();
-
 		if (ParamType == Vector4ArrayName)
 		{
-			if (ParamName == PositionsAndRadiiName)
-			{
-				UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
-					ParticleSystemComponent, ParamName, Data.PositionsAndRadii);
-			}
-			else if (ParamName == OrientationsName)
-			{
-				UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
-					ParticleSystemComponent, ParamName, Data.Orientations);
-			}
-			else if (ParamName == VelocitiesAndMassesName)
+			NiagaraBindings.bPositionsAndRadii |= ParamName == PositionsAndRadiiName;
+			NiagaraBindings.bOrientations |= ParamName == OrientationsName;
+			NiagaraBindings.bVelocitiesAndMasses |= ParamName == VelocitiesAndMassesName;
+		}
+		else if (ParamType == BoolArrayName)
+		{
+			NiagaraBindings.bExists |= ParamName == ExistsName;
+		}
+		else if (ParamType == Int32Name)
+		{
+			NiagaraBindings.bParticleCount |= ParamName == ParticleCountName;
+		}
+	}
+}
+
+namespace AGX_SoilParticleRendererComponent_helpers
+{
+	/**
+	 * Write the packed value of each particle into Buffer, skipping elements that already hold the
+	 * right value. Returns true if anything in Buffer was changed.
+	 */
+	template <typename FPackFunc>
+	bool PackIfChanged(TArray<FVector4>& Buffer, int32 NumParticles, FPackFunc Pack)
+	{
+		bool bChanged = Buffer.Num() != NumParticles;
+		Buffer.SetNumUninitialized(NumParticles, EAllowShrinking::No);
+		for (int32 I = 0; I < NumParticles; ++I)
+		{
+			const FVector4 Value = Pack(I);
+			if (Buffer[I] != Value)
 			{
-				UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
-					ParticleSystemComponent, ParamName, Data.VelocitiesAndMasses);
+				Buffer[I] = Value;
+				bChanged = true;
 			}
 		}
-		else if (ParamName == ExistsName && ParamType == BoolArrayName)
+		return bChanged;
+	}
+}
+
+void UAGX_SoilParticleRendererComponent::HandleParticleData(const FParticleDataById& ParticleData)
+{
+	using namespace AGX_SoilParticleRendererComponent_helpers;
+
+	if (ParticleSystemComponent == nullptr || !bEnableParticleRendering)
+	{
+		return;
+	}
+
+	// The Niagara System may have been replaced since the bindings were resolved. If the new
+	// system needs other particle data then the subscription is replaced, and the new fields
+	// arrive from the next update.
+	const UNiagaraSystem* System = ParticleSystemComponent->GetAsset();
+	if (NiagaraBindings.System.Get() != System)
+	{
+		const EParticleDataFlags OldFields = NiagaraBindings.GetFields();
+		ResolveNiagaraBindings(System);
+		if (NiagaraBindings.GetFields() != OldFields)
 		{
-			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayBool(
-				ParticleSystemComponent, ParamName, Data.Exists);
+			AGX_ParticleRenderingUtilities::RemoveParticleDataSubscription(
+				*this, ParticleDataSubscriptionId);
+			ParticleDataSubscriptionId = AGX_ParticleRenderingUtilities::AddParticleDataSubscription(
+				*this, NiagaraBindings.GetFields(),
+				FAGX_ParticleDataCallback::CreateUObject(this, &ThisClass::HandleParticleData));
 		}
-		else if (ParamName == ParticleCountName && ParamType == Int32Name)
+	}
+
+	const int32 NumParticles = ParticleData.Exists.Num();
+	FDelegateParticleData& Data = NiagaraParticleData;
+	const bool bForce = bNiagaraParticleDataDirty;
+	bNiagaraParticleDataDirty = false;
+
+	// Each array parameter is packed in place into the buffer from the previous frame and only
+	// passed on to Niagara, which makes a copy of its own, if any element changed. Only the fields
+	// requested by the subscription are populated, so a parameter is only written if its source
+	// arrays are.
+	if (NiagaraBindings.bPositionsAndRadii && ParticleData.Positions.Num() == NumParticles &&
+		ParticleData.Radii.Num() == NumParticles)
+	{
+		const bool bChanged = PackIfChanged(
+			Data.PositionsAndRadii, NumParticles,
+			[&ParticleData](int32 I)
+			{ return FVector4(ParticleData.Positions[I], ParticleData.Radii[I]); });
+		if (bChanged || bForce)
 		{
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
+				ParticleSystemComponent, PositionsAndRadiiName, Data.PositionsAndRadii);
+		}
+	}
+
+	if (NiagaraBindings.bOrientations && ParticleData.Rotations.Num() == NumParticles)
+	{
+		const bool bChanged = PackIfChanged(
+			Data.Orientations, NumParticles,
+			[&ParticleData](int32 I)
+			{
+				const FQuat& Rotation = ParticleData.Rotations[I];
+				return FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+			});
+		if (bChanged || bForce)
+		{
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
+				ParticleSystemComponent, OrientationsName, Data.Orientations);
+		}
+	}
+
+	if (NiagaraBindings.bVelocitiesAndMasses && ParticleData.Velocities.Num() == NumParticles &&
+		ParticleData.Masses.Num() == NumParticles)
+	{
+		const bool bChanged = PackIfChanged(
+			Data.VelocitiesAndMasses, NumParticles,
+			[&ParticleData](int32 I)
+			{ return FVector4(ParticleData.Velocities[I], ParticleData.Masses[I]); });
+		if (bChanged || bForce)
+		{
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector4(
+				ParticleSystemComponent, VelocitiesAndMassesName, Data.VelocitiesAndMasses);
+		}
+	}
+
+	if (NiagaraBindings.bExists && (bForce || Data.Exists != ParticleData.Exists))
+	{
+		Data.Exists = ParticleData.Exists;
+		UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayBool(
+			ParticleSystemComponent, ExistsName, Data.Exists);
+	}
+
+	if (NiagaraBindings.bParticleCount && (bForce || Data.ParticleCount != NumParticles))
+	{
+		Data.ParticleCount = NumParticles;
 #if UE_VERSION_OLDER_THAN(5, 3, 0)
-			ParticleSystemComponent->SetNiagaraVariableInt(ParamName, Data.ParticleCount);
+		ParticleSystemComponent->SetNiagaraVariableInt(ParticleCountName, Data.ParticleCount);
 #else
-			ParticleSystemComponent->SetVariableInt(ParamName, Data.ParticleCount);
+		ParticleSystemComponent->SetVariableInt(ParticleCountName, Data.ParticleCount);
 #endif
-		}
 	}
 }
 
@@ -34,30 +34,27 @@ void UAGX_UpsamplingParticleRendererComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Bind to terrain data delegate from either a Terrain Actor or Movable Terrain Component.
-	bool IsTerrainDataBound = false;
+	// Subscribe to particle data from either a Terrain Actor or Movable Terrain Component.
 	if (auto ParentTerrainActor =
 			AGX_ParticleRenderingUtilities::GetParentTerrainActor(this, /*SkipWarnings*/ true))
 	{
-		ParentTerrainActor->OnParticleData.AddDynamic(
-			this, &UAGX_UpsamplingParticleRendererComponent::HandleParticleData);
 		ElementSize = ParentTerrainActor->SourceLandscape->GetActorScale().X;
-		IsTerrainDataBound = true;
 	}
-	else // No Terrain Actor found.
+	else if (
+		auto ParentMovableTerrain =
+			AGX_ParticleRenderingUtilities::GetParentMovableTerrainComponent(
+				*this, /*SkipWarnings*/ true))
 	{
-		if (auto ParentMovableTerrain =
-				AGX_ParticleRenderingUtilities::GetParentMovableTerrainComponent(
-					*this, /*SkipWarnings*/ true))
-		{
-			ParentMovableTerrain->OnParticleData.AddDynamic(
-				this, &UAGX_UpsamplingParticleRendererComponent::HandleParticleData);
-			ElementSize = ParentMovableTerrain->ElementSize;
-			IsTerrainDataBound = true;
-		}
+		ElementSize = ParentMovableTerrain->ElementSize;
 	}
 
-	if (!IsTerrainDataBound)
+	// Rotations are not used by the upsampling.
+	const EParticleDataFlags Fields = EParticleDataFlags::Positions | EParticleDataFlags::Radii |
+									  EParticleDataFlags::Velocities | EParticleDataFlags::Masses;
+	ParticleDataSubscriptionId = AGX_ParticleRenderingUtilities::AddParticleDataSubscription(
+		*this, Fields,
+		FAGX_ParticleDataCallback::CreateUObject(this, &ThisClass::HandleParticleData));
+	if (ParticleDataSubscriptionId == INDEX_NONE)
 	{
 		const FString Msg = FString::Printf(
 			TEXT("UAGX_UpsamplingParticleRendererComponent '%s' in '%s' was unable to "
@@ -92,6 +89,14 @@ void UAGX_UpsamplingParticleRendererComponent::BeginPlay()
 	}
 }
 
+void UAGX_UpsamplingParticleRendererComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	AGX_ParticleRenderingUtilities::RemoveParticleDataSubscription(
+		*this, ParticleDataSubscriptionId);
+	ParticleDataSubscriptionId = INDEX_NONE;
+	Super::EndPlay(EndPlayReason);
+}
+
 void UAGX_UpsamplingParticleRendererComponent::SetEnableParticleRendering(bool bEnabled)
 {
 	if (ParticleSystemComponent)
@@ -159,24 +164,32 @@ double UAGX_UpsamplingParticleRendererComponent::GetEaseStepSize() const
 	return EaseStepSize;
 }
 
-void UAGX_UpsamplingParticleRendererComponent::HandleParticleData(FDelegateParticleData& Data)
+void UAGX_UpsamplingParticleRendererComponent::HandleParticleData(
+	const FParticleDataById& Data)
 {
 	if (!ParticleSystemComponent || !UpsamplingDataInterface || !bEnableParticleRendering)
 	{
 		return;
 	}
 
-	TArray<FCoarseParticle> NewCoarseParticles;
-	TSet<FIntVector> ActiveVoxelSet;
+	const int32 NumParticles = Data.Exists.Num();
+	if (Data.Positions.Num() != NumParticles || Data.Radii.Num() != NumParticles ||
+		Data.Velocities.Num() != NumParticles || Data.Masses.Num() != NumParticles)
+	{
+		return;
+	}
+
+	CoarseParticles.Reset(NumParticles);
 	float ParticleDensity = 0.0f;
 	float UsedVoxelSize = (bOverrideVoxelSize ? VoxelSize : ElementSize);
 
-	for (int32 I = 0; I < Data.ParticleCount; ++I)
+	for (int32 I = 0; I < NumParticles; ++I)
 	{
 		if (!Data.Exists[I])
 			continue;
 
-		float Radius = Data.PositionsAndRadii[I].W;
+		const float Radius = Data.Radii[I];
+		const float Mass = Data.Masses[I];
 
 		/**
 		 * TODO: The density of the particles should be fetched by the terrain and not
@@ -185,28 +198,23 @@ void UAGX_UpsamplingParticleRendererComponent::HandleParticleData(FDelegateParti
 		 */
 		if (Radius > KINDA_SMALL_NUMBER)
 		{
-			ParticleDensity =
-				Data.VelocitiesAndMasses[I].W / UE::Geometry::TSphere3<float>::Volume(Radius);
+			ParticleDensity = Mass / UE::Geometry::TSphere3<float>::Volume(Radius);
 		}
 
-		FVector Position = FVector(
-			Data.PositionsAndRadii[I].X, Data.PositionsAndRadii[I].Y, Data.PositionsAndRadii[I].Z);
+		const FVector& Position = Data.Positions[I];
+		const FVector& Velocity = Data.Velocities[I];
 
-		AppendIfActiveVoxel(ActiveVoxelSet, Position, Radius, UsedVoxelSize);
-
-		FCoarseParticle CP;
+		FCoarseParticle& CP = CoarseParticles.AddDefaulted_GetRef();
 		CP.PositionAndRadius = FVector4f(Position.X, Position.Y, Position.Z, Radius);
-		CP.VelocityAndMass = FVector4f(
-			Data.VelocitiesAndMasses[I].X, Data.VelocitiesAndMasses[I].Y,
-			Data.VelocitiesAndMasses[I].Z, Data.VelocitiesAndMasses[I].W);
-		NewCoarseParticles.Add(CP);
+		CP.VelocityAndMass = FVector4f(Velocity.X, Velocity.Y, Velocity.Z, Mass);
 	}
 
 	if (ParticleDensity == 0.0f)
 		return;
 
-	TArray<FIntVector4> ActiveVoxelIndices = GetActiveVoxelsFromSet(ActiveVoxelSet);
-	UpsamplingDataInterface->SetCoarseParticles(NewCoarseParticles);
+	AGX_ParticleRenderingUtilities::GetActiveVoxels(
+		CoarseParticles, UsedVoxelSize, ActiveVoxelsBuffers, ActiveVoxelIndices);
+	UpsamplingDataInterface->SetCoarseParticles(CoarseParticles);
 	UpsamplingDataInterface->SetActiveVoxelIndices(ActiveVoxelIndices);
 	UpsamplingDataInterface->RecalculateFineParticleProperties(
 		Upsampling, ElementSize, ParticleDensity);
@@ -219,59 +227,6 @@ void UAGX_UpsamplingParticleRendererComponent::HandleParticleData(FDelegateParti
 	ParticleSystemComponent->SetVariableFloat(FName("User.Voxel Size"), UsedVoxelSize);
 }
 
-void UAGX_UpsamplingParticleRendererComponent::AppendIfActiveVoxel(
-	TSet<FIntVector>& ActiveVoxelIndices, FVector Position, float Radius, float SizeOfVoxel)
-{
-	float AABBRadius = VOLUME_MOD * Radius / 2;
-	FVector VSPosition = Position / SizeOfVoxel;
-
-	FVector OffsetPosition(
-		FMath::Sign(VSPosition.X), FMath::Sign(VSPosition.Y), FMath::Sign(VSPosition.Z));
-
-	OffsetPosition *= 0.5;
-	OffsetPosition += VSPosition;
-
-	FVector VSParticleVoxelPos(
-		(double) (int) OffsetPosition.X, (double) (int) OffsetPosition.Y,
-		(double) (int) OffsetPosition.Z);
-
-	int n = (int) (AABBRadius / SizeOfVoxel + 1);
-	for (int x = -n; x <= n; x++)
-	{
-		for (int y = -n; y <= n; y++)
-		{
-			for (int z = -n; z <= n; z++)
-			{
-				FVector VSVoxelPos = VSParticleVoxelPos + FVector(x, y, z);
-				FVector VSVoxelToParticle = VSPosition - VSVoxelPos;
-
-				FVector VSToEdge =
-					FVector::Max(VSVoxelToParticle, -VSVoxelToParticle) - AABBRadius / SizeOfVoxel;
-				FVector VSVoxelSize2(0.5);
-				if (FVector::Max(VSToEdge, VSVoxelSize2) == VSVoxelSize2)
-				{
-					VSVoxelPos += FVector(
-									  FMath::Sign(VSVoxelPos.X), FMath::Sign(VSVoxelPos.Y),
-									  FMath::Sign(VSVoxelPos.Z)) *
-								  0.5;
-					ActiveVoxelIndices.Add(FIntVector(VSVoxelPos));
-				}
-			}
-		}
-	}
-}
-
-TArray<FIntVector4> UAGX_UpsamplingParticleRendererComponent::GetActiveVoxelsFromSet(
-	TSet<FIntVector> VoxelSet)
-{
-	TArray<FIntVector4> ActiveVoxels;
-	for (FIntVector Voxel : VoxelSet)
-	{
-		ActiveVoxels.Add(FIntVector4(Voxel, 0));
-	}
-	return ActiveVoxels;
-}
-
 #if WITH_EDITOR
 
 void UAGX_UpsamplingParticleRendererComponent::PostEditChangeChainProperty(
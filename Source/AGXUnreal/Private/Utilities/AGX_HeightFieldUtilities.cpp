@@ -5,15 +5,26 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_Check.h"
 #include "AGX_LogCategory.h"
+#include "AGX_Simulation.h"
 
 // Unreal Engine includes.
+#include "Async/ParallelFor.h"
 #include "GenericPlatform/GenericPlatformMisc.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProperties.h"
 #include "Landscape.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "LandscapeInfo.h"
 #include "LandscapeProxy.h"
 #include "Math/UnrealMathUtility.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 
 // Standard library includes.
+#include <atomic>
 #include <limits>
 
 namespace AGX_HeightFieldUtilities_helpers
@@ -131,24 +142,83 @@ namespace AGX_HeightFieldUtilities_helpers
 		return false;
 	}
 
+	// The vertex grid that heights are read for, in the Landscape's local coordinate system.
+	struct FHeightGrid
+	{
+		FVector StartPosLocal;
+		double LengthY;
+		double QuadSideSizeX;
+		double QuadSideSizeY;
+		int32 VerticesSideX;
+		int32 VerticesSideY;
+
+		int32 Num() const
+		{
+			return VerticesSideX * VerticesSideY;
+		}
+
+		// AGX terrains Y axis goes in the opposite direction from Unreal's Y axis (flipped), so
+		// row zero is at the largest Y.
+		double GetX(int32 Column) const
+		{
+			return StartPosLocal.X + Column * QuadSideSizeX;
+		}
+
+		double GetY(int32 Row) const
+		{
+			return StartPosLocal.Y + LengthY - Row * QuadSideSizeY;
+		}
+	};
+
+	FHeightGrid GetHeightGrid(
+		const ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+	{
+		FHeightGrid Grid;
+		Grid.StartPosLocal =
+			Landscape.GetActorTransform().InverseTransformPositionNoScale(StartPos);
+		Grid.LengthY = LengthY;
+		Grid.QuadSideSizeX = Landscape.GetActorScale().X;
+		Grid.QuadSideSizeY = Landscape.GetActorScale().Y;
+		Grid.VerticesSideX = FMath::RoundToInt(LengthX / Grid.QuadSideSizeX) + 1;
+		Grid.VerticesSideY = FMath::RoundToInt(LengthY / Grid.QuadSideSizeY) + 1;
+		return Grid;
+	}
+
+	/**
+	 * Call ReadRows(FirstRow, EndRow) for blocks of rows covering the whole grid, in parallel
+	 * unless bParallel is false.
+	 */
+	template <typename FReadRowsFunc>
+	void ForEachRowBlock(const FHeightGrid& Grid, bool bParallel, FReadRowsFunc ReadRows)
+	{
+		// Reading a vertex is relatively expensive, so blocks can be small without the task
+		// overhead becoming noticeable.
+		constexpr int32 RowsPerTask = 16;
+		const int32 NumTasks = FMath::DivideAndRoundUp(Grid.VerticesSideY, RowsPerTask);
+		ParallelFor(
+			NumTasks,
+			[&](int32 Task)
+			{
+				const int32 FirstRow = Task * RowsPerTask;
+				ReadRows(FirstRow, FMath::Min(FirstRow + RowsPerTask, Grid.VerticesSideY));
+			},
+			bParallel && NumTasks > 1 ? EParallelForFlags::None
+									  : EParallelForFlags::ForceSingleThread);
+	}
+
 	// This function should only be used if the landscape is not rotated around world x or y axis.
 	// The reason for this is that the Landscape.GetHeightAtLocation does not handle that case. It
 	// will measure along the world z-axis (instead of the Landscapes local z-axis as it should)
 	// such that sharp peaks will be cut off and tilted.
 	TArray<float> GetHeigtsUsingApi(
-		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		bool bParallel)
 	{
 		UE_LOG(LogAGX, Log, TEXT("About to read Landscape heights using Landscape API."));
 
-		const auto QuadSideSizeX = Landscape.GetActorScale().X;
-		const auto QuadSideSizeY = Landscape.GetActorScale().Y;
-		const int32 ResolutionX = FMath::RoundToInt(LengthX / QuadSideSizeX);
-		const int32 ResolutionY = FMath::RoundToInt(LengthY / QuadSideSizeY);
-		const int32 VerticesSideX = ResolutionX + 1;
-		const int32 VerticesSideY = ResolutionY + 1;
-
+		const FHeightGrid Grid = GetHeightGrid(Landscape, StartPos, LengthX, LengthY);
 		TArray<float> Heights;
-		const int32 NumVertices = VerticesSideX * VerticesSideY;
+		const int32 NumVertices = Grid.Num();
 		if (NumVertices <= 0)
 		{
 			UE_LOG(
@@ -159,65 +229,67 @@ namespace AGX_HeightFieldUtilities_helpers
 			return Heights;
 		}
 
-		Heights.Reserve(NumVertices);
-		const FVector StartPosLocal =
-			Landscape.GetActorTransform().InverseTransformPositionNoScale(StartPos);
-
-		// AGX terrains Y axis goes in the opposite direction from Unreal's Y axis (flipped).
+		Heights.SetNumUninitialized(NumVertices);
+		const FVector StartPosLocal = Grid.StartPosLocal;
+		const FTransform& Transform = Landscape.GetTransform();
 		const double MaxX = StartPosLocal.X + LengthX;
 		const double MaxY = StartPosLocal.Y + LengthY;
-		double CurrentX = StartPosLocal.X;
-		double CurrentY = StartPosLocal.Y + LengthY;
-		const double NudgeDistanceX = QuadSideSizeX / 1000.0;
-		const double NudgeDistanceY = QuadSideSizeY / 1000.0;
-		const double ToleranceX = QuadSideSizeX / 2.0;
-		const double ToleranceY = QuadSideSizeY / 2.0;
-		while (CurrentY >= StartPosLocal.Y - ToleranceY)
-		{
-			while (CurrentX <= MaxX + ToleranceX)
+		const double NudgeDistanceX = Grid.QuadSideSizeX / 1000.0;
+		const double NudgeDistanceY = Grid.QuadSideSizeY / 1000.0;
+
+		// Each row block writes to its own part of Heights.
+		ForEachRowBlock(
+			Grid, bParallel,
+			[&](int32 FirstRow, int32 EndRow)
 			{
-				FVector LocationGlobal = Landscape.GetTransform().TransformPositionNoScale(
-					FVector(CurrentX, CurrentY, 0));
-				TOptional<float> Height = Landscape.GetHeightAtLocation(LocationGlobal);
-				if (!Height.IsSet())
+				for (int32 Row = FirstRow; Row < EndRow; ++Row)
 				{
-					// Attempt to nudge the measuring point a little and do the measurement again.
-					// We do this because sometimes, measuring at the edge of a Landscape does not
-					// work.
-					double NudgedX = CurrentX;
-					double NudgedY = CurrentY;
-					NudgePoint(
-						NudgedX, NudgedY, StartPosLocal.X, MaxX, StartPosLocal.Y, MaxY,
-						NudgeDistanceX, NudgeDistanceY);
-
-					LocationGlobal = Landscape.GetTransform().TransformPositionNoScale(
-						FVector(NudgedX, NudgedY, 0));
-					Height = Landscape.GetHeightAtLocation(LocationGlobal);
-				}
-				if (Height.IsSet())
-				{
-					// Position of height measurement in Landscapes local coordinate system.
-					FVector HeightPointLocal =
-						Landscape.GetTransform().InverseTransformPositionNoScale(
-							FVector(LocationGlobal.X, LocationGlobal.Y, *Height));
-					Heights.Add(HeightPointLocal.Z);
-				}
-				else
-				{
-					UE_LOG(
-						LogAGX, Error,
-						TEXT("Unexpected error: reading height from Landscape '%s' at location %f, "
-							 "%f, %f failed during AGX Heightfield initialization."),
-						*Landscape.GetName(), LocationGlobal.X, LocationGlobal.Y, LocationGlobal.Z);
-					Heights.Add(0.f);
+					const double CurrentY = Grid.GetY(Row);
+					for (int32 Column = 0; Column < Grid.VerticesSideX; ++Column)
+					{
+						const double CurrentX = Grid.GetX(Column);
+						FVector LocationGlobal =
+							Transform.TransformPositionNoScale(FVector(CurrentX, CurrentY, 0));
+						TOptional<float> Height = Landscape.GetHeightAtLocation(LocationGlobal);
+						if (!Height.IsSet())
+						{
+							// Attempt to nudge the measuring point a little and do the
+							// measurement again. We do this because sometimes, measuring at the
+							// edge of a Landscape does not work.
+							double NudgedX = CurrentX;
+							double NudgedY = CurrentY;
+							NudgePoint(
+								NudgedX, NudgedY, StartPosLocal.X, MaxX, StartPosLocal.Y, MaxY,
+								NudgeDistanceX, NudgeDistanceY);
+
+							LocationGlobal = Transform.TransformPositionNoScale(
+								FVector(NudgedX, NudgedY, 0));
+							Height = Landscape.GetHeightAtLocation(LocationGlobal);
+						}
+
+						float& OutHeight = Heights[Row * Grid.VerticesSideX + Column];
+						if (Height.IsSet())
+						{
+							// Position of height measurement in Landscapes local coordinate
+							// system.
+							FVector HeightPointLocal = Transform.InverseTransformPositionNoScale(
+								FVector(LocationGlobal.X, LocationGlobal.Y, *Height));
+							OutHeight = HeightPointLocal.Z;
+						}
+						else
+						{
+							UE_LOG(
+								LogAGX, Error,
+								TEXT("Unexpected error: reading height from Landscape '%s' at "
+									 "location %f, %f, %f failed during AGX Heightfield "
+									 "initialization."),
+								*Landscape.GetName(), LocationGlobal.X, LocationGlobal.Y,
+								LocationGlobal.Z);
+							OutHeight = 0.f;
+						}
+					}
 				}
-				CurrentX += QuadSideSizeX;
-			}
-			CurrentX = StartPosLocal.X;
-			CurrentY -= QuadSideSizeY;
-		}
-
-		check(NumVertices == Heights.Num());
+			});
 
 		return Heights;
 	}
@@ -226,22 +298,16 @@ namespace AGX_HeightFieldUtilities_helpers
 	// is slower but can handle any Landscape orientation, which is not the case for
 	// AGX_HeightFieldUtilities_helpers::GetHeigtsUsingApi (see comment above that function).
 	TArray<float> GetHeightsUsingRayCasts(
-		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		bool bParallel)
 	{
 		UE_LOG(LogAGX, Log, TEXT("About to read Landscape heights with ray casting."));
-		const auto QuadSideSizeX = Landscape.GetActorScale().X;
-		const auto QuadSideSizeY = Landscape.GetActorScale().Y;
-		const int32 ResolutionX = FMath::RoundToInt(LengthX / QuadSideSizeX);
-		const int32 ResolutionY = FMath::RoundToInt(LengthY / QuadSideSizeY);
-		const int32 VerticesSideX = ResolutionX + 1;
-		const int32 VerticesSideY = ResolutionY + 1;
-		const int32 NumVertices = VerticesSideX * VerticesSideY;
-		const FVector StartPosLocal =
-			Landscape.GetActorTransform().InverseTransformPositionNoScale(StartPos);
+		const FHeightGrid Grid = GetHeightGrid(Landscape, StartPos, LengthX, LengthY);
+		const int32 NumVertices = Grid.Num();
 
 		TArray<float> Heights;
-		Heights.Reserve(NumVertices);
-		int32 LineTraceMisses = 0;
+		Heights.SetNumUninitialized(NumVertices);
+		std::atomic<int32> LineTraceMisses {0};
 
 		// At scale = 1, the height span is +- 256 cm
 		// https://docs.unrealengine.com/en-US/Engine/Landscape/TechnicalGuide/#calculatingheightmapzscale
@@ -249,77 +315,141 @@ namespace AGX_HeightFieldUtilities_helpers
 
 		// Line traces will be used to measure the heights of the landscape.
 		const FCollisionQueryParams CollisionParams(FName(TEXT("LandscapeHeightFieldTracess")));
-		FHitResult HitResult(ForceInit);
 
-		// AGX terrains Y axis goes in the opposite direction from Unreal's Y axis (flipped).
-		const double MaxX = StartPosLocal.X + LengthX;
-		const double MaxY = StartPosLocal.Y + LengthY;
-		double CurrentX = StartPosLocal.X;
-		double CurrentY = StartPosLocal.Y + LengthY;
-		const double NudgeDistanceX = QuadSideSizeX / 1000.0;
-		const double NudgeDistanceY = QuadSideSizeY / 1000.0;
-		const double ToleranceX = QuadSideSizeX / 2.0;
-		const double ToleranceY = QuadSideSizeY / 2.0;
+		const double NudgeDistanceX = Grid.QuadSideSizeX / 1000.0;
+		const double NudgeDistanceY = Grid.QuadSideSizeY / 1000.0;
 		const double NudgeDistances[4][2] = {
 			{NudgeDistanceX, NudgeDistanceY},
 			{-NudgeDistanceX, -NudgeDistanceY},
 			{-NudgeDistanceX, NudgeDistanceY},
 			{NudgeDistanceX, -NudgeDistanceY}};
-		while (CurrentY >= StartPosLocal.Y - ToleranceY)
-		{
-			while (CurrentX <= MaxX + ToleranceX)
-			{
-				float Height = 0.0f;
 
-				// Use line trace to read the landscape height for this vertex.
-				bool Result = ShootSingleRay(
-					Landscape, CurrentX, CurrentY, HeightSpanHalf, CollisionParams, HitResult,
-					Height);
-
-				if (!Result)
+		// Each row block writes to its own part of Heights.
+		ForEachRowBlock(
+			Grid, bParallel,
+			[&](int32 FirstRow, int32 EndRow)
+			{
+				FHitResult HitResult(ForceInit);
+				int32 BlockMisses = 0;
+				for (int32 Row = FirstRow; Row < EndRow; ++Row)
 				{
-					// Line trace missed. This is unusual but has been observed with large
-					// landscapes at the seams between landscape components/sections, similar to
-					// line traces at the very edge being missed. Re-try the line trace but force
-					// the ray's intersection point to be nudged slightly.
-					for (int i = 0; i < 4; i++)
+					const double CurrentY = Grid.GetY(Row);
+					for (int32 Column = 0; Column < Grid.VerticesSideX; ++Column)
 					{
-						const double NudgedX = CurrentX + NudgeDistances[i][0];
-						const double NudgedY = CurrentY + NudgeDistances[i][1];
-						Result = ShootSingleRay(
-							Landscape, NudgedX, NudgedY, HeightSpanHalf, CollisionParams, HitResult,
-							Height);
-						if (Result)
-							break;
+						const double CurrentX = Grid.GetX(Column);
+						float Height = 0.0f;
+
+						// Use line trace to read the landscape height for this vertex.
+						bool Result = ShootSingleRay(
+							Landscape, CurrentX, CurrentY, HeightSpanHalf, CollisionParams,
+							HitResult, Height);
+
+						if (!Result)
+						{
+							// Line trace missed. This is unusual but has been observed with large
+							// landscapes at the seams between landscape components/sections,
+							// similar to line traces at the very edge being missed. Re-try the
+							// line trace but force the ray's intersection point to be nudged
+							// slightly.
+							for (int i = 0; i < 4; i++)
+							{
+								const double NudgedX = CurrentX + NudgeDistances[i][0];
+								const double NudgedY = CurrentY + NudgeDistances[i][1];
+								Result = ShootSingleRay(
+									Landscape, NudgedX, NudgedY, HeightSpanHalf, CollisionParams,
+									HitResult, Height);
+								if (Result)
+									break;
+							}
+						}
+
+						if (!Result)
+							BlockMisses++;
+
+						Heights[Row * Grid.VerticesSideX + Column] = Height;
 					}
 				}
+				LineTraceMisses += BlockMisses;
+			});
 
-				if (!Result)
-					LineTraceMisses++;
-
-				Heights.Add(Height);
-				CurrentX += QuadSideSizeX;
-			}
-			CurrentX = StartPosLocal.X;
-			CurrentY -= QuadSideSizeY;
-		}
-
-		check(Heights.Num() == NumVertices);
 		if (LineTraceMisses > 0)
 		{
 			UE_LOG(
 				LogAGX, Warning,
 				TEXT("%d of %d vertices could not be read from the landscape. The heights of the "
 					 "coresponding vertices in the AGX Terrain may therefore be incorrect."),
-				LineTraceMisses, NumVertices);
+				LineTraceMisses.load(), NumVertices);
 		}
 
 		return Heights;
 	}
+
+	// Bump when the format of the height cache files, or how heights are read, changes.
+	constexpr uint32 HeightCacheMagic = 0x48584741; // "AGXH".
+	constexpr uint32 HeightCacheVersion = 1;
+
+	FString GetHeightCacheFilePath(const FString& Key)
+	{
+		return FPaths::Combine(AGX_HeightFieldUtilities::GetHeightCacheDir(), Key + TEXT(".bin"));
+	}
+
+	// The cooked height cache of a package is stored in a directory next to the package.
+	const TCHAR* const CookedHeightCacheDirName = TEXT("AGXHeightCache");
+
+	TArray<uint8> SerializeHeights(const TArray<float>& Heights)
+	{
+		const uint32 Header[3] = {
+			HeightCacheMagic, HeightCacheVersion, static_cast<uint32>(Heights.Num())};
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(sizeof(Header) + Heights.Num() * sizeof(float));
+		FMemory::Memcpy(Bytes.GetData(), Header, sizeof(Header));
+		FMemory::Memcpy(
+			Bytes.GetData() + sizeof(Header), Heights.GetData(), Heights.Num() * sizeof(float));
+		return Bytes;
+	}
+
+	// Returns false if the file doesn't exist or doesn't contain exactly NumHeights heights.
+	bool LoadHeightsFile(const FString& FilePath, int32 NumHeights, TArray<float>& OutHeights)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+			return false;
+
+		// Same layout as written by SerializeHeights.
+		struct FHeader
+		{
+			uint32 Magic;
+			uint32 Version;
+			int32 NumHeights;
+		};
+
+		const int64 ExpectedSize = sizeof(FHeader) + int64(NumHeights) * sizeof(float);
+		if (Bytes.Num() != ExpectedSize)
+			return false;
+
+		FHeader Header;
+		FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(FHeader));
+		if (Header.Magic != HeightCacheMagic || Header.Version != HeightCacheVersion ||
+			Header.NumHeights != NumHeights)
+		{
+			return false;
+		}
+
+		OutHeights.SetNumUninitialized(NumHeights);
+		FMemory::Memcpy(
+			OutHeights.GetData(), Bytes.GetData() + sizeof(FHeader), NumHeights * sizeof(float));
+		return true;
+	}
+
+	template <typename T>
+	void HashValue(FSHA1& Sha, const T& Value)
+	{
+		Sha.Update(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
 }
 
-TArray<float> GetHeights(
-	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+TArray<float> AGX_HeightFieldUtilities::GetLandscapeHeights(
+	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY, bool bParallel)
 {
 	using namespace AGX_HeightFieldUtilities_helpers;
 	const FRotator LandsapeRotation = Landscape.GetActorRotation();
@@ -328,21 +458,216 @@ TArray<float> GetHeights(
 	{
 		// If the Landscape is not rotated around x or y, we can use the Landscape API to read the
 		// heights which is much faster than ray-casting.
-		return GetHeigtsUsingApi(Landscape, StartPos, LengthX, LengthY);
+		return GetHeigtsUsingApi(Landscape, StartPos, LengthX, LengthY, bParallel);
 	}
 	else
 	{
-		return GetHeightsUsingRayCasts(Landscape, StartPos, LengthX, LengthY);
+		return GetHeightsUsingRayCasts(Landscape, StartPos, LengthX, LengthY, bParallel);
+	}
+}
+
+FString AGX_HeightFieldUtilities::GetHeightCacheDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AGXUnreal"), TEXT("HeightCache"));
+}
+
+bool AGX_HeightFieldUtilities::IsHeightCacheEnabled()
+{
+	return GetDefault<UAGX_Simulation>()->bEnableLandscapeHeightCache;
+}
+
+FString AGX_HeightFieldUtilities::GetCookedHeightCacheDir(const UPackage& Package)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+	FString PackageFilename;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(Package.GetName(), PackageFilename))
+		return FString();
+	return FPaths::Combine(FPaths::GetPath(PackageFilename), CookedHeightCacheDirName);
+}
+
+bool AGX_HeightFieldUtilities::GetHeightCacheKey(
+	const ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+	FString& OutKey)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+
+	// The collision components' Heightfield GUIDs change whenever the heights are edited, so
+	// together they serve as a hash of the Landscape's content.
+	const ULandscapeInfo* Info = Landscape.GetLandscapeInfo();
+	if (Info == nullptr || Info->XYtoCollisionComponentMap.Num() == 0)
+		return false;
+
+	TArray<TPair<FIntPoint, FGuid>> ContentGuids;
+	ContentGuids.Reserve(Info->XYtoCollisionComponentMap.Num());
+	for (const auto& Entry : Info->XYtoCollisionComponentMap)
+	{
+		const ULandscapeHeightfieldCollisionComponent* Component = Entry.Value;
+		if (Component == nullptr || !Component->HeightfieldGuid.IsValid())
+			return false;
+		ContentGuids.Add({Entry.Key, Component->HeightfieldGuid});
+	}
+	ContentGuids.Sort(
+		[](const TPair<FIntPoint, FGuid>& Lhs, const TPair<FIntPoint, FGuid>& Rhs)
+		{ return Lhs.Key.X != Rhs.Key.X ? Lhs.Key.X < Rhs.Key.X : Lhs.Key.Y < Rhs.Key.Y; });
+
+	const FTransform& Transform = Landscape.GetActorTransform();
+	const FHeightGrid Grid = GetHeightGrid(Landscape, StartPos, LengthX, LengthY);
+
+	FSHA1 Sha;
+	HashValue(Sha, HeightCacheVersion);
+	HashValue(Sha, Landscape.GetLandscapeGuid());
+	HashValue(Sha, Transform.GetLocation());
+	HashValue(Sha, Transform.GetRotation());
+	HashValue(Sha, Transform.GetScale3D());
+	HashValue(Sha, StartPos);
+	HashValue(Sha, LengthX);
+	HashValue(Sha, LengthY);
+	HashValue(Sha, Grid.VerticesSideX);
+	HashValue(Sha, Grid.VerticesSideY);
+	for (const TPair<FIntPoint, FGuid>& ContentGuid : ContentGuids)
+	{
+		HashValue(Sha, ContentGuid.Key);
+		HashValue(Sha, ContentGuid.Value);
 	}
+	Sha.Final();
+
+	FSHAHash Hash;
+	Sha.GetHash(Hash.Hash);
+	OutKey = Hash.ToString();
+	return true;
+}
+
+bool AGX_HeightFieldUtilities::LoadCachedHeights(
+	const FString& Key, int32 NumHeights, TArray<float>& OutHeights)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+
+	const FString FilePath = GetHeightCacheFilePath(Key);
+	if (!LoadHeightsFile(FilePath, NumHeights, OutHeights))
+		return false;
+
+	// Mark the entry as recently used so that PruneHeightCache keeps it.
+	IFileManager::Get().SetTimeStamp(*FilePath, FDateTime::UtcNow());
+	return true;
+}
+
+bool AGX_HeightFieldUtilities::LoadCookedHeights(
+	const UPackage& Package, const FString& Key, int32 NumHeights, TArray<float>& OutHeights)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+
+	const FString Directory = GetCookedHeightCacheDir(Package);
+	if (Directory.IsEmpty())
+		return false;
+
+	return LoadHeightsFile(
+		FPaths::Combine(Directory, Key + TEXT(".bin")), NumHeights, OutHeights);
+}
+
+bool AGX_HeightFieldUtilities::SaveCachedHeights(const FString& Key, const TArray<float>& Heights)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+
+	const FString FilePath = GetHeightCacheFilePath(Key);
+	if (!FFileHelper::SaveArrayToFile(SerializeHeights(Heights), *FilePath))
+	{
+		UE_LOG(LogAGX, Warning, TEXT("Could not write Landscape height cache '%s'."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+void AGX_HeightFieldUtilities::PruneHeightCache(int64 MaxSizeBytes, const FString& Directory)
+{
+	struct FCacheEntry
+	{
+		FString Path;
+		FDateTime ModificationTime;
+		int64 Size;
+	};
+
+	TArray<FCacheEntry> Entries;
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStat(
+		*Directory,
+		[&Entries, &TotalSize](const TCHAR* Path, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory && FPaths::GetExtension(Path) == TEXT("bin"))
+			{
+				Entries.Add({Path, StatData.ModificationTime, StatData.FileSize});
+				TotalSize += StatData.FileSize;
+			}
+			return true;
+		});
+	if (TotalSize <= MaxSizeBytes)
+		return;
+
+	// Least recently used first.
+	Entries.Sort([](const FCacheEntry& Lhs, const FCacheEntry& Rhs)
+				 { return Lhs.ModificationTime < Rhs.ModificationTime; });
+
+	int32 NumRemoved = 0;
+	for (const FCacheEntry& Entry : Entries)
+	{
+		if (TotalSize <= MaxSizeBytes)
+			break;
+		if (IFileManager::Get().Delete(*Entry.Path, false, false, true))
+		{
+			TotalSize -= Entry.Size;
+			++NumRemoved;
+		}
+	}
+
+	UE_LOG(
+		LogAGX, Log, TEXT("Removed %d entries from the Landscape height cache in '%s'."),
+		NumRemoved, *Directory);
 }
 
 FHeightFieldShapeBarrier AGX_HeightFieldUtilities::CreateHeightField(
-	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY)
+	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+	bool bUseHeightCache, const UObject* CookedCacheOwner)
 {
 	const FVector LandscapeScale = Landscape.GetActorScale();
 
+	// Reading the heights from a large Landscape is slow, so the heights are cached on disk and
+	// reused for as long as the Landscape, and the part of it we read, is unchanged. Cooked builds
+	// only read the heights cooked next to the package of CookedCacheOwner, see CookHeights.
 	TArray<float> Heights;
-	Heights = GetHeights(Landscape, StartPos, LengthX, LengthY);
+	FString CacheKey;
+	const bool bCooked = FPlatformProperties::RequiresCookedData();
+	const bool bHasCacheKey = bUseHeightCache && IsHeightCacheEnabled() &&
+							  (!bCooked || CookedCacheOwner != nullptr) &&
+							  GetHeightCacheKey(Landscape, StartPos, LengthX, LengthY, CacheKey);
+	const int32 NumVertices =
+		AGX_HeightFieldUtilities_helpers::GetHeightGrid(Landscape, StartPos, LengthX, LengthY)
+			.Num();
+	if (bHasCacheKey && bCooked &&
+		LoadCookedHeights(*CookedCacheOwner->GetPackage(), CacheKey, NumVertices, Heights))
+	{
+		UE_LOG(
+			LogAGX, Log, TEXT("Read Landscape heights for '%s' from the cooked height cache."),
+			*Landscape.GetName());
+	}
+	else if (bHasCacheKey && !bCooked && LoadCachedHeights(CacheKey, NumVertices, Heights))
+	{
+		UE_LOG(
+			LogAGX, Log, TEXT("Read Landscape heights for '%s' from the height cache."),
+			*Landscape.GetName());
+	}
+	else
+	{
+		Heights = GetLandscapeHeights(Landscape, StartPos, LengthX, LengthY);
+		// A cooked build may not be able to write to the Saved directory, and its Landscapes can't
+		// be edited, so it never writes to the height cache.
+		if (bHasCacheKey && !bCooked && Heights.Num() == NumVertices &&
+			SaveCachedHeights(CacheKey, Heights))
+		{
+			const int64 MaxSizeMiB = GetDefault<UAGX_Simulation>()->LandscapeHeightCacheMaxSizeMiB;
+			PruneHeightCache(MaxSizeMiB * 1024 * 1024);
+		}
+	}
+
 	const auto QuadSideSize = LandscapeScale.X;
 	if (!FMath::IsNearlyEqual(LandscapeScale.X, LandscapeScale.Y))
 	{
@@ -402,3 +727,42 @@ bool AGX_HeightFieldUtilities::IsOpenWorldLandscape(const ALandscape& Landscape)
 	// with a more "correct" way of determining this.
 	return Landscape.LandscapeComponents.Num() == 0;
 }
+
+#if WITH_EDITOR
+void AGX_HeightFieldUtilities::CookHeights(
+	ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+	const TCHAR* PackageFilename,
+	TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile)
+{
+	using namespace AGX_HeightFieldUtilities_helpers;
+
+	if (!IsHeightCacheEnabled())
+		return;
+
+	FString CacheKey;
+	if (!GetHeightCacheKey(Landscape, StartPos, LengthX, LengthY, CacheKey))
+	{
+		UE_LOG(
+			LogAGX, Log,
+			TEXT("Could not compute a height cache key for Landscape '%s' while cooking '%s'. The "
+				 "cooked build will read the heights from the Landscape."),
+			*Landscape.GetName(), PackageFilename);
+		return;
+	}
+
+	// Reuse the editor height cache if this part of the Landscape has been read before.
+	const int32 NumVertices = GetHeightGrid(Landscape, StartPos, LengthX, LengthY).Num();
+	TArray<float> Heights;
+	if (!LoadCachedHeights(CacheKey, NumVertices, Heights))
+		Heights = GetLandscapeHeights(Landscape, StartPos, LengthX, LengthY);
+	if (Heights.Num() != NumVertices)
+		return;
+
+	// The cooked package is written to the same relative path that GetCookedHeightCacheDir gives
+	// for the package at runtime, so the heights are written next to it.
+	TArray<uint8> Bytes = SerializeHeights(Heights);
+	const FString FilePath = FPaths::Combine(
+		FPaths::GetPath(PackageFilename), CookedHeightCacheDirName, CacheKey + TEXT(".bin"));
+	WriteAdditionalFile(*FilePath, Bytes.GetData(), Bytes.Num());
+}
+#endif
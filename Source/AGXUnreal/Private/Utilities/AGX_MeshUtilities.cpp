@@ -27,7 +27,10 @@
 #include "Materials/MaterialInstance.h"
 #include "Math/Color.h"
 #include "Math/UnrealMathUtility.h"
+#include "Misc/Crc.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/SecureHash.h"
 #include "PhysicsEngine/BodySetup.h"
 #if WITH_EDITOR
 #include "RawMesh.h"
@@ -38,7 +41,10 @@
 #include "StaticMeshAttributes.h"
 #include "StaticMeshOperations.h"
 #include "StaticMeshResources.h"
+#include "UObject/MetaData.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
 
 // Standard library includes.
 #include <limits>
@@ -2105,6 +2111,8 @@ namespace AGX_MeshUtilities_helpers
 		const uint32 NumPositions = Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices();
 		OutPositions.Reserve(NumPositions);
 
+		FEvent* DoneEvent = IsInGameThread() ? nullptr : FPlatformProcess::GetSynchEventFromPool();
+
 		ENQUEUE_RENDER_COMMAND(FCopyMeshBuffers)
 		(
 			[&](FRHICommandListImmediate& RHICmdList)
@@ -2164,15 +2172,27 @@ namespace AGX_MeshUtilities_helpers
 					}
 					Readback.Unlock();
 				}
+
+				if (DoneEvent != nullptr)
+					DoneEvent->Trigger();
 			});
 
-		// Wait for rendering thread to finish.
-		FlushRenderingCommands();
+		// Wait for rendering thread to finish. Flushing is only allowed on the game thread, other
+		// threads wait for the copy command only.
+		if (DoneEvent != nullptr)
+		{
+			DoneEvent->Wait();
+			FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+		}
+		else
+		{
+			FlushRenderingCommands();
+		}
 	}
 
 	static int32 AddCollisionVertex(
-		const FVector3f& VertexPosition, const FTransform& Transform,
-		TArray<FVector>& CollisionVertices, TMap<FVector3f, int32>& MeshToCollisionVertexIndices)
+		const FVector3f& VertexPosition, TArray<FVector3f>& CollisionVertices,
+		TMap<FVector3f, int32>& MeshToCollisionVertexIndices)
 	{
 		if (int32* CollisionVertexIndexPtr = MeshToCollisionVertexIndices.Find(VertexPosition))
 		{
@@ -2182,8 +2202,7 @@ namespace AGX_MeshUtilities_helpers
 		else
 		{
 			// Copy position from mesh to collision data.
-			int CollisionVertexIndex =
-				CollisionVertices.Add(Transform.TransformPosition(FromMeshVector(VertexPosition)));
+			int CollisionVertexIndex = CollisionVertices.Add(VertexPosition);
 
 			// Add collision index to map.
 			MeshToCollisionVertexIndices.Add(VertexPosition, CollisionVertexIndex);
@@ -2192,6 +2211,316 @@ namespace AGX_MeshUtilities_helpers
 		}
 	}
 
+	/**
+	 * Read the triangles of one LOD of a Static Mesh and merge vertices at the same location.
+	 *
+	 * May be called from any thread. In cooked builds the mesh data may have to be read back from
+	 * GPU memory, which blocks until the render thread has executed the copy command.
+	 */
+	bool CreateCollisionMeshData(
+		const UStaticMesh& StaticMesh, uint32 LodIndex, FAGX_CollisionMeshData& OutData)
+	{
+		// NOTE: Code below is very similar to UStaticMesh::GetPhysicsTriMeshData,
+		// only with some simplifications, so one can check that implementation for reference.
+		// One important difference is that we hash on vertex position instead of index because we
+		// want to re-merge vertices that has been split in the rendering data.
+
+		const FStaticMeshLODResources& Mesh = StaticMesh.GetLODForExport(LodIndex);
+
+		// Copy the Index and Vertex buffers from the mesh.
+		TArray<uint32> IndexBuffer;
+		TArray<FVector3f> VertexBuffer;
+
+		// Depending on if the triangle data is available in CPU memory or not, either directly
+		// copy from CPU memory with the current thread or use the render thread to copy from GPU
+		// memory to CPU memory.
+		//
+		// We expect that Allow CPU Access will be false most of the time, and we don't want to
+		// require the user to tick the checkbox on every mesh they want to create a Trimesh from.
+		// Should the Trimesh set the flag on the Static Mesh asset? Can it? Doing it here is too
+		// late since we're now in Begin Play, we need to set the flag on the Editor instance, not
+		// the Play instance. The state handling of the flag will be complicated since we don't
+		// want to leave them checked on Static Mesh assets that are no longer used by any Trimesh,
+		// and we don't want to disable it on a Static Mesh asset on which the end-user enabled it
+		// on themselves.
+		if (StaticMesh.bAllowCPUAccess)
+		{
+			CopyMeshBuffersFromCPUMemory(Mesh, VertexBuffer, IndexBuffer);
+		}
+		else
+		{
+#if WITH_EDITOR
+			// Editor builds keep the mesh data in CPU memory regardless of whether the Allow CPU
+			// Access flag has been set or not.
+			CopyMeshBuffersFromCPUMemory(Mesh, VertexBuffer, IndexBuffer);
+#else
+			CopyMeshBuffersFromGPUMemory(Mesh, VertexBuffer, IndexBuffer);
+#endif
+		}
+
+		if (IndexBuffer.Num() == 0 || VertexBuffer.Num() == 0)
+		{
+			return false;
+		}
+
+		check(Mesh.IndexBuffer.GetNumIndices() == IndexBuffer.Num());
+		check(Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices() == VertexBuffer.Num());
+
+		// Merge vertices at the same location.
+		TMap<FVector3f, int32> MeshToCollisionVertexIndices;
+		MeshToCollisionVertexIndices.Reserve(VertexBuffer.Num());
+		OutData.Vertices.Reserve(VertexBuffer.Num());
+		OutData.Indices.Reserve(IndexBuffer.Num() / 3);
+		const uint32 NumIndices = static_cast<uint32>(IndexBuffer.Num());
+		for (int32 SectionIndex = 0; SectionIndex < Mesh.Sections.Num(); ++SectionIndex)
+		{
+			const FStaticMeshSection& Section = Mesh.Sections[SectionIndex];
+			const uint32 OnePastLastIndex = Section.FirstIndex + Section.NumTriangles * 3;
+
+			for (uint32 Index = Section.FirstIndex; Index < OnePastLastIndex; Index += 3)
+			{
+				if (Index + 2 >= NumIndices)
+				{
+					break;
+				}
+
+				FTriIndices Triangle;
+				Triangle.v0 = AddCollisionVertex(
+					VertexBuffer[IndexBuffer[Index]], OutData.Vertices,
+					MeshToCollisionVertexIndices);
+				Triangle.v1 = AddCollisionVertex(
+					VertexBuffer[IndexBuffer[Index + 1]], OutData.Vertices,
+					MeshToCollisionVertexIndices);
+				Triangle.v2 = AddCollisionVertex(
+					VertexBuffer[IndexBuffer[Index + 2]], OutData.Vertices,
+					MeshToCollisionVertexIndices);
+				OutData.Indices.Add(Triangle);
+			}
+		}
+
+		OutData.Vertices.Shrink();
+		OutData.Indices.Shrink();
+		return OutData.Vertices.Num() > 0 && OutData.Indices.Num() > 0;
+	}
+
+	/**
+	 * A key that changes whenever the triangles of the given LOD of a Static Mesh may have changed.
+	 *
+	 * In editor builds this is the Derived Data Cache key of the render data, which covers
+	 * everything the render data is built from. Otherwise, if the triangles are in CPU memory, it
+	 * is a checksum of the positions and indices. If they are only in GPU memory, which in a
+	 * cooked build means that the mesh was not built at runtime, only the sizes and bounds are
+	 * used.
+	 */
+	FString GetCollisionMeshContentKey(const UStaticMesh& StaticMesh, uint32 LodIndex)
+	{
+		const FStaticMeshRenderData* RenderData = StaticMesh.GetRenderData();
+		check(RenderData != nullptr);
+#if WITH_EDITORONLY_DATA
+		if (!RenderData->DerivedDataKey.IsEmpty())
+		{
+			return FString::Printf(TEXT("%s_%u"), *RenderData->DerivedDataKey, LodIndex);
+		}
+#endif
+
+		const FStaticMeshLODResources& Mesh = RenderData->LODResources[LodIndex];
+		const FPositionVertexBuffer& Positions = Mesh.VertexBuffers.PositionVertexBuffer;
+		uint32 Checksum = 0;
+#if !WITH_EDITOR
+		if (StaticMesh.bAllowCPUAccess)
+#endif
+		{
+			for (uint32 I = 0; I < Positions.GetNumVertices(); ++I)
+			{
+				const FVector3f& Position = Positions.VertexPosition(I);
+				Checksum = FCrc::MemCrc32(&Position, sizeof(Position), Checksum);
+			}
+			const FIndexArrayView Indices = Mesh.IndexBuffer.GetArrayView();
+			for (int32 I = 0; I < Indices.Num(); ++I)
+			{
+				const uint32 Index = Indices[I];
+				Checksum = FCrc::MemCrc32(&Index, sizeof(Index), Checksum);
+			}
+		}
+
+		const FBoxSphereBounds& Bounds = RenderData->Bounds;
+		return FString::Printf(
+			TEXT("%u_%u_%d_%08x_%s_%s"), LodIndex, Positions.GetNumVertices(),
+			Mesh.IndexBuffer.GetNumIndices(), Checksum, *Bounds.Origin.ToString(),
+			*Bounds.BoxExtent.ToString());
+	}
+
+	/**
+	 * Identifies the render data of one LOD of a Static Mesh without reading the mesh data. Equal
+	 * stamps mean that the content key, see GetCollisionMeshContentKey, need not be computed again.
+	 *
+	 * A rebuild replaces the render data, but the new render data may be allocated at the address
+	 * of an older one, so the sizes and bounds are included as well. Rebuilds that keep all of
+	 * those are caught by FCollisionMeshCache::Invalidate instead.
+	 */
+	struct FRenderDataStamp
+	{
+		const FStaticMeshRenderData* RenderData {nullptr};
+		uint32 NumVertices {0};
+		int32 NumIndices {0};
+		FVector Origin {FVector::ZeroVector};
+		FVector BoxExtent {FVector::ZeroVector};
+
+		bool operator==(const FRenderDataStamp& Other) const
+		{
+			return RenderData == Other.RenderData && NumVertices == Other.NumVertices &&
+				   NumIndices == Other.NumIndices && Origin == Other.Origin &&
+				   BoxExtent == Other.BoxExtent;
+		}
+	};
+
+	FRenderDataStamp GetRenderDataStamp(const UStaticMesh& StaticMesh, uint32 LodIndex)
+	{
+		const FStaticMeshRenderData* RenderData = StaticMesh.GetRenderData();
+		check(RenderData != nullptr);
+		const FStaticMeshLODResources& Mesh = RenderData->LODResources[LodIndex];
+
+		FRenderDataStamp Stamp;
+		Stamp.RenderData = RenderData;
+		Stamp.NumVertices = Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices();
+		Stamp.NumIndices = Mesh.IndexBuffer.GetNumIndices();
+		Stamp.Origin = RenderData->Bounds.Origin;
+		Stamp.BoxExtent = RenderData->Bounds.BoxExtent;
+		return Stamp;
+	}
+
+	/**
+	 * Process-wide cache of collision mesh data, keyed by Static Mesh and LOD index.
+	 *
+	 * An entry remembers the content key, see GetCollisionMeshContentKey, of the mesh it was
+	 * created from, and the stamp of the render data the key was computed from. While the stamp
+	 * is unchanged the entry is used as-is, since computing the content key may mean reading the
+	 * whole mesh. Otherwise the content key is computed again. Rebuilding a Static Mesh with other
+	 * content changes the key, which makes the entry stale, and a new one is created. Entries for
+	 * Static Meshes that have been garbage collected are pruned as new entries are added.
+	 */
+	class FCollisionMeshCache
+	{
+	public:
+		using FDataPtr = AGX_MeshUtilities::FCollisionMeshDataPtr;
+
+		static FCollisionMeshCache& Get()
+		{
+			static FCollisionMeshCache Instance;
+			return Instance;
+		}
+
+		/**
+		 * Get the data for the Static Mesh and LOD if it was created from render data with the
+		 * given stamp.
+		 */
+		FDataPtr Find(const UStaticMesh& StaticMesh, uint32 LodIndex, const FRenderDataStamp& Stamp)
+		{
+			FReadScopeLock ReadLock(Lock);
+			const FEntry* Entry = Entries.Find(FKey(&StaticMesh, LodIndex));
+			if (Entry == nullptr || !(Entry->Stamp == Stamp))
+				return nullptr;
+			return Entry->Data;
+		}
+
+		/**
+		 * Get the data for the Static Mesh and LOD if it was created from the same content. The
+		 * entry is then marked as belonging to the render data with the given stamp.
+		 */
+		FDataPtr FindByContent(
+			const UStaticMesh& StaticMesh, uint32 LodIndex, const FRenderDataStamp& Stamp,
+			const FString& ContentKey)
+		{
+			FWriteScopeLock WriteLock(Lock);
+			FEntry* Entry = Entries.Find(FKey(&StaticMesh, LodIndex));
+			if (Entry == nullptr || Entry->ContentKey != ContentKey)
+				return nullptr;
+			Entry->Stamp = Stamp;
+			return Entry->Data;
+		}
+
+		/**
+		 * Store Data unless another thread stored data for the same Static Mesh and LOD, created
+		 * from the same content, first. Returns the stored data.
+		 */
+		FDataPtr Add(
+			const UStaticMesh& StaticMesh, uint32 LodIndex, const FRenderDataStamp& Stamp,
+			const FString& ContentKey, FDataPtr Data)
+		{
+			FWriteScopeLock WriteLock(Lock);
+			FEntry& Entry = Entries.FindOrAdd(FKey(&StaticMesh, LodIndex));
+			Entry.Stamp = Stamp;
+			if (Entry.Data.IsValid() && Entry.ContentKey == ContentKey)
+				return Entry.Data;
+
+			Entry.Mesh = &StaticMesh;
+			Entry.ContentKey = ContentKey;
+			Entry.Data = MoveTemp(Data);
+			FDataPtr Result = Entry.Data;
+
+			if (Entries.Num() >= PruneThreshold)
+			{
+				for (auto It = Entries.CreateIterator(); It; ++It)
+				{
+					if (!It.Value().Mesh.IsValid())
+						It.RemoveCurrent();
+				}
+				PruneThreshold = FMath::Max(2 * Entries.Num(), 64);
+			}
+
+			return Result;
+		}
+
+		/**
+		 * Make the next lookups of any LOD of the Static Mesh compute the content key again. The
+		 * data is kept, and reused if the content turns out to be unchanged.
+		 */
+		void Invalidate(const UStaticMesh& StaticMesh)
+		{
+			FWriteScopeLock WriteLock(Lock);
+			for (TPair<FKey, FEntry>& Entry : Entries)
+			{
+				if (Entry.Key.Key == TObjectKey<UStaticMesh>(&StaticMesh))
+					Entry.Value.Stamp = FRenderDataStamp();
+			}
+		}
+
+		void Empty()
+		{
+			FWriteScopeLock WriteLock(Lock);
+			Entries.Empty();
+		}
+
+	private:
+		FCollisionMeshCache()
+		{
+#if WITH_EDITOR
+			// Editing a Static Mesh, including reimporting it, rebuilds it.
+			FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda(
+				[this](UObject* Object, FPropertyChangedEvent&)
+				{
+					if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Object))
+						Invalidate(*StaticMesh);
+				});
+#endif
+		}
+
+		using FKey = TPair<TObjectKey<UStaticMesh>, uint32>;
+
+		struct FEntry
+		{
+			TWeakObjectPtr<const UStaticMesh> Mesh;
+			FString ContentKey;
+			FRenderDataStamp Stamp;
+
+			FDataPtr Data;
+		};
+
+		FRWLock Lock;
+		TMap<FKey, FEntry> Entries;
+		int32 PruneThreshold = 64;
+	};
+
 #if WITH_EDITOR
 	UStaticMesh* CreateStaticMeshFromRawMesh(
 		FRawMesh&& RawMesh, const FString& Name, UObject& Outer, UMaterialInterface* Material)
@@ -2229,99 +2558,83 @@ bool AGX_MeshUtilities::GetStaticMeshCollisionData(
 		return false;
 	}
 
-	// NOTE: Code below is very similar to UStaticMesh::GetPhysicsTriMeshData,
-	// only with some simplifications, so one can check that implementation for reference.
-	// One important difference is that we hash on vertex position instead of index because we
-	// want to re-merge vertices that has been split in the rendering data.
-
-	// Final vertex positions will be given relative to RelativeTo,
-	// and any scale needs to be baked into the positions, because AGX
-	// does not support scale.
-	const FTransform RelativeTransform = InMesh.Transform.GetRelativeTransform(RelativeTo);
 	const UStaticMesh& StaticMesh = *InMesh.Mesh.Get();
-
 	const uint32 LodIndex = FMath::Clamp<int32>(
 		LodIndexOverride != nullptr ? *LodIndexOverride : StaticMesh.LODForCollision, 0,
 		StaticMesh.GetNumLODs() - 1);
 
-	if (!StaticMesh.HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
+	const FCollisionMeshDataPtr Data = GetStaticMeshCollisionData(StaticMesh, LodIndex);
+	if (!Data.IsValid())
+	{
 		return false;
+	}
 
-	const FStaticMeshLODResources& Mesh = StaticMesh.GetLODForExport(LodIndex);
-	TMap<FVector3f, int32> MeshToCollisionVertexIndices;
-
-	// Copy the Index and Vertex buffers from the mesh.
-	TArray<uint32> IndexBuffer;
-	TArray<FVector3f> VertexBuffer;
-
-	// Depending on if the triangle data is available in CPU memory or not, either directly copy
-	// from CPU memory with the current thread, assumed to be the game thread, or use the render
-	// thread to copy from GPU memory to CPU memory.
-	//
-	// We expect that Allow CPU Access will be false most of the time, and we don't want to require
-	// the user to tick the checkbox on every mesh they want to create a Trimesh from. Should
-	// the Trimesh set the flag on the Static Mesh asset? Can it? Doing it here is too late since
-	// we're now in Begin Play, we need to set the flag on the Editor instance, not the Play
-	// instance. The state handling of the flag will be complicated since we don't want to leave
-	// them checked on Static Mesh assets that are no longer used by any Trimesh, and we don't want
-	// to disable it on a Static Mesh asset on which the end-user enabled it on themselves.
-	if (StaticMesh.bAllowCPUAccess)
+	// Final vertex positions will be given relative to RelativeTo,
+	// and any scale needs to be baked into the positions, because AGX
+	// does not support scale.
+	const FTransform RelativeTransform = InMesh.Transform.GetRelativeTransform(RelativeTo);
+	const int32 FirstVertex = OutVertices.Num();
+	OutVertices.Reserve(FirstVertex + Data->Vertices.Num());
+	for (const FVector3f& Vertex : Data->Vertices)
 	{
-		AGX_MeshUtilities_helpers::CopyMeshBuffersFromCPUMemory(Mesh, VertexBuffer, IndexBuffer);
+		OutVertices.Add(RelativeTransform.TransformPosition(FromMeshVector(Vertex)));
 	}
-	else
+
+	OutIndices.Reserve(OutIndices.Num() + Data->Indices.Num());
+	for (const FTriIndices& Triangle : Data->Indices)
 	{
-#if WITH_EDITOR
-		// Editor builds keep the mesh data in CPU memory regardless of whether the Allow CPU Access
-		// flag has been set or not.
-		AGX_MeshUtilities_helpers::CopyMeshBuffersFromCPUMemory(Mesh, VertexBuffer, IndexBuffer);
-#else
-		AGX_MeshUtilities_helpers::CopyMeshBuffersFromGPUMemory(Mesh, VertexBuffer, IndexBuffer);
-#endif
+		FTriIndices& Added = OutIndices.Add_GetRef(Triangle);
+		Added.v0 += FirstVertex;
+		Added.v1 += FirstVertex;
+		Added.v2 += FirstVertex;
 	}
 
-	if (IndexBuffer.Num() == 0 || VertexBuffer.Num() == 0)
+	return OutVertices.Num() > 0 && OutIndices.Num() > 0;
+}
+
+AGX_MeshUtilities::FCollisionMeshDataPtr AGX_MeshUtilities::GetStaticMeshCollisionData(
+	const UStaticMesh& StaticMesh, uint32 LodIndex)
+{
+	using namespace AGX_MeshUtilities_helpers;
+	if (LodIndex >= static_cast<uint32>(StaticMesh.GetNumLODs()) ||
+		!StaticMesh.HasValidRenderData(/*bCheckLODForVerts*/ true, LodIndex))
 	{
-		return false;
+		return nullptr;
 	}
 
-	check(Mesh.IndexBuffer.GetNumIndices() == IndexBuffer.Num());
-	check(Mesh.VertexBuffers.PositionVertexBuffer.GetNumVertices() == VertexBuffer.Num());
-
-	// Merge vertices at the same location.
-	const uint32 NumIndices = static_cast<uint32>(IndexBuffer.Num());
-	for (int32 SectionIndex = 0; SectionIndex < Mesh.Sections.Num(); ++SectionIndex)
+	const FRenderDataStamp Stamp = GetRenderDataStamp(StaticMesh, LodIndex);
+	FCollisionMeshCache& Cache = FCollisionMeshCache::Get();
+	if (FCollisionMeshDataPtr Cached = Cache.Find(StaticMesh, LodIndex, Stamp))
 	{
-		const FStaticMeshSection& Section = Mesh.Sections[SectionIndex];
-		const uint32 OnePastLastIndex = Section.FirstIndex + Section.NumTriangles * 3;
+		return Cached;
+	}
 
-		for (uint32 Index = Section.FirstIndex; Index < OnePastLastIndex; Index += 3)
-		{
-			if (Index + 2 >= NumIndices)
-			{
-				break;
-			}
+	// New render data, possibly with the same content as before.
+	const FString ContentKey = GetCollisionMeshContentKey(StaticMesh, LodIndex);
+	if (FCollisionMeshDataPtr Cached = Cache.FindByContent(StaticMesh, LodIndex, Stamp, ContentKey))
+	{
+		return Cached;
+	}
 
-			const uint32 IndexFirst = IndexBuffer[Index];
-			const uint32 IndexSecond = IndexBuffer[Index + 1];
-			const uint32 IndexThird = IndexBuffer[Index + 2];
-			FTriIndices Triangle;
+	// Created without holding the cache lock since it may have to wait for the render thread.
+	TSharedPtr<FAGX_CollisionMeshData, ESPMode::ThreadSafe> Data =
+		MakeShared<FAGX_CollisionMeshData, ESPMode::ThreadSafe>();
+	if (!CreateCollisionMeshData(StaticMesh, LodIndex, *Data))
+	{
+		return nullptr;
+	}
 
-			Triangle.v0 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexFirst], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
-			Triangle.v1 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexSecond], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
-			Triangle.v2 = AGX_MeshUtilities_helpers::AddCollisionVertex(
-				VertexBuffer[IndexThird], RelativeTransform, OutVertices,
-				MeshToCollisionVertexIndices);
+	return Cache.Add(StaticMesh, LodIndex, Stamp, ContentKey, MoveTemp(Data));
+}
 
-			OutIndices.Add(Triangle);
-		}
-	}
+void AGX_MeshUtilities::InvalidateStaticMeshCollisionData(const UStaticMesh& StaticMesh)
+{
+	AGX_MeshUtilities_helpers::FCollisionMeshCache::Get().Invalidate(StaticMesh);
+}
 
-	return OutVertices.Num() > 0 && OutIndices.Num() > 0;
+void AGX_MeshUtilities::ClearStaticMeshCollisionDataCache()
+{
+	AGX_MeshUtilities_helpers::FCollisionMeshCache::Get().Empty();
 }
 
 TArray<FAGX_MeshWithTransform> AGX_MeshUtilities::ToMeshWithTransformArray(
@@ -3047,6 +3360,7 @@ bool AGX_MeshUtilities::CopyStaticMesh(UStaticMesh* Source, UStaticMesh* Destina
 	Params.bAllowCpuAccess = true;
 	Destination->BuildFromMeshDescriptions({&MeshDescription}, Params);
 	AddBoxSimpleCollision(*Destination);
+	InvalidateStaticMeshCollisionData(*Destination);
 	return true;
 }
 
@@ -3163,6 +3477,13 @@ bool AGX_MeshUtilities::AreStaticMeshesEqual(UStaticMesh* MeshA, UStaticMesh* Me
 			return false;
 	}
 
+	// Meshes created by the importer remember a hash of the data they were created from, which is
+	// both cheaper and more complete than comparing vertex positions.
+	const FString HashA = GetMeshContentHash(*MeshA);
+	const FString HashB = GetMeshContentHash(*MeshB);
+	if (!HashA.IsEmpty() && !HashB.IsEmpty())
+		return HashA == HashB;
+
 	const bool AHasRenderData = MeshA->GetRenderData() != nullptr;
 	const bool BHasRenderData = MeshB->GetRenderData() != nullptr;
 	if (AHasRenderData != BHasRenderData)
@@ -3198,6 +3519,107 @@ bool AGX_MeshUtilities::AreStaticMeshesEqual(UStaticMesh* MeshA, UStaticMesh* Me
 	return true;
 }
 
+namespace AGX_MeshUtilities_helpers
+{
+	// Quantization steps used by the mesh content hash. Positions are in [cm].
+	constexpr double ContentHashPositionStep = 1e-3;
+	constexpr double ContentHashDirectionStep = 1e-5;
+
+	const TCHAR* const MeshContentHashKey = TEXT("AGX_MeshContentHash");
+
+	int64 Quantize(double Value, double Step)
+	{
+		return static_cast<int64>(FMath::RoundToDouble(Value / Step));
+	}
+
+	template <typename TVector, int32 NumComponents>
+	void HashQuantized(FSHA1& Sha, const TArray<TVector>& Values, double Step)
+	{
+		const int32 Num = Values.Num();
+		Sha.Update(reinterpret_cast<const uint8*>(&Num), sizeof(Num));
+		TArray<int64> Quantized;
+		Quantized.SetNumUninitialized(Num * NumComponents);
+		for (int32 I = 0; I < Num; ++I)
+		{
+			for (int32 C = 0; C < NumComponents; ++C)
+			{
+				Quantized[I * NumComponents + C] = Quantize(Values[I][C], Step);
+			}
+		}
+		Sha.Update(
+			reinterpret_cast<const uint8*>(Quantized.GetData()), Quantized.Num() * sizeof(int64));
+	}
+}
+
+FString AGX_MeshUtilities::ComputeMeshContentHash(
+	const TArray<FVector>& Positions, const TArray<uint32>& Indices,
+	const TArray<FVector>& Normals, const TArray<FVector2D>& UVs)
+{
+	using namespace AGX_MeshUtilities_helpers;
+
+	FSHA1 Sha;
+	HashQuantized<FVector, 3>(Sha, Positions, ContentHashPositionStep);
+	const int32 NumIndices = Indices.Num();
+	Sha.Update(reinterpret_cast<const uint8*>(&NumIndices), sizeof(NumIndices));
+	Sha.Update(reinterpret_cast<const uint8*>(Indices.GetData()), NumIndices * sizeof(uint32));
+	HashQuantized<FVector, 3>(Sha, Normals, ContentHashDirectionStep);
+	HashQuantized<FVector2D, 2>(Sha, UVs, ContentHashDirectionStep);
+	Sha.Final();
+
+	FSHAHash Hash;
+	Sha.GetHash(Hash.Hash);
+	return Hash.ToString();
+}
+
+FString AGX_MeshUtilities::ComputeMeshContentHash(const FTrimeshShapeBarrier& Trimesh)
+{
+	if (!Trimesh.HasNative())
+		return FString();
+
+	return ComputeMeshContentHash(
+		Trimesh.GetVertexPositions(), Trimesh.GetVertexIndices(), Trimesh.GetTriangleNormals(),
+		TArray<FVector2D>());
+}
+
+FString AGX_MeshUtilities::ComputeMeshContentHash(const FRenderDataBarrier& RenderData)
+{
+	if (!RenderData.HasNative() || !RenderData.HasMesh())
+		return FString();
+
+	return ComputeMeshContentHash(
+		RenderData.GetPositions(), RenderData.GetIndices(), RenderData.GetNormals(),
+		RenderData.GetTextureCoordinates());
+}
+
+void AGX_MeshUtilities::SetMeshContentHash(UStaticMesh& Mesh, const FString& Hash)
+{
+#if WITH_EDITOR
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	auto MetaData = Mesh.GetOutermost()->GetMetaData();
+#else
+	auto MetaData = &Mesh.GetOutermost()->GetMetaData();
+#endif // UE_VERSION_OLDER_THAN(...)
+
+	if (MetaData != nullptr)
+		MetaData->SetValue(&Mesh, AGX_MeshUtilities_helpers::MeshContentHashKey, *Hash);
+#endif // WITH_EDITOR
+}
+
+FString AGX_MeshUtilities::GetMeshContentHash(const UStaticMesh& Mesh)
+{
+#if WITH_EDITOR
+#if UE_VERSION_OLDER_THAN(5, 6, 0)
+	auto MetaData = Mesh.GetOutermost()->GetMetaData();
+#else
+	auto MetaData = &Mesh.GetOutermost()->GetMetaData();
+#endif // UE_VERSION_OLDER_THAN(...)
+
+	if (MetaData != nullptr)
+		return MetaData->GetValue(&Mesh, AGX_MeshUtilities_helpers::MeshContentHashKey);
+#endif // WITH_EDITOR
+	return FString();
+}
+
 bool AGX_MeshUtilities::AreImportedRenderMaterialsEqual(
 	UMaterialInterface* MatA, UMaterialInterface* MatB)
 {
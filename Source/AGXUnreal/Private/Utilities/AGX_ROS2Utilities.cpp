@@ -9,8 +9,11 @@
 #include "Sensors/AGX_LidarOutputPositionIntensity.h"
 #include "Sensors/AGX_LidarScanPoint.h"
 
+// Unreal Engine includes.
+#include "Algo/Count.h"
+#include "Math/VectorRegister.h"
+
 // Standard library includes.
-#include <cstring>
 #include <limits>
 
 namespace AGX_ROS2Utilities_helpers
@@ -72,37 +75,33 @@ namespace AGX_ROS2Utilities_helpers
 		return Field;
 	};
 
-	void AppendDoubleToUint8Array(double Val, TArray<uint8>& OutData)
+	static_assert(
+		PLATFORM_LITTLE_ENDIAN,
+		"ROS2 point cloud and image data is little endian and is written with memory copies.");
+
+	/**
+	 * Resize Data to NumBytes uninitialized bytes, to be filled through the returned pointer.
+	 */
+	uint8* ResizeData(TArray<uint8>& Data, int32 NumBytes)
 	{
-		uint64 Bits;
-		static_assert(sizeof(Bits) == sizeof(Val));
-		std::memcpy(&Bits, &Val, sizeof(Bits));
-		for (int i = 0; i < sizeof(Val); i++)
-		{
-			OutData.Add(static_cast<uint8_t>(Bits & 0xFF));
-			Bits >>= 8;
-		}
+		Data.SetNumUninitialized(NumBytes);
+		return Data.GetData();
 	}
 
-	void AppendFloatToUint8Array(float Val, TArray<uint8>& OutData)
+	/**
+	 * Write the bytes of Value to Dest and return the position just after them.
+	 */
+	template <typename T>
+	uint8* Write(uint8* Dest, const T& Value)
 	{
-		uint32 Bits;
-		static_assert(sizeof(Bits) == sizeof(Val));
-		std::memcpy(&Bits, &Val, sizeof(Bits));
-		for (int i = 0; i < sizeof(Val); i++)
-		{
-			OutData.Add(static_cast<uint8_t>(Bits & 0xFF));
-			Bits >>= 8;
-		}
+		FMemory::Memcpy(Dest, &Value, sizeof(T));
+		return Dest + sizeof(T);
 	}
 
-	auto AppendUint32ToUint8Array(uint32 Val, TArray<uint8>& OutData)
+	int32 CountValid(const TArray<FAGX_LidarScanPoint>& Points)
 	{
-		for (int i = 0; i < sizeof(uint32); i++)
-		{
-			OutData.Add(static_cast<uint8_t>(Val & 0xFF));
-			Val >>= 8;
-		}
+		return static_cast<int32>(
+			Algo::CountIf(Points, [](const FAGX_LidarScanPoint& P) { return P.bIsValid; }));
 	}
 
 	constexpr double CmToM(double Val)
@@ -125,22 +124,23 @@ FAGX_SensorMsgsImage FAGX_ROS2Utilities::Convert(
 
 	if (Grayscale)
 	{
-		Msg.Data.Reserve(Image.Num());
-		for (const auto& Color : Image)
+		uint8* Dest = AGX_ROS2Utilities_helpers::ResizeData(Msg.Data, Image.Num());
+		for (const FColor& Color : Image)
 		{
 			const uint16 Sum = static_cast<uint16>(Color.R) + static_cast<uint16>(Color.G) +
 							   static_cast<uint16>(Color.B);
-			Msg.Data.Add(static_cast<uint8>(Sum / 3));
+			*Dest++ = static_cast<uint8>(Sum / 3);
 		}
 	}
 	else
 	{
-		Msg.Data.Reserve(Image.Num() * 3);
-		for (const auto& Color : Image)
+		uint8* Dest = AGX_ROS2Utilities_helpers::ResizeData(Msg.Data, Image.Num() * 3);
+		for (const FColor& Color : Image)
 		{
-			Msg.Data.Add(Color.R);
-			Msg.Data.Add(Color.G);
-			Msg.Data.Add(Color.B);
+			Dest[0] = Color.R;
+			Dest[1] = Color.G;
+			Dest[2] = Color.B;
+			Dest += 3;
 		}
 	}
 
@@ -154,27 +154,25 @@ FAGX_SensorMsgsImage FAGX_ROS2Utilities::Convert(
 	FAGX_SensorMsgsImage Msg = AGX_ROS2Utilities_helpers::SetAllExceptData<FFloat16Color, uint16>(
 		Image, TimeStamp, Resolution, Grayscale, "16");
 
+	using namespace AGX_ROS2Utilities_helpers;
 	static constexpr float MaxUint16f = static_cast<float>(std::numeric_limits<uint16>::max());
 	if (Grayscale)
 	{
-		Msg.Data.Reserve(Image.Num() * 2);
-		for (const auto& Color : Image)
+		uint8* Dest = ResizeData(Msg.Data, Image.Num() * 2);
+		for (const FFloat16Color& Color : Image)
 		{
 			const FLinearColor LColor = Color.GetFloats();
 
 			// Transform from [0..1] to uint16 range.
 			const float Valf =
 				FMath::Clamp((LColor.R + LColor.G + LColor.B) / 3.f, 0.f, 1.f) * MaxUint16f;
-			const uint16 Val = static_cast<uint16>(Valf);
-
-			Msg.Data.Add(static_cast<uint8>(Val & 0xFF)); // Low bits.
-			Msg.Data.Add(static_cast<uint8>((Val >> 8) & 0xFF)); // High bits.
+			Dest = Write(Dest, static_cast<uint16>(Valf));
 		}
 	}
 	else
 	{
-		Msg.Data.Reserve(Image.Num() * 2 * 3);
-		for (const auto& Color : Image)
+		uint8* Dest = ResizeData(Msg.Data, Image.Num() * 2 * 3);
+		for (const FFloat16Color& Color : Image)
 		{
 			const FLinearColor LColor = Color.GetFloats();
 
@@ -183,12 +181,7 @@ FAGX_SensorMsgsImage FAGX_ROS2Utilities::Convert(
 				static_cast<uint16>(FMath::Clamp(LColor.R, 0.f, 1.f) * MaxUint16f),
 				static_cast<uint16>(FMath::Clamp(LColor.G, 0.f, 1.f) * MaxUint16f),
 				static_cast<uint16>(FMath::Clamp(LColor.B, 0.f, 1.f) * MaxUint16f)};
-
-			for (const uint16 C : Rgb)
-			{
-				Msg.Data.Add(static_cast<uint8>(C & 0xFF)); // Low bits.
-				Msg.Data.Add(static_cast<uint8>((C >> 8) & 0xFF)); // High bits.
-			}
+			Dest = Write(Dest, Rgb);
 		}
 	}
 
@@ -227,38 +220,29 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertXYZ(
 	Msg.PointStep = 4 * ElementStep; // Bytes per point.
 	Msg.IsDense = true;
 
-	Msg.Data.Reserve(Points.Num() * Msg.PointStep);
-
-	auto AppendToInt8Array = [&](double InData)
+	// The precision is a template parameter so that the branch is not taken per point.
+	auto WritePoints = [&](auto Zero)
 	{
-		if (FieldType == EAGX_PointFieldType::Float32)
-		{
-			AppendFloatToUint8Array(static_cast<float>(InData), Msg.Data);
-		}
-		else if (FieldType == EAGX_PointFieldType::Float64)
+		using FRealType = decltype(Zero);
+		uint8* Dest = ResizeData(Msg.Data, CountValid(Points) * Msg.PointStep);
+		for (int32 i = FirstValidIndex; i < Points.Num(); i++)
 		{
-			AppendDoubleToUint8Array(InData, Msg.Data);
-		}
-		else
-		{
-			UE_LOG(
-				LogAGX, Error,
-				TEXT("Unsupported FieldType in lambda AppendToInt8Array in ConvertXYZ."));
+			if (!Points[i].bIsValid)
+				continue;
+
+			const FVector Pos =
+				ROSCoordinates ? ConvertPositionToROS(Points[i].Position) : Points[i].Position;
+			const FRealType Values[4] = {
+				static_cast<FRealType>(Pos.X), static_cast<FRealType>(Pos.Y),
+				static_cast<FRealType>(Pos.Z), static_cast<FRealType>(Points[i].Intensity)};
+			Dest = Write(Dest, Values);
 		}
 	};
 
-	for (int32 i = FirstValidIndex; i < Points.Num(); i++)
-	{
-		if (!Points[i].bIsValid)
-			continue;
-
-		FVector Pos =
-			ROSCoordinates ? ConvertPositionToROS(Points[i].Position) : Points[i].Position;
-		AppendToInt8Array(Pos.X);
-		AppendToInt8Array(Pos.Y);
-		AppendToInt8Array(Pos.Z);
-		AppendToInt8Array(static_cast<double>(Points[i].Intensity));
-	}
+	if (DoublePrecision)
+		WritePoints(0.0);
+	else
+		WritePoints(0.0f);
 
 	// Since the points are unordered, height is 1 and width is the length of the point cloud.
 	Msg.Height = 1;
@@ -296,7 +280,7 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertAnglesTOF(
 	// We collect the constants and get TimePiko = DistanceMeters * K.
 	static constexpr double K = 2.0 * 1.0e12 / 299792458.0;
 
-	Msg.Data.Reserve(Points.Num() * Msg.PointStep);
+	uint8* Dest = ResizeData(Msg.Data, CountValid(Points) * Msg.PointStep);
 	for (int32 i = FirstValidIndex; i < Points.Num(); i++)
 	{
 		if (!Points[i].bIsValid)
@@ -328,11 +312,11 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertAnglesTOF(
 			return static_cast<uint32>(TimePikoSecondsd);
 		}();
 
-		// Append data to Msg.Data
-		AppendDoubleToUint8Array(AngleX, Msg.Data);
-		AppendDoubleToUint8Array(AngleY, Msg.Data);
-		AppendUint32ToUint8Array(TimePikoSeconds, Msg.Data);
-		AppendDoubleToUint8Array(Points[i].Intensity, Msg.Data);
+		// Write the packed fields, 28 bytes without padding.
+		Dest = Write(Dest, AngleX);
+		Dest = Write(Dest, AngleY);
+		Dest = Write(Dest, TimePikoSeconds);
+		Dest = Write(Dest, static_cast<double>(Points[i].Intensity));
 	}
 
 	// Since the points are unordered, height is 1 and width is the length of the point cloud.
@@ -362,15 +346,14 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertPositionData(
 	// Centimeter to meter.
 	static constexpr float CtM = 0.01f;
 
-	Msg.Data.Reserve(Data.Num() * Msg.PointStep);
+	uint8* Dest = ResizeData(Msg.Data, Data.Num() * Msg.PointStep);
 	for (const auto& D : Data)
 	{
 		FVector3f Pos = D.Position;
 		Pos = CtM * Pos;
 		Pos.Y = -Pos.Y; // Flip Y due to left vs righ handed coordinates.
-		AppendFloatToUint8Array(Pos.X, Msg.Data);
-		AppendFloatToUint8Array(Pos.Y, Msg.Data);
-		AppendFloatToUint8Array(Pos.Z, Msg.Data);
+		const float Values[3] = {Pos.X, Pos.Y, Pos.Z};
+		Dest = Write(Dest, Values);
 	}
 
 	// Since the points are unordered, height is 1 and width is the length of the point cloud.
@@ -399,19 +382,17 @@ FAGX_SensorMsgsPointCloud2 UAGX_ROS2Utilities::ConvertPositionIntensityData(
 	Msg.PointStep = 16; // Bytes per point.
 	Msg.IsDense = true;
 
-	// Centimeter to meter.
-	static constexpr float CtM = 0.01f;
+	// The data has the same layout as a point, so each point is converted with one vector
+	// multiplication. Centimeter to meter, and flip Y due to left vs right handed coordinates.
+	static_assert(sizeof(FAGX_LidarOutputPositionIntensityData) == 16);
+	static_assert(offsetof(FAGX_LidarOutputPositionIntensityData, Intensity) == 12);
+	const VectorRegister4Float Scale = MakeVectorRegisterFloat(0.01f, -0.01f, 0.01f, 1.0f);
 
-	Msg.Data.Reserve(Data.Num() * Msg.PointStep);
+	float* Dest = reinterpret_cast<float*>(ResizeData(Msg.Data, Data.Num() * Msg.PointStep));
 	for (const auto& D : Data)
 	{
-		FVector3f Pos = D.Position;
-		Pos = CtM * Pos;
-		Pos.Y = -Pos.Y; // Flip Y due to left vs righ handed coordinates.
-		AppendFloatToUint8Array(Pos.X, Msg.Data);
-		AppendFloatToUint8Array(Pos.Y, Msg.Data);
-		AppendFloatToUint8Array(Pos.Z, Msg.Data);
-		AppendFloatToUint8Array(D.Intensity, Msg.Data);
+		VectorStore(VectorMultiply(VectorLoad(&D.Position.X), Scale), Dest);
+		Dest += 4;
 	}
 
 	// Since the points are unordered, height is 1 and width is the length of the point cloud.
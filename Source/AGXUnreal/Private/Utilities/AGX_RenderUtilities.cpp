@@ -78,6 +78,39 @@ bool FAGX_RenderUtilities::UpdateRenderTextureRegions(
 	return true;
 }
 
+bool FAGX_RenderUtilities::UpdateRenderTextureRegions(
+	UTextureRenderTarget2D& RenderTarget, TArray<FUpdateTextureRegion2D>&& Regions,
+	uint32 SourcePitch, uint32 SourceBitsPerPixel, uint8* SourceData)
+{
+#if UE_VERSION_OLDER_THAN(5, 0, 0)
+	FTextureRenderTarget2DResource* Resource =
+		(FTextureRenderTarget2DResource*) (RenderTarget.Resource);
+#else
+	FTextureRenderTarget2DResource* Resource =
+		(FTextureRenderTarget2DResource*) (RenderTarget.GetResource());
+#endif
+	if (Resource == nullptr)
+	{
+		UE_LOG(LogAGX, Error, TEXT("TextureRenderTarget doesn't have a resource."));
+		return false;
+	}
+
+	auto WriteTexture = [Resource, Regions = MoveTemp(Regions), SourcePitch, SourceBitsPerPixel,
+						 SourceData](FRHICommandListImmediate& RHICmdList)
+	{
+		FRHITexture* Texture = Resource->GetTextureRHI();
+		for (const FUpdateTextureRegion2D& Region : Regions)
+		{
+			uint8* Bits = SourceData + Region.SrcY * SourcePitch + Region.SrcX * SourceBitsPerPixel;
+			RHIUpdateTexture2D(Texture, /*MipIndex*/ 0, Region, SourcePitch, Bits);
+		}
+	};
+
+	ENQUEUE_RENDER_COMMAND(UpdateRenderTextureRegionsData)(std::move(WriteTexture));
+
+	return true;
+}
+
 void FAGX_RenderUtilities::DrawContactPoints(
 	const TArray<FShapeContactBarrier>& ShapeContacts, float Size, float LifeTime, UWorld* World)
 {
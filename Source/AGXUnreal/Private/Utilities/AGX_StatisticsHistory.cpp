@@ -0,0 +1,178 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Utilities/AGX_StatisticsHistory.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+
+// Unreal Engine includes.
+#include "Misc/FileHelper.h"
+#include "UObject/UnrealType.h"
+
+void FAGX_StatisticsHistory::SetCapacity(int32 InCapacity)
+{
+	Capacity = FMath::Max(InCapacity, 0);
+	Samples.Empty(Capacity);
+	Next = 0;
+}
+
+int32 FAGX_StatisticsHistory::GetCapacity() const
+{
+	return Capacity;
+}
+
+int32 FAGX_StatisticsHistory::Num() const
+{
+	return Samples.Num();
+}
+
+void FAGX_StatisticsHistory::Reset()
+{
+	Samples.Reset();
+	Next = 0;
+}
+
+void FAGX_StatisticsHistory::Add(double TimeStamp, const FAGX_Statistics& Statistics)
+{
+	if (Capacity == 0)
+		return;
+
+	if (Samples.Num() < Capacity)
+	{
+		Samples.Add({TimeStamp, Statistics});
+		return;
+	}
+
+	Samples[Next] = {TimeStamp, Statistics};
+	Next = (Next + 1) % Capacity;
+}
+
+int32 FAGX_StatisticsHistory::GetIndex(int32 I) const
+{
+	// Until the buffer is full Next is zero, and once full Next is the oldest sample.
+	return (Next + I) % Samples.Num();
+}
+
+void FAGX_StatisticsHistory::GetSamples(TArray<FAGX_StatisticsSample>& OutSamples) const
+{
+	OutSamples.Reset(Samples.Num());
+	for (int32 I = 0; I < Samples.Num(); ++I)
+	{
+		OutSamples.Add(Samples[GetIndex(I)]);
+	}
+}
+
+namespace AGX_StatisticsHistory_helpers
+{
+	/**
+	 * Read a float or integer member of FAGX_Statistics as a double. AGX Dynamics reports
+	 * statistics that are not available as negative values, for those false is returned.
+	 */
+	bool GetValue(const FProperty& Property, const FAGX_Statistics& Statistics, double& OutValue)
+	{
+		if (const FFloatProperty* FloatProperty = CastField<FFloatProperty>(&Property))
+		{
+			OutValue = FloatProperty->GetPropertyValue_InContainer(&Statistics);
+		}
+		else if (const FIntProperty* IntProperty = CastField<FIntProperty>(&Property))
+		{
+			OutValue = IntProperty->GetPropertyValue_InContainer(&Statistics);
+		}
+		else
+		{
+			return false;
+		}
+
+		return OutValue >= 0.0;
+	}
+}
+
+bool FAGX_StatisticsHistory::GetSummary(
+	FName StatisticName, double Percentile, FAGX_StatisticsSummary& OutSummary) const
+{
+	using namespace AGX_StatisticsHistory_helpers;
+
+	OutSummary = FAGX_StatisticsSummary();
+	const FProperty* Property = FAGX_Statistics::StaticStruct()->FindPropertyByName(StatisticName);
+	if (Property == nullptr ||
+		!(Property->IsA<FFloatProperty>() || Property->IsA<FIntProperty>()))
+	{
+		UE_LOG(
+			LogAGX, Warning, TEXT("Cannot summarize statistic '%s', there is no such statistic."),
+			*StatisticName.ToString());
+		return false;
+	}
+
+	TArray<double> Values;
+	Values.Reserve(Samples.Num());
+	for (const FAGX_StatisticsSample& Sample : Samples)
+	{
+		double Value;
+		if (GetValue(*Property, Sample.Statistics, Value))
+			Values.Add(Value);
+	}
+
+	if (Values.Num() == 0)
+		return true;
+
+	Values.Sort();
+	double Sum = 0.0;
+	for (double Value : Values)
+	{
+		Sum += Value;
+	}
+
+	const double Rank = FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * Values.Num();
+	const int32 PercentileIndex = FMath::Clamp(FMath::CeilToInt(Rank) - 1, 0, Values.Num() - 1);
+
+	OutSummary.NumSamples = Values.Num();
+	OutSummary.Min = Values[0];
+	OutSummary.Max = Values.Last();
+	OutSummary.Mean = Sum / Values.Num();
+	OutSummary.Percentile = Values[PercentileIndex];
+	return true;
+}
+
+bool FAGX_StatisticsHistory::ExportCsv(const FString& FilePath) const
+{
+	using namespace AGX_StatisticsHistory_helpers;
+
+	TArray<const FProperty*> Properties;
+	for (TFieldIterator<FProperty> It(FAGX_Statistics::StaticStruct()); It; ++It)
+	{
+		if (It->IsA<FFloatProperty>() || It->IsA<FIntProperty>())
+			Properties.Add(*It);
+	}
+
+	FString Csv = TEXT("TimeStamp");
+	for (const FProperty* Property : Properties)
+	{
+		Csv += TEXT(",") + Property->GetName();
+	}
+	Csv += TEXT("\n");
+
+	for (int32 I = 0; I < Samples.Num(); ++I)
+	{
+		const FAGX_StatisticsSample& Sample = Samples[GetIndex(I)];
+		Csv += FString::Printf(TEXT("%.6f"), Sample.TimeStamp);
+		for (const FProperty* Property : Properties)
+		{
+			// Statistics not reported by AGX Dynamics are written as empty cells.
+			double Value;
+			Csv += GetValue(*Property, Sample.Statistics, Value)
+					   ? FString::Printf(TEXT(",%g"), Value)
+					   : FString(TEXT(","));
+		}
+		Csv += TEXT("\n");
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *FilePath))
+	{
+		UE_LOG(
+			LogAGX, Warning, TEXT("Could not write AGX Dynamics statistics history to '%s'."),
+			*FilePath);
+		return false;
+	}
+
+	return true;
+}
@@ -772,6 +772,9 @@ void UAGX_TrackComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	// The visual track nodes are placed from the native Track, which must not be mid-step.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
 	UpdateVisuals();
 }
 
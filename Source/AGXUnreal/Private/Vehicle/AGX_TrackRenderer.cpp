@@ -4,6 +4,7 @@
 
 // AGX Dynamics for Unreal includes.
 #include "AGX_LogCategory.h"
+#include "AGX_Simulation.h"
 #include "Utilities/AGX_NotificationUtilities.h"
 #include "Utilities/AGX_ObjectUtilities.h"
 #include "Utilities/AGX_StringUtilities.h"
@@ -145,6 +146,9 @@ void UAGX_TrackRenderer::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	// Synchronize Visuals reads the node transforms of the native Track.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
 
 	// \todo We do not need to sync visual transforms if physics simulation have not been
 	//       stepped since last time we synchronized.
@@ -1807,6 +1807,9 @@ void UAGX_WireComponent::TickComponent(
 	float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	// Update Visuals walks the render nodes of the native Wire, which the step may change.
+	if (UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(this))
+		Simulation->WaitForStepForward();
 	UpdateVisuals();
 }
 
@@ -90,6 +90,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Rigid Body")
 	bool ReadTransformFromNative();
 
+	/**
+	 * Apply a Rigid Body state that has already been read from the native AGX Dynamics object.
+	 * Has the same effect as Tick Component, but without any additional reads from the native.
+	 *
+	 * Used by the AGX Simulation when Enable Batched Rigid Body Sync is set, in which case Tick
+	 * Component does not synchronize the Rigid Body Component.
+	 */
+	void SynchronizeFromNative(
+		const FVector& InPosition, const FQuat& InRotation, const FVector& InVelocity,
+		const FVector& InAngularVelocity);
+
 	UPROPERTY(EditAnywhere, Category = "AGX Dynamics")
 	bool bEnabled = true;
 
@@ -579,6 +590,13 @@ private:
 	/// A variant of WriteTransformToNative that only writes if we have a Native to write to.
 	void TryWriteTransformToNative();
 
+	/**
+	 * Move the Transform Target so that this Rigid Body Component ends up at the given location
+	 * and rotation, and set the Transform Target's Component Velocity.
+	 */
+	bool ApplyTransformFromNative(
+		const FVector& NewLocation, const FQuat& NewRotation, const FVector& NewVelocity);
+
 #if WITH_EDITOR
 	virtual bool CanEditChange(const FProperty* InProperty) const override;
 	void DisableTransformRootCompIfMultiple();
@@ -588,4 +606,10 @@ private:
 	// The AGX Dynamics object only exists while simulating. Initialized in
 	// BeginPlay and released in EndPlay.
 	FRigidBodyBarrier NativeBarrier;
+
+	// Index into the AGX Simulation's list of Rigid Bodies synchronized in batch, or INDEX_NONE if
+	// this Rigid Body Component is synchronized by Tick Component.
+	int32 BatchedSyncIndex {INDEX_NONE};
+
+	friend class UAGX_Simulation;
 };
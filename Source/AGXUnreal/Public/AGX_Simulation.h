@@ -6,11 +6,14 @@
 #include "AGX_SimulationEnums.h"
 #include "Contacts/AGX_ShapeContact.h"
 #include "Contacts/AGX_ContactEnums.h"
+#include "Contacts/ContactListenerBarrier.h"
 #include "Contacts/ShapeContactBarrier.h"
 #include "Net/WebDebuggerServerBarrier.h"
 #include "SimulationBarrier.h"
+#include "Utilities/AGX_StatisticsHistory.h"
 
 // Unreal Engine includes.
+#include "Async/TaskGraphInterfaces.h"
 #include "Containers/Map.h"
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
@@ -204,10 +207,93 @@ public: // Properties.
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Simulation Stepping Mode")
 	double TimeLagCap = 1.0;
 
-	/** Set to true to enable statistics gathering in AGX Dynamics. */
+	/**
+	 * Set to true to run the AGX Dynamics step forward on a worker thread instead of on the game
+	 * thread. The step is started by the AGX Stepper in the Pre Physics Tick Group and joined in
+	 * Async Step Join Tick Group, allowing game logic ticking in between to overlap with the
+	 * solver.
+	 *
+	 * Pre Step Forward is broadcast on the game thread right before the step is started and Post
+	 * Step Forward is broadcast on the game thread when the step is joined. AGX Dynamics state
+	 * must not be read or written in between, call Wait For Step Forward first if that is needed.
+	 * If more than one step is required in a frame then the remaining steps are performed
+	 * synchronously at the join.
+	 *
+	 * Stepping falls back to synchronous while there are Contact Event Listeners, since those
+	 * call into game code from within the step.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Simulation Stepping Mode")
+	bool bEnableAsyncStepping {false};
+
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void SetEnableAsyncStepping(bool bEnable);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Simulation")
+	bool GetEnableAsyncStepping() const;
+
+	/**
+	 * The Tick Group in which an asynchronous step is waited for, at the latest. Must be in the
+	 * range Pre Physics to During Physics since AGX Dynamics for Unreal Components read the
+	 * simulation state from During Physics and onwards. Changes take effect on the next Begin
+	 * Play.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadOnly, Category = "Simulation Stepping Mode",
+		Meta = (EditCondition = "bEnableAsyncStepping"))
+	TEnumAsByte<ETickingGroup> AsyncStepJoinTickGroup {TG_DuringPhysics};
+
+	/**
+	 * Set to true to read the state of all Rigid Bodies from AGX Dynamics in one batch after
+	 * stepping, instead of having every Rigid Body Component read its own state in its Tick
+	 * Component. The batch is read by the AGX Stepper in the Post Physics Tick Group and Tick
+	 * Component no longer synchronizes the Rigid Body Components. Tick is disabled for Rigid Body
+	 * Components that are not of a subclass, since nothing else happens in their Tick. Reduces the
+	 * per-frame overhead for scenes with many Rigid Bodies.
+	 *
+	 * Read when a Rigid Body Component begins play, so changes only affect Rigid Bodies created
+	 * after the change.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Simulation Stepping Mode")
+	bool bEnableBatchedRigidBodySync {false};
+
+	/**
+	 * Set to true to enable statistics gathering in AGX Dynamics.
+	 *
+	 * The statistics are only read from AGX Dynamics when they are used, i.e. when Unreal Engine
+	 * is collecting stats, e.g. for 'stat AGXDynamicsStepTimers', or when a sample is to be added
+	 * to the statistics history.
+	 */
 	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Statistics")
 	bool bEnableStatistics {true};
 
+	/**
+	 * Set to true to record the AGX Dynamics statistics into a fixed-size in-memory history. The
+	 * history can be queried with Get Statistics Summary and written to file with Export
+	 * Statistics History. Requires Enable Statistics.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadWrite, Category = "Statistics",
+		Meta = (EditCondition = "bEnableStatistics"))
+	bool bEnableStatisticsHistory {false};
+
+	/**
+	 * The number of samples kept in the statistics history. When full, the oldest sample is
+	 * replaced. Changing the size discards the current history.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadWrite, Category = "Statistics",
+		Meta = (EditCondition = "bEnableStatistics && bEnableStatisticsHistory", ClampMin = "1"))
+	int32 StatisticsHistorySize {4096};
+
+	/**
+	 * The number of steps between two samples in the statistics history. A sampling period of 1
+	 * records every step.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadWrite, Category = "Statistics",
+		Meta = (EditCondition = "bEnableStatistics && bEnableStatisticsHistory", ClampMin = "1"))
+	int32 StatisticsSamplingPeriod {1};
+
 	/**
 	 * Set to true to enable the contact event listener that triggers the On Impact and On Contact
 	 * events in AGX Simulation. Enabling this is not necessary if you only use Contact Event
@@ -276,6 +362,27 @@ public: // Properties.
 		Meta = (AllowedClasses = "/Script/AGXUnreal.AGX_LidarSurfaceMaterial"))
 	FSoftObjectPath DefaultLidarSurfaceMaterial;
 
+	/**
+	 * Whether the heights read from a Landscape when creating a Terrain or Height Field are cached
+	 * on disk, in Saved/AGXUnreal/HeightCache, and reused while the Landscape is unchanged.
+	 *
+	 * When cooking, the heights are also written next to the cooked package of the Terrain or
+	 * Height Field, and cooked builds read them from there instead of from the Landscape. Cooked
+	 * builds never write to the height cache.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Landscape Height Cache")
+	bool bEnableLandscapeHeightCache {true};
+
+	/**
+	 * The maximum total size of the Landscape height cache [MiB]. When a new entry makes the cache
+	 * larger than this, the least recently used entries are removed. Entries for Landscapes that
+	 * have since been edited are never used again, so this is also what removes those.
+	 */
+	UPROPERTY(
+		Config, EditAnywhere, BlueprintReadOnly, Category = "Landscape Height Cache",
+		Meta = (EditCondition = "bEnableLandscapeHeightCache", ClampMin = "0", UIMin = "0"))
+	int32 LandscapeHeightCacheMaxSizeMiB {512};
+
 #if WITH_EDITORONLY_DATA
 
 	/**
@@ -362,6 +469,22 @@ public: // Properties.
 	UFUNCTION(BlueprintCallable, Category = "AGX Dynamics")
 	TArray<FAGX_ShapeContact> GetShapeContacts() const;
 
+	/**
+	 * Copy the Shape Contacts selected by the filter into a flat, structure-of-arrays, snapshot.
+	 * Much cheaper than Get Shape Contacts for large numbers of contacts since there are no
+	 * per-contact allocations. Reuse the same snapshot between calls to also avoid reallocating
+	 * the arrays.
+	 *
+	 * Use Get Shape Component By Guid and Get Rigid Body Component By Guid to find the Components
+	 * involved in a Shape Contact.
+	 *
+	 * @param Snapshot The snapshot to fill, any previous contents are removed.
+	 * @param Filter Selects the Shape Contacts to include. Leave empty to include all.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX Dynamics")
+	void GetShapeContactSnapshot(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, const FAGX_ShapeContactFilter& Filter);
+
 	/**
 	 * Maximum distance between the active Viewport camera and any AGX Constraint within which
 	 * the AGX Constraint graphical representation is scaled such that it's size is constant as
@@ -440,6 +563,38 @@ public: // Member functions.
 	UFUNCTION(BlueprintCallable, Category = "Statistics")
 	FAGX_Statistics GetStatistics();
 
+	/**
+	 * Get all samples in the statistics history, oldest first. Enable Statistics History must be
+	 * enabled for samples to be recorded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Statistics")
+	TArray<FAGX_StatisticsSample> GetStatisticsHistory() const;
+
+	/**
+	 * Aggregate a single statistic over all samples in the statistics history.
+	 *
+	 * @param StatisticName The name of a member of AGX Statistics, e.g. Sim_StepForwardTime.
+	 * @param Percentile The percentile to compute, in the range [0, 100].
+	 * @param OutSummary Min, max, mean and percentile of the statistic.
+	 * @return False if there is no statistic named Statistic Name.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Statistics")
+	bool GetStatisticsSummary(
+		FName StatisticName, double Percentile, FAGX_StatisticsSummary& OutSummary) const;
+
+	/**
+	 * Write the statistics history, oldest first, to a comma-separated values file with one row per
+	 * sample.
+	 *
+	 * @return True if the file was written.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Statistics")
+	bool ExportStatisticsHistory(const FString& FilePath) const;
+
+	/// Discard all samples in the statistics history.
+	UFUNCTION(BlueprintCallable, Category = "Statistics")
+	void ClearStatisticsHistory();
+
 	/**
 	 * Returns the current time within the AGX Dynamics simulation world.
 	 *
@@ -586,6 +741,94 @@ public: // Member functions.
 	UFUNCTION(BlueprintCallable, Category = "Simulation")
 	void StepOnce();
 
+	/**
+	 * Block until an asynchronous step forward that is in flight has completed and its Post Step
+	 * Forward delegates have been broadcast. Does nothing if no step is in flight, which is always
+	 * the case when Enable Async Stepping is false.
+	 *
+	 * Call this before reading or writing AGX Dynamics state from game logic that ticks before
+	 * the Async Step Join Tick Group.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Simulation")
+	void WaitForStepForward();
+
+	/**
+	 * @return True if an asynchronous step forward has been started but not yet joined.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Simulation")
+	bool IsStepForwardInProgress() const;
+
+	/**
+	 * The Tick Group, clamped to the supported range, in which an asynchronous step is joined.
+	 */
+	ETickingGroup GetAsyncStepJoinTickGroup() const;
+
+	/**
+	 * Called by Contact Event Listener Components when they register their AGX Dynamics
+	 * listener. Contact events call into game code from within the step, so asynchronous stepping
+	 * is disabled for as long as there are listeners.
+	 */
+	void NotifyContactEventListenerCreated();
+
+	/**
+	 * Called by Contact Event Listener Components when they remove their AGX Dynamics listener,
+	 * typically in EndPlay. Asynchronous stepping is possible again once no listeners remain.
+	 */
+	void NotifyContactEventListenerDestroyed();
+
+	/**
+	 * Get the Shape Component that owns the AGX Dynamics Geometry with the given GUID. This is a
+	 * constant time lookup in a registry that is updated as Shapes are added to and removed from
+	 * this Simulation.
+	 *
+	 * @return The Shape Component, or nullptr if no Shape Component in this Simulation owns the
+	 * Geometry. That is the case for e.g. Wire segments and Geometries created from C++.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Dynamics")
+	UAGX_ShapeComponent* GetShapeComponentByGuid(const FGuid& GeometryGuid) const;
+
+	/**
+	 * Get the Rigid Body Component that owns the AGX Dynamics Rigid Body with the given GUID.
+	 * Constant time, see GetShapeComponentByGuid.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Dynamics")
+	UAGX_RigidBodyComponent* GetRigidBodyComponentByGuid(const FGuid& Guid) const;
+
+	/**
+	 * Like GetShapeComponentByGuid, but searches every Simulation that has a native. For callers
+	 * that do not know which Simulation, or World, the GUID came from.
+	 */
+	static UAGX_ShapeComponent* FindShapeComponentByGuid(const FGuid& GeometryGuid);
+
+	/**
+	 * Like GetRigidBodyComponentByGuid, but searches every Simulation that has a native.
+	 */
+	static UAGX_RigidBodyComponent* FindRigidBodyComponentByGuid(const FGuid& Guid);
+
+	/**
+	 * Make the Component findable by GUID. Done automatically by Add. Components that are given
+	 * an existing native, e.g. during Blueprint reconstruction, call this directly.
+	 */
+	void RegisterGuid(UAGX_ShapeComponent& Shape);
+	void RegisterGuid(UAGX_RigidBodyComponent& Body);
+
+	/**
+	 * Called by Rigid Body Components that begin play while Enable Batched Rigid Body Sync is set.
+	 * The Rigid Body Component is then synchronized by SynchronizeRigidBodies until it is removed
+	 * with RemoveFromBatchedSync.
+	 */
+	void AddToBatchedSync(UAGX_RigidBodyComponent& Body);
+
+	void RemoveFromBatchedSync(UAGX_RigidBodyComponent& Body);
+
+	/**
+	 * Read the position, rotation, velocity, and angular velocity of all Rigid Bodies added with
+	 * AddToBatchedSync from AGX Dynamics in one batch and apply them to the Rigid Body Components.
+	 *
+	 * Called by the AGX Stepper in the Post Physics Tick Group.
+	 */
+	void SynchronizeRigidBodies();
+
 	/**
 	 * Set true to integrate positions at the start of the timestep rather than at the end.
 	 * Set false to integrate positions at the end of the timestep.
@@ -669,14 +912,43 @@ private:
 	 */
 	void OnLevelTransition();
 
-	int32 StepCatchUpImmediately(double DeltaTime);
-	int32 StepCatchUpOverTime(double DeltaTime);
-	int32 StepCatchUpOverTimeCapped(double DeltaTime);
-	int32 StepDropImmediately(double DeltaTime);
+	/**
+	 * Compute the number of steps to take this frame according to the current Step Mode, and
+	 * update LeftoverTime accordingly.
+	 */
+	int32 GetNumStepsToTake(double DeltaTime);
+
+	int32 GetNumStepsCatchUpImmediately(double DeltaTime);
+	int32 GetNumStepsCatchUpOverTime(double DeltaTime);
+	int32 GetNumStepsCatchUpOverTimeCapped(double DeltaTime);
+	int32 GetNumStepsDropImmediately(double DeltaTime);
+
+	/// Pre step, native step, and post step, all on the calling thread.
+	void StepForward();
+
+	bool CanStepAsync() const;
+
+	/**
+	 * Broadcast Pre Step Forward and start the native step on a worker thread. The remaining
+	 * NumSteps - 1 steps are taken synchronously by FinishAsyncStep.
+	 */
+	void StartAsyncStep(int32 NumSteps, uint64 StartCycle, double DeltaTime);
+
+	/// Wait for the native step started by StartAsyncStep and do everything that follows it.
+	void FinishAsyncStep();
+
+	/// Update the stats counters and debug rendering once all steps of a frame have been taken.
+	void ReportFrameStepped(int32 NumSteps, uint64 StartCycle, double DeltaTime);
 
 	void PreStep();
 	void PostStep();
 
+	/**
+	 * Read the AGX Dynamics statistics for the step just taken, if they are needed by the stat
+	 * counters or the statistics history.
+	 */
+	void RecordStepStatistics();
+
 	/**
 	 * Called by AGX Dynamics when two Shapes first touch, if Enable Global Contact Event Listener
 	 * is true. Triggers the On Impact delegate.
@@ -720,6 +992,10 @@ private:
 	FSimulationBarrier NativeBarrier;
 	FWebDebuggerServerBarrier DebuggerBarrier;
 
+	// Forwards contact events to OnImpact, OnContact and OnSeparation. Only created when
+	// bEnableGlobalContactEventListener is set.
+	FContactEventListenerBarrier GlobalContactEventListener;
+
 	/// Time that we couldn't step because DeltaTime was not an even multiple
 	/// of the AGX Dynamics step size. That fraction of a time step is carried
 	/// over to the next call to Step.
@@ -728,6 +1004,14 @@ private:
 	// The time it took to do a frame's stepping the last frame we actually took a step.
 	double LastTotalStepTime {0.0};
 
+	// The statistics read by the most recent call to RecordStepStatistics.
+	FAGX_Statistics LastStepStatistics;
+
+	FAGX_StatisticsHistory StatisticsHistory;
+
+	// The number of steps since the last sample was added to the statistics history.
+	int32 StepsSinceStatisticsSample {0};
+
 	TWeakObjectPtr<AAGX_Stepper> Stepper;
 
 	// Record for keeping track of the number of times any Contact Material has been
@@ -738,5 +1022,41 @@ private:
 	FOnPreStepForwardInternal PreStepForwardInternal;
 	FOnPostStepForwardInternal PostStepForwardInternal;
 
+	// Asynchronous stepping state. AsyncStepEvent is non-null while a native step is running on a
+	// worker thread. The remaining members describe the frame that the step belongs to.
+	FGraphEventRef AsyncStepEvent;
+	int32 AsyncStepNumSteps {0};
+	uint64 AsyncStepStartCycle {0};
+	double AsyncStepDeltaTime {0.0};
+
+	// The number of Contact Event Listener Components that has registered an AGX Dynamics listener
+	// with the current native Simulation.
+	int32 NumContactEventListeners {0};
+
+	// GUID to Component registries used to find the Component that owns an AGX Dynamics object,
+	// e.g. when handling contact events. The keys are the GUIDs of the AGX Dynamics Geometry and
+	// Rigid Body, respectively. Entries are validated on lookup since Components may be destroyed
+	// without being removed from the Simulation, e.g. at the end of a Play In Editor session.
+	TMap<FGuid, TWeakObjectPtr<UAGX_ShapeComponent>> ShapesByGuid;
+	TMap<FGuid, TWeakObjectPtr<UAGX_RigidBodyComponent>> RigidBodiesByGuid;
+
+	// Rigid Body Components synchronized by SynchronizeRigidBodies. Each Rigid Body Component
+	// knows its own index in this list, allowing constant time removal.
+	TArray<TWeakObjectPtr<UAGX_RigidBodyComponent>> BatchedSyncBodies;
+
+	// Scratch buffers used by SynchronizeRigidBodies, kept between frames to avoid reallocations.
+	// Bodies and Barriers hold the Rigid Bodies that are read this frame and the remaining arrays
+	// the state read for each of them.
+	struct FBatchedSyncBuffers
+	{
+		TArray<UAGX_RigidBodyComponent*> Bodies;
+		TArray<const FRigidBodyBarrier*> Barriers;
+		TArray<FVector> Positions;
+		TArray<FQuat> Rotations;
+		TArray<FVector> Velocities;
+		TArray<FVector> AngularVelocities;
+	};
+	FBatchedSyncBuffers BatchedSyncBuffers;
+
 	friend class FAGX_InternalDelegateAccessor;
 };
@@ -3,9 +3,70 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
 #include "GameFramework/Actor.h"
 #include "AGX_Stepper.generated.h"
 
+class AAGX_Stepper;
+
+/**
+ * Tick Function that joins an asynchronous AGX Dynamics step started by the AGX Stepper's primary
+ * tick. Ticks in the AGX Simulation's Async Step Join Tick Group.
+ */
+USTRUCT()
+struct FAGX_StepperJoinTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	AAGX_Stepper* Target {nullptr};
+
+	//~ Begin FTickFunction interface.
+	virtual void ExecuteTick(
+		float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+		const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	//~ End FTickFunction interface.
+};
+
+template <>
+struct TStructOpsTypeTraits<FAGX_StepperJoinTickFunction>
+	: public TStructOpsTypeTraitsBase2<FAGX_StepperJoinTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Tick Function that reads the state of all Rigid Bodies using batched synchronization from AGX
+ * Dynamics in one go. Ticks in the Post Physics Tick Group.
+ */
+USTRUCT()
+struct FAGX_StepperSyncTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	AAGX_Stepper* Target {nullptr};
+
+	//~ Begin FTickFunction interface.
+	virtual void ExecuteTick(
+		float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+		const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	//~ End FTickFunction interface.
+};
+
+template <>
+struct TStructOpsTypeTraits<FAGX_StepperSyncTickFunction>
+	: public TStructOpsTypeTraitsBase2<FAGX_StepperSyncTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 UCLASS(ClassGroup = "AGX", Category = "AGX", NotPlaceable)
 class AGXUNREAL_API AAGX_Stepper : public AActor
 {
@@ -18,4 +79,16 @@ public:
 	void Tick(float DeltaTime) override;
 
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
+
+	/// Called by the join Tick Function. Waits for any asynchronous step that is in flight.
+	void JoinStep();
+
+	/// Called by the sync Tick Function. Reads the state of all Rigid Bodies from AGX Dynamics.
+	void SynchronizeRigidBodies();
+
+private:
+	FAGX_StepperJoinTickFunction JoinTickFunction;
+	FAGX_StepperSyncTickFunction SyncTickFunction;
 };
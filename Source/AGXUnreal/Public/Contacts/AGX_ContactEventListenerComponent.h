@@ -5,6 +5,7 @@
 // AGX Dynamics for Unreal includes.
 #include "Contacts/AGX_ContactEnums.h"
 #include "Contacts/AGX_ShapeContact.h"
+#include "Contacts/ContactListenerBarrier.h"
 
 // Unreal Engine includes
 #include "CoreMinimal.h"
@@ -13,6 +14,7 @@
 #include "AGX_ContactEventListenerComponent.generated.h"
 
 class UAGX_ShapeComponent;
+class UAGX_Simulation;
 
 /**
  * Provides access to AGX Dynamics Shape Contacts before contact pruning and Contact Constraint
@@ -98,6 +100,7 @@ public: // Blueprint Native Events.
 public: // Member function overrides.
 	//~ Begin UActorComponent interface.
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
 	//~ End UActorComponent interface.
 
 private: // Internal callbacks. These are passed to the AGX Dynamics Contact Event Listener.
@@ -105,4 +108,10 @@ private: // Internal callbacks. These are passed to the AGX Dynamics Contact Eve
 	EAGX_KeepContactPolicy ContactCallback(double TimeStamp, FShapeContactBarrier& ShapeContact);
 	void SeparationCallback(
 		double TimeStamp, FAnyShapeBarrier& FirstShape, FAnyShapeBarrier& SecondShape);
+
+private:
+	FContactEventListenerBarrier NativeBarrier;
+
+	// The Simulation the listener was added to, notified when the listener is removed.
+	TWeakObjectPtr<UAGX_Simulation> Simulation;
 };
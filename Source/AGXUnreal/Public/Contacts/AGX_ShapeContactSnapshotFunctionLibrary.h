@@ -0,0 +1,106 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Contacts/AGX_ShapeContactSnapshot.h"
+
+// Unreal Engine includes.
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "AGX_ShapeContactSnapshotFunctionLibrary.generated.h"
+
+/**
+ * This class acts as an API that exposes the contents of FAGX_ShapeContactSnapshot in Blueprints.
+ *
+ * The snapshot is passed by reference and each function reads a single element in place, so
+ * iterating over a snapshot does not copy its arrays. Shape Contact functions take a Shape Contact
+ * index in the range [0, Get Num Shape Contacts), Contact Point functions take a Contact Point
+ * index in the range [0, Get Num Contact Points).
+ */
+UCLASS()
+class AGXUNREAL_API UAGX_ShapeContactSnapshot_FL : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static int32 GetNumShapeContacts(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static int32 GetNumContactPoints(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot);
+
+	/*
+	 * Shape Contact accessors.
+	 */
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FGuid GetFirstShapeGuid(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FGuid GetSecondShapeGuid(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	/**
+	 * GUID of the Rigid Body of the first Shape, invalid if the Shape has no Rigid Body.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FGuid GetFirstBodyGuid(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	/**
+	 * GUID of the Rigid Body of the second Shape, invalid if the Shape has no Rigid Body.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FGuid GetSecondBodyGuid(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	/**
+	 * The Contact Point index of the first Contact Point in the Shape Contact.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static int32 GetFirstPointIndex(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	/**
+	 * The number of Contact Points in the Shape Contact.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static int32 GetNumPoints(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 ShapeContactIndex);
+
+	/*
+	 * Contact Point accessors.
+	 */
+
+	/**
+	 * World location of the Contact Point [cm].
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FVector GetLocation(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex);
+
+	/**
+	 * Contact normal of the Contact Point, pointing from the second Shape towards the first.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FVector GetNormal(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex);
+
+	/**
+	 * Penetration depth of the Contact Point [cm].
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static double GetDepth(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex);
+
+	/**
+	 * Contact force of the Contact Point, as given to the first Shape [N].
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static FVector GetForce(UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex);
+
+	/**
+	 * Index of the Shape Contact that the Contact Point belongs to.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AGX Shape Contact Snapshot")
+	static int32 GetShapeContactIndex(
+		UPARAM(Ref) FAGX_ShapeContactSnapshot& Snapshot, int32 PointIndex);
+};
@@ -84,6 +84,14 @@ struct AGXUNREAL_API FAGX_ImportContext
 	// The key is the GUID of the Trimesh Shape.
 	TUniquePtr<TMap<FGuid, UStaticMesh*>> CollisionStaticMeshes;
 
+	// Meshes with different GUIDs may still be identical, for example many instances of the same
+	// bolt in a CAD model. These share a single Static Mesh, found through the content hash of the
+	// mesh data and the material. The Static Meshes are also in RenderStaticMeshes and
+	// CollisionStaticMeshes, under the GUID of the first mesh with that content.
+	using FMeshContentKey = TPair<FString, UMaterialInterface*>;
+	TUniquePtr<TMap<FMeshContentKey, UStaticMesh*>> RenderStaticMeshesByContent;
+	TUniquePtr<TMap<FMeshContentKey, UStaticMesh*>> CollisionStaticMeshesByContent;
+
 	TUniquePtr<TMap<FGuid, UAGX_MergeSplitThresholdsBase*>> MSThresholds;
 	TUniquePtr<TMap<FGuid, UAGX_ShapeMaterial*>> ShapeMaterials;
 	TUniquePtr<TMap<FGuid, UAGX_ContactMaterial*>> ContactMaterials;
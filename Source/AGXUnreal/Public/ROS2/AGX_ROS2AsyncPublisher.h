@@ -0,0 +1,136 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Enums.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Templates/Function.h"
+
+// Standard library includes.
+#include <atomic>
+
+#include "AGX_ROS2AsyncPublisher.generated.h"
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Publishing statistics for one topic of an asynchronous ROS2 Publisher.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_ROS2PublisherStatistics
+{
+	GENERATED_BODY()
+
+	/** The number of messages that have been published on the topic. */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	int64 NumPublished {0};
+
+	/** The number of messages that were discarded because the queue of the topic was full. */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	int64 NumDropped {0};
+
+	/** The number of messages currently waiting in the queue of the topic. */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	int32 NumQueued {0};
+
+	/** The average time from a message being sent until it has been published [s]. */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	double AverageLatency {0.0};
+
+	/** The longest time from a message being sent until it has been published [s]. */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	double MaxLatency {0.0};
+
+	/**
+	 * The number of messages published per second, measured from the first to the latest
+	 * published message [1/s].
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "AGX ROS2")
+	double Throughput {0.0};
+};
+
+/**
+ * Background thread that publishes ROS2 messages on behalf of a ROS2 Publisher Component, so that
+ * converting and publishing large messages doesn't cost frame time.
+ *
+ * Each topic has a bounded queue. When the queue is full, Enqueue either discards the oldest
+ * message or waits, depending on the Queue Full Policy. The thread publishes one message from each
+ * topic with queued messages in turn, so that a heavy topic cannot starve the others, and messages
+ * of the same topic are published in the order they were sent.
+ *
+ * Enqueue, Flush and GetStatistics are meant to be called from the game thread.
+ */
+class AGXUNREAL_API FAGX_ROS2AsyncPublisher : private FRunnable
+{
+public:
+	/** Publishes one message, returns true if the message was sent. */
+	using FPublishFunction = TUniqueFunction<bool()>;
+
+	FAGX_ROS2AsyncPublisher(int32 InQueueCapacity, EAGX_ROS2QueueFullPolicy InQueueFullPolicy);
+
+	/** Stops the thread. Messages that have not been published yet are discarded. */
+	virtual ~FAGX_ROS2AsyncPublisher() override;
+
+	/**
+	 * Queue a message for publishing on the given topic. Everything Publish refers to must remain
+	 * valid until the message has been published or this publisher has been destroyed.
+	 *
+	 * The queue is selected by TopicIndex, which must always be the same for a topic and should be
+	 * small since queues are created for all indices up to it. The ROS2 Publisher Component uses
+	 * the index of the topic's Barrier. Topic is only read when the queue is created, and names the
+	 * queue for GetStatistics.
+	 *
+	 * Returns false if the publisher is shutting down and the message was not queued.
+	 */
+	bool Enqueue(int32 TopicIndex, const FString& Topic, FPublishFunction Publish);
+
+	/** Wait until every queued message has been published. */
+	void Flush();
+
+	FAGX_ROS2PublisherStatistics GetStatistics(const FString& Topic) const;
+
+private:
+	struct FQueuedMessage
+	{
+		FPublishFunction Publish;
+		double EnqueueTime {0.0};
+	};
+
+	struct FTopicQueue
+	{
+		FString Topic;
+		TArray<FQueuedMessage> Messages; // Oldest first.
+		bool bPublishing {false};
+		int64 NumPublished {0};
+		int64 NumDropped {0};
+		double TotalLatency {0.0};
+		double MaxLatency {0.0};
+		double FirstPublishTime {0.0};
+		double LastPublishTime {0.0};
+	};
+
+	//~ Begin FRunnable interface.
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable interface.
+
+	bool IsIdle() const; // Must hold Lock.
+
+	const int32 QueueCapacity;
+	const EAGX_ROS2QueueFullPolicy QueueFullPolicy;
+
+	mutable FCriticalSection Lock;
+	TArray<FTopicQueue> Topics; // Indexed by the TopicIndex passed to Enqueue.
+	int32 NextTopic {0}; // Where the round robin over the topics continues.
+
+	std::atomic<bool> bStopping {false};
+	FEvent* WorkAvailable {nullptr};
+	FEvent* MessagePublished {nullptr};
+	FRunnableThread* Thread {nullptr};
+};
@@ -3,7 +3,9 @@
 #pragma once
 
 // AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2AsyncPublisher.h"
 #include "ROS2/AGX_ROS2Messages.h"
+#include "ROS2/AGX_ROS2TopicHandle.h"
 #include "ROS2/ROS2PublisherBarrier.h"
 #include "ROS2/AGX_ROS2Enums.h"
 #include "ROS2/AGX_ROS2Qos.h"
@@ -46,12 +48,64 @@ public:
 	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
 	uint8 DomainID {0};
 
+	/**
+	 * If true, messages are converted and published by a background thread instead of in the Send
+	 * call. The Send functions then return true when the message has been queued, not when it has
+	 * been published. Messages on the same topic are published in the order they were sent.
+	 *
+	 * Useful for large messages such as images and point clouds.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2")
+	bool bPublishAsync {false};
+
+	/**
+	 * The maximum number of messages per topic waiting to be published by the background thread.
+	 */
+	UPROPERTY(
+		EditAnywhere, Category = "AGX ROS2",
+		Meta = (EditCondition = "bPublishAsync", ClampMin = "1", UIMin = "1"))
+	int32 AsyncQueueCapacity {8};
+
+	/**
+	 * What to do when a message is sent on a topic whose queue is full. Either discard the oldest
+	 * queued message or wait until the background thread has published a message.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX ROS2", Meta = (EditCondition = "bPublishAsync"))
+	EAGX_ROS2QueueFullPolicy QueueFullPolicy {EAGX_ROS2QueueFullPolicy::DropOldest};
+
+	/**
+	 * Get publishing statistics, such as latency and dropped messages, for the given topic.
+	 * Only available when Publish Async is enabled, all zeros otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX ROS2")
+	FAGX_ROS2PublisherStatistics GetTopicStatistics(const FString& Topic) const;
+
+	/**
+	 * Wait until all messages queued for the background thread have been published. Does nothing
+	 * when Publish Async is disabled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AGX ROS2")
+	void FlushAsyncQueue();
+
 	/**
 	 * Returns a Barrier object from the Barrier pool, given the specific Topic.
 	 * If no previous Barrier exists for the passed Topic, a new one is created and stored.
 	 */
 	FROS2PublisherBarrier* GetOrCreateBarrier(EAGX_ROS2MessageType Type, const FString& Topic);
 
+	/**
+	 * Returns the Barrier of the topic the given handle refers to. The handle is resolved from its
+	 * Topic, and updated, if it has not been used with this Component and message type before.
+	 */
+	FROS2PublisherBarrier* GetOrCreateBarrier(
+		EAGX_ROS2MessageType Type, FAGX_ROS2TopicHandle& Handle);
+
+	/**
+	 * Create a resolved handle for the given topic. Sending through the handle skips the topic
+	 * lookup done by the Send functions taking a Topic string.
+	 */
+	FAGX_ROS2TopicHandle GetTopicHandle(EAGX_ROS2MessageType Type, const FString& Topic);
+
 	// AgxMsgs
 
 	UFUNCTION(BlueprintCallable, Category = "AGX ROS2", Meta = (DisplayName = "Send agx_msgs::Any"))
@@ -524,6 +578,831 @@ public:
 	bool SendSensorMsgsTimeReference(
 		const FAGX_SensorMsgsTimeReference& Message, const FString& Topic);
 
+	// Topic Handle variants of the Send functions, see FAGX_ROS2TopicHandle.
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send agx_msgs::Any (Handle)"))
+	bool SendAgxMsgsAnyByHandle(
+		const FAGX_AgxMsgsAny& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send agx_msgs::AnySequence (Handle)"))
+	bool SendAgxMsgsAnySequenceByHandle(
+		const FAGX_AgxMsgsAnySequence& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send builtin_interfaces::Time (Handle)"))
+	bool SendBuiltinInterfacesTimeByHandle(
+		const FAGX_BuiltinInterfacesTime& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send builtin_interfaces::Duration (Handle)"))
+	bool SendBuiltinInterfacesDurationByHandle(
+		const FAGX_BuiltinInterfacesDuration& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send rosgraph_msgs::Clock (Handle)"))
+	bool SendRosgraphMsgsClockByHandle(
+		const FAGX_RosgraphMsgsClock& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Bool (Handle)"))
+	bool SendStdMsgsBoolByHandle(
+		const FAGX_StdMsgsBool& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Byte (Handle)"))
+	bool SendStdMsgsByteByHandle(
+		const FAGX_StdMsgsByte& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::ByteMultiArray (Handle)"))
+	bool SendStdMsgsByteMultiArrayByHandle(
+		const FAGX_StdMsgsByteMultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Char (Handle)"))
+	bool SendStdMsgsCharByHandle(
+		const FAGX_StdMsgsChar& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::ColorRGBA (Handle)"))
+	bool SendStdMsgsColorRGBAByHandle(
+		const FAGX_StdMsgsColorRGBA& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Empty (Handle)"))
+	bool SendStdMsgsEmptyByHandle(
+		const FAGX_StdMsgsEmpty& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Float32 (Handle)"))
+	bool SendStdMsgsFloat32ByHandle(
+		const FAGX_StdMsgsFloat32& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Float32MultiArray (Handle)"))
+	bool SendStdMsgsFloat32MultiArrayByHandle(
+		const FAGX_StdMsgsFloat32MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Float64 (Handle)"))
+	bool SendStdMsgsFloat64ByHandle(
+		const FAGX_StdMsgsFloat64& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Float64MultiArray (Handle)"))
+	bool SendStdMsgsFloat64MultiArrayByHandle(
+		const FAGX_StdMsgsFloat64MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int16 (Handle)"))
+	bool SendStdMsgsInt16ByHandle(
+		const FAGX_StdMsgsInt16& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int16MultiArray (Handle)"))
+	bool SendStdMsgsInt16MultiArrayByHandle(
+		const FAGX_StdMsgsInt16MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int32 (Handle)"))
+	bool SendStdMsgsInt32ByHandle(
+		const FAGX_StdMsgsInt32& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int32MultiArray (Handle)"))
+	bool SendStdMsgsInt32MultiArrayByHandle(
+		const FAGX_StdMsgsInt32MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int64 (Handle)"))
+	bool SendStdMsgsInt64ByHandle(
+		const FAGX_StdMsgsInt64& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int64MultiArray (Handle)"))
+	bool SendStdMsgsInt64MultiArrayByHandle(
+		const FAGX_StdMsgsInt64MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int8 (Handle)"))
+	bool SendStdMsgsInt8ByHandle(
+		const FAGX_StdMsgsInt8& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Int8MultiArray (Handle)"))
+	bool SendStdMsgsInt8MultiArrayByHandle(
+		const FAGX_StdMsgsInt8MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::String (Handle)"))
+	bool SendStdMsgsStringByHandle(
+		const FAGX_StdMsgsString& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt16 (Handle)"))
+	bool SendStdMsgsUInt16ByHandle(
+		const FAGX_StdMsgsUInt16& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt16MultiArray (Handle)"))
+	bool SendStdMsgsUInt16MultiArrayByHandle(
+		const FAGX_StdMsgsUInt16MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt32 (Handle)"))
+	bool SendStdMsgsUInt32ByHandle(
+		const FAGX_StdMsgsUInt32& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt32MultiArray (Handle)"))
+	bool SendStdMsgsUInt32MultiArrayByHandle(
+		const FAGX_StdMsgsUInt32MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt64 (Handle)"))
+	bool SendStdMsgsUInt64ByHandle(
+		const FAGX_StdMsgsUInt64& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt64MultiArray (Handle)"))
+	bool SendStdMsgsUInt64MultiArrayByHandle(
+		const FAGX_StdMsgsUInt64MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt8 (Handle)"))
+	bool SendStdMsgsUInt8ByHandle(
+		const FAGX_StdMsgsUInt8& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::UInt8MultiArray (Handle)"))
+	bool SendStdMsgsUInt8MultiArrayByHandle(
+		const FAGX_StdMsgsUInt8MultiArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send std_msgs::Header (Handle)"))
+	bool SendStdMsgsHeaderByHandle(
+		const FAGX_StdMsgsHeader& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Vector3 (Handle)"))
+	bool SendGeometryMsgsVector3ByHandle(
+		const FAGX_GeometryMsgsVector3& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Quaternion (Handle)"))
+	bool SendGeometryMsgsQuaternionByHandle(
+		const FAGX_GeometryMsgsQuaternion& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Accel (Handle)"))
+	bool SendGeometryMsgsAccelByHandle(
+		const FAGX_GeometryMsgsAccel& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::AccelStamped (Handle)"))
+	bool SendGeometryMsgsAccelStampedByHandle(
+		const FAGX_GeometryMsgsAccelStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::AccelWithCovariance (Handle)"))
+	bool SendGeometryMsgsAccelWithCovarianceByHandle(
+		const FAGX_GeometryMsgsAccelWithCovariance& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::AccelWithCovarianceStamped (Handle)"))
+	bool SendGeometryMsgsAccelWithCovarianceStampedByHandle(
+		const FAGX_GeometryMsgsAccelWithCovarianceStamped& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Inertia (Handle)"))
+	bool SendGeometryMsgsInertiaByHandle(
+		const FAGX_GeometryMsgsInertia& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::InertiaStamped (Handle)"))
+	bool SendGeometryMsgsInertiaStampedByHandle(
+		const FAGX_GeometryMsgsInertiaStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Point (Handle)"))
+	bool SendGeometryMsgsPointByHandle(
+		const FAGX_GeometryMsgsPoint& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Point32 (Handle)"))
+	bool SendGeometryMsgsPoint32ByHandle(
+		const FAGX_GeometryMsgsPoint32& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PointStamped (Handle)"))
+	bool SendGeometryMsgsPointStampedByHandle(
+		const FAGX_GeometryMsgsPointStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Polygon (Handle)"))
+	bool SendGeometryMsgsPolygonByHandle(
+		const FAGX_GeometryMsgsPolygon& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PolygonStamped (Handle)"))
+	bool SendGeometryMsgsPolygonStampedByHandle(
+		const FAGX_GeometryMsgsPolygonStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Pose (Handle)"))
+	bool SendGeometryMsgsPoseByHandle(
+		const FAGX_GeometryMsgsPose& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Pose2D (Handle)"))
+	bool SendGeometryMsgsPose2DByHandle(
+		const FAGX_GeometryMsgsPose2D& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PoseArray (Handle)"))
+	bool SendGeometryMsgsPoseArrayByHandle(
+		const FAGX_GeometryMsgsPoseArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PoseStamped (Handle)"))
+	bool SendGeometryMsgsPoseStampedByHandle(
+		const FAGX_GeometryMsgsPoseStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PoseWithCovariance (Handle)"))
+	bool SendGeometryMsgsPoseWithCovarianceByHandle(
+		const FAGX_GeometryMsgsPoseWithCovariance& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::PoseWithCovarianceStamped (Handle)"))
+	bool SendGeometryMsgsPoseWithCovarianceStampedByHandle(
+		const FAGX_GeometryMsgsPoseWithCovarianceStamped& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::QuaternionStamped (Handle)"))
+	bool SendGeometryMsgsQuaternionStampedByHandle(
+		const FAGX_GeometryMsgsQuaternionStamped& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Transform (Handle)"))
+	bool SendGeometryMsgsTransformByHandle(
+		const FAGX_GeometryMsgsTransform& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::TransformStamped (Handle)"))
+	bool SendGeometryMsgsTransformStampedByHandle(
+		const FAGX_GeometryMsgsTransformStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Twist (Handle)"))
+	bool SendGeometryMsgsTwistByHandle(
+		const FAGX_GeometryMsgsTwist& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::TwistStamped (Handle)"))
+	bool SendGeometryMsgsTwistStampedByHandle(
+		const FAGX_GeometryMsgsTwistStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::TwistWithCovariance (Handle)"))
+	bool SendGeometryMsgsTwistWithCovarianceByHandle(
+		const FAGX_GeometryMsgsTwistWithCovariance& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::TwistWithCovarianceStamped (Handle)"))
+	bool SendGeometryMsgsTwistWithCovarianceStampedByHandle(
+		const FAGX_GeometryMsgsTwistWithCovarianceStamped& Message,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Vector3Stamped (Handle)"))
+	bool SendGeometryMsgsVector3StampedByHandle(
+		const FAGX_GeometryMsgsVector3Stamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::Wrench (Handle)"))
+	bool SendGeometryMsgsWrenchByHandle(
+		const FAGX_GeometryMsgsWrench& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send geometry_msgs::WrenchStamped (Handle)"))
+	bool SendGeometryMsgsWrenchStampedByHandle(
+		const FAGX_GeometryMsgsWrenchStamped& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::BatteryState (Handle)"))
+	bool SendSensorMsgsBatteryStateByHandle(
+		const FAGX_SensorMsgsBatteryState& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::ChannelFloat32 (Handle)"))
+	bool SendSensorMsgsChannelFloat32ByHandle(
+		const FAGX_SensorMsgsChannelFloat32& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::CompressedImage (Handle)"))
+	bool SendSensorMsgsCompressedImageByHandle(
+		const FAGX_SensorMsgsCompressedImage& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::FluidPressure (Handle)"))
+	bool SendSensorMsgsFluidPressureByHandle(
+		const FAGX_SensorMsgsFluidPressure& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Illuminance (Handle)"))
+	bool SendSensorMsgsIlluminanceByHandle(
+		const FAGX_SensorMsgsIlluminance& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Image (Handle)"))
+	bool SendSensorMsgsImageByHandle(
+		const FAGX_SensorMsgsImage& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Imu (Handle)"))
+	bool SendSensorMsgsImuByHandle(
+		const FAGX_SensorMsgsImu& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::JointState (Handle)"))
+	bool SendSensorMsgsJointStateByHandle(
+		const FAGX_SensorMsgsJointState& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Joy (Handle)"))
+	bool SendSensorMsgsJoyByHandle(
+		const FAGX_SensorMsgsJoy& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::JoyFeedback (Handle)"))
+	bool SendSensorMsgsJoyFeedbackByHandle(
+		const FAGX_SensorMsgsJoyFeedback& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::JoyFeedbackArray (Handle)"))
+	bool SendSensorMsgsJoyFeedbackArrayByHandle(
+		const FAGX_SensorMsgsJoyFeedbackArray& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::LaserEcho (Handle)"))
+	bool SendSensorMsgsLaserEchoByHandle(
+		const FAGX_SensorMsgsLaserEcho& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::LaserScan (Handle)"))
+	bool SendSensorMsgsLaserScanByHandle(
+		const FAGX_SensorMsgsLaserScan& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::MagneticField (Handle)"))
+	bool SendSensorMsgsMagneticFieldByHandle(
+		const FAGX_SensorMsgsMagneticField& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::MultiDOFJointState (Handle)"))
+	bool SendSensorMsgsMultiDOFJointStateByHandle(
+		const FAGX_SensorMsgsMultiDOFJointState& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::MultiEchoLaserScan (Handle)"))
+	bool SendSensorMsgsMultiEchoLaserScanByHandle(
+		const FAGX_SensorMsgsMultiEchoLaserScan& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::NavSatStatus (Handle)"))
+	bool SendSensorMsgsNavSatStatusByHandle(
+		const FAGX_SensorMsgsNavSatStatus& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::NavSatFix (Handle)"))
+	bool SendSensorMsgsNavSatFixByHandle(
+		const FAGX_SensorMsgsNavSatFix& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::PointCloud (Handle)"))
+	bool SendSensorMsgsPointCloudByHandle(
+		const FAGX_SensorMsgsPointCloud& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::PointField (Handle)"))
+	bool SendSensorMsgsPointFieldByHandle(
+		const FAGX_SensorMsgsPointField& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::PointCloud2 (Handle)"))
+	bool SendSensorMsgsPointCloud2ByHandle(
+		const FAGX_SensorMsgsPointCloud2& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Range (Handle)"))
+	bool SendSensorMsgsRangeByHandle(
+		const FAGX_SensorMsgsRange& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::RegionOfInterest (Handle)"))
+	bool SendSensorMsgsRegionOfInterestByHandle(
+		const FAGX_SensorMsgsRegionOfInterest& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::CameraInfo (Handle)"))
+	bool SendSensorMsgsCameraInfoByHandle(
+		const FAGX_SensorMsgsCameraInfo& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::RelativeHumidity (Handle)"))
+	bool SendSensorMsgsRelativeHumidityByHandle(
+		const FAGX_SensorMsgsRelativeHumidity& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::Temperature (Handle)"))
+	bool SendSensorMsgsTemperatureByHandle(
+		const FAGX_SensorMsgsTemperature& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Send sensor_msgs::TimeReference (Handle)"))
+	bool SendSensorMsgsTimeReferenceByHandle(
+		const FAGX_SensorMsgsTimeReference& Message, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	/*
+	 * C++ only variants of the Send functions for messages that the caller no longer needs. With
+	 * Publish Async the message is moved into the queue of the background thread instead of being
+	 * copied on the game thread. Pass the message with MoveTemp.
+	 */
+
+	bool SendAgxMsgsAny(FAGX_AgxMsgsAny&& Message, const FString& Topic);
+	bool SendAgxMsgsAnySequence(FAGX_AgxMsgsAnySequence&& Message, const FString& Topic);
+	bool SendBuiltinInterfacesTime(FAGX_BuiltinInterfacesTime&& Message, const FString& Topic);
+	bool SendBuiltinInterfacesDuration(
+		FAGX_BuiltinInterfacesDuration&& Message, const FString& Topic);
+	bool SendRosgraphMsgsClock(FAGX_RosgraphMsgsClock&& Message, const FString& Topic);
+	bool SendStdMsgsBool(FAGX_StdMsgsBool&& Message, const FString& Topic);
+	bool SendStdMsgsByte(FAGX_StdMsgsByte&& Message, const FString& Topic);
+	bool SendStdMsgsByteMultiArray(FAGX_StdMsgsByteMultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsChar(FAGX_StdMsgsChar&& Message, const FString& Topic);
+	bool SendStdMsgsColorRGBA(FAGX_StdMsgsColorRGBA&& Message, const FString& Topic);
+	bool SendStdMsgsEmpty(FAGX_StdMsgsEmpty&& Message, const FString& Topic);
+	bool SendStdMsgsFloat32(FAGX_StdMsgsFloat32&& Message, const FString& Topic);
+	bool SendStdMsgsFloat32MultiArray(
+		FAGX_StdMsgsFloat32MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsFloat64(FAGX_StdMsgsFloat64&& Message, const FString& Topic);
+	bool SendStdMsgsFloat64MultiArray(
+		FAGX_StdMsgsFloat64MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsInt16(FAGX_StdMsgsInt16&& Message, const FString& Topic);
+	bool SendStdMsgsInt16MultiArray(FAGX_StdMsgsInt16MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsInt32(FAGX_StdMsgsInt32&& Message, const FString& Topic);
+	bool SendStdMsgsInt32MultiArray(FAGX_StdMsgsInt32MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsInt64(FAGX_StdMsgsInt64&& Message, const FString& Topic);
+	bool SendStdMsgsInt64MultiArray(FAGX_StdMsgsInt64MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsInt8(FAGX_StdMsgsInt8&& Message, const FString& Topic);
+	bool SendStdMsgsInt8MultiArray(FAGX_StdMsgsInt8MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsString(FAGX_StdMsgsString&& Message, const FString& Topic);
+	bool SendStdMsgsUInt16(FAGX_StdMsgsUInt16&& Message, const FString& Topic);
+	bool SendStdMsgsUInt16MultiArray(FAGX_StdMsgsUInt16MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsUInt32(FAGX_StdMsgsUInt32&& Message, const FString& Topic);
+	bool SendStdMsgsUInt32MultiArray(FAGX_StdMsgsUInt32MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsUInt64(FAGX_StdMsgsUInt64&& Message, const FString& Topic);
+	bool SendStdMsgsUInt64MultiArray(FAGX_StdMsgsUInt64MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsUInt8(FAGX_StdMsgsUInt8&& Message, const FString& Topic);
+	bool SendStdMsgsUInt8MultiArray(FAGX_StdMsgsUInt8MultiArray&& Message, const FString& Topic);
+	bool SendStdMsgsHeader(FAGX_StdMsgsHeader&& Message, const FString& Topic);
+	bool SendGeometryMsgsVector3(FAGX_GeometryMsgsVector3&& Message, const FString& Topic);
+	bool SendGeometryMsgsQuaternion(FAGX_GeometryMsgsQuaternion&& Message, const FString& Topic);
+	bool SendGeometryMsgsAccel(FAGX_GeometryMsgsAccel&& Message, const FString& Topic);
+	bool SendGeometryMsgsAccelStamped(
+		FAGX_GeometryMsgsAccelStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsAccelWithCovariance(
+		FAGX_GeometryMsgsAccelWithCovariance&& Message, const FString& Topic);
+	bool SendGeometryMsgsAccelWithCovarianceStamped(
+		FAGX_GeometryMsgsAccelWithCovarianceStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsInertia(FAGX_GeometryMsgsInertia&& Message, const FString& Topic);
+	bool SendGeometryMsgsInertiaStamped(
+		FAGX_GeometryMsgsInertiaStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoint(FAGX_GeometryMsgsPoint&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoint32(FAGX_GeometryMsgsPoint32&& Message, const FString& Topic);
+	bool SendGeometryMsgsPointStamped(
+		FAGX_GeometryMsgsPointStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsPolygon(FAGX_GeometryMsgsPolygon&& Message, const FString& Topic);
+	bool SendGeometryMsgsPolygonStamped(
+		FAGX_GeometryMsgsPolygonStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsPose(FAGX_GeometryMsgsPose&& Message, const FString& Topic);
+	bool SendGeometryMsgsPose2D(FAGX_GeometryMsgsPose2D&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoseArray(FAGX_GeometryMsgsPoseArray&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoseStamped(FAGX_GeometryMsgsPoseStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoseWithCovariance(
+		FAGX_GeometryMsgsPoseWithCovariance&& Message, const FString& Topic);
+	bool SendGeometryMsgsPoseWithCovarianceStamped(
+		FAGX_GeometryMsgsPoseWithCovarianceStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsQuaternionStamped(
+		FAGX_GeometryMsgsQuaternionStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsTransform(FAGX_GeometryMsgsTransform&& Message, const FString& Topic);
+	bool SendGeometryMsgsTransformStamped(
+		FAGX_GeometryMsgsTransformStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsTwist(FAGX_GeometryMsgsTwist&& Message, const FString& Topic);
+	bool SendGeometryMsgsTwistStamped(
+		FAGX_GeometryMsgsTwistStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsTwistWithCovariance(
+		FAGX_GeometryMsgsTwistWithCovariance&& Message, const FString& Topic);
+	bool SendGeometryMsgsTwistWithCovarianceStamped(
+		FAGX_GeometryMsgsTwistWithCovarianceStamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsVector3Stamped(
+		FAGX_GeometryMsgsVector3Stamped&& Message, const FString& Topic);
+	bool SendGeometryMsgsWrench(FAGX_GeometryMsgsWrench&& Message, const FString& Topic);
+	bool SendGeometryMsgsWrenchStamped(
+		FAGX_GeometryMsgsWrenchStamped&& Message, const FString& Topic);
+	bool SendSensorMsgsBatteryState(FAGX_SensorMsgsBatteryState&& Message, const FString& Topic);
+	bool SendSensorMsgsChannelFloat32(
+		FAGX_SensorMsgsChannelFloat32&& Message, const FString& Topic);
+	bool SendSensorMsgsCompressedImage(
+		FAGX_SensorMsgsCompressedImage&& Message, const FString& Topic);
+	bool SendSensorMsgsFluidPressure(FAGX_SensorMsgsFluidPressure&& Message, const FString& Topic);
+	bool SendSensorMsgsIlluminance(FAGX_SensorMsgsIlluminance&& Message, const FString& Topic);
+	bool SendSensorMsgsImage(FAGX_SensorMsgsImage&& Message, const FString& Topic);
+	bool SendSensorMsgsImu(FAGX_SensorMsgsImu&& Message, const FString& Topic);
+	bool SendSensorMsgsJointState(FAGX_SensorMsgsJointState&& Message, const FString& Topic);
+	bool SendSensorMsgsJoy(FAGX_SensorMsgsJoy&& Message, const FString& Topic);
+	bool SendSensorMsgsJoyFeedback(FAGX_SensorMsgsJoyFeedback&& Message, const FString& Topic);
+	bool SendSensorMsgsJoyFeedbackArray(
+		FAGX_SensorMsgsJoyFeedbackArray&& Message, const FString& Topic);
+	bool SendSensorMsgsLaserEcho(FAGX_SensorMsgsLaserEcho&& Message, const FString& Topic);
+	bool SendSensorMsgsLaserScan(FAGX_SensorMsgsLaserScan&& Message, const FString& Topic);
+	bool SendSensorMsgsMagneticField(FAGX_SensorMsgsMagneticField&& Message, const FString& Topic);
+	bool SendSensorMsgsMultiDOFJointState(
+		FAGX_SensorMsgsMultiDOFJointState&& Message, const FString& Topic);
+	bool SendSensorMsgsMultiEchoLaserScan(
+		FAGX_SensorMsgsMultiEchoLaserScan&& Message, const FString& Topic);
+	bool SendSensorMsgsNavSatStatus(FAGX_SensorMsgsNavSatStatus&& Message, const FString& Topic);
+	bool SendSensorMsgsNavSatFix(FAGX_SensorMsgsNavSatFix&& Message, const FString& Topic);
+	bool SendSensorMsgsPointCloud(FAGX_SensorMsgsPointCloud&& Message, const FString& Topic);
+	bool SendSensorMsgsPointField(FAGX_SensorMsgsPointField&& Message, const FString& Topic);
+	bool SendSensorMsgsPointCloud2(FAGX_SensorMsgsPointCloud2&& Message, const FString& Topic);
+	bool SendSensorMsgsRange(FAGX_SensorMsgsRange&& Message, const FString& Topic);
+	bool SendSensorMsgsRegionOfInterest(
+		FAGX_SensorMsgsRegionOfInterest&& Message, const FString& Topic);
+	bool SendSensorMsgsCameraInfo(FAGX_SensorMsgsCameraInfo&& Message, const FString& Topic);
+	bool SendSensorMsgsRelativeHumidity(
+		FAGX_SensorMsgsRelativeHumidity&& Message, const FString& Topic);
+	bool SendSensorMsgsTemperature(FAGX_SensorMsgsTemperature&& Message, const FString& Topic);
+	bool SendSensorMsgsTimeReference(FAGX_SensorMsgsTimeReference&& Message, const FString& Topic);
+	bool SendAgxMsgsAnyByHandle(FAGX_AgxMsgsAny&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendAgxMsgsAnySequenceByHandle(
+		FAGX_AgxMsgsAnySequence&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendBuiltinInterfacesTimeByHandle(
+		FAGX_BuiltinInterfacesTime&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendBuiltinInterfacesDurationByHandle(
+		FAGX_BuiltinInterfacesDuration&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendRosgraphMsgsClockByHandle(
+		FAGX_RosgraphMsgsClock&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsBoolByHandle(FAGX_StdMsgsBool&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsByteByHandle(FAGX_StdMsgsByte&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsByteMultiArrayByHandle(
+		FAGX_StdMsgsByteMultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsCharByHandle(FAGX_StdMsgsChar&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsColorRGBAByHandle(
+		FAGX_StdMsgsColorRGBA&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsEmptyByHandle(FAGX_StdMsgsEmpty&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsFloat32ByHandle(FAGX_StdMsgsFloat32&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsFloat32MultiArrayByHandle(
+		FAGX_StdMsgsFloat32MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsFloat64ByHandle(FAGX_StdMsgsFloat64&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsFloat64MultiArrayByHandle(
+		FAGX_StdMsgsFloat64MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt16ByHandle(FAGX_StdMsgsInt16&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt16MultiArrayByHandle(
+		FAGX_StdMsgsInt16MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt32ByHandle(FAGX_StdMsgsInt32&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt32MultiArrayByHandle(
+		FAGX_StdMsgsInt32MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt64ByHandle(FAGX_StdMsgsInt64&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt64MultiArrayByHandle(
+		FAGX_StdMsgsInt64MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt8ByHandle(FAGX_StdMsgsInt8&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsInt8MultiArrayByHandle(
+		FAGX_StdMsgsInt8MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsStringByHandle(FAGX_StdMsgsString&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt16ByHandle(FAGX_StdMsgsUInt16&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt16MultiArrayByHandle(
+		FAGX_StdMsgsUInt16MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt32ByHandle(FAGX_StdMsgsUInt32&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt32MultiArrayByHandle(
+		FAGX_StdMsgsUInt32MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt64ByHandle(FAGX_StdMsgsUInt64&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt64MultiArrayByHandle(
+		FAGX_StdMsgsUInt64MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt8ByHandle(FAGX_StdMsgsUInt8&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsUInt8MultiArrayByHandle(
+		FAGX_StdMsgsUInt8MultiArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendStdMsgsHeaderByHandle(FAGX_StdMsgsHeader&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsVector3ByHandle(
+		FAGX_GeometryMsgsVector3&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsQuaternionByHandle(
+		FAGX_GeometryMsgsQuaternion&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsAccelByHandle(
+		FAGX_GeometryMsgsAccel&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsAccelStampedByHandle(
+		FAGX_GeometryMsgsAccelStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsAccelWithCovarianceByHandle(
+		FAGX_GeometryMsgsAccelWithCovariance&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsAccelWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsAccelWithCovarianceStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsInertiaByHandle(
+		FAGX_GeometryMsgsInertia&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsInertiaStampedByHandle(
+		FAGX_GeometryMsgsInertiaStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPointByHandle(
+		FAGX_GeometryMsgsPoint&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoint32ByHandle(
+		FAGX_GeometryMsgsPoint32&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPointStampedByHandle(
+		FAGX_GeometryMsgsPointStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPolygonByHandle(
+		FAGX_GeometryMsgsPolygon&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPolygonStampedByHandle(
+		FAGX_GeometryMsgsPolygonStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoseByHandle(
+		FAGX_GeometryMsgsPose&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPose2DByHandle(
+		FAGX_GeometryMsgsPose2D&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoseArrayByHandle(
+		FAGX_GeometryMsgsPoseArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoseStampedByHandle(
+		FAGX_GeometryMsgsPoseStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoseWithCovarianceByHandle(
+		FAGX_GeometryMsgsPoseWithCovariance&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsPoseWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsPoseWithCovarianceStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsQuaternionStampedByHandle(
+		FAGX_GeometryMsgsQuaternionStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTransformByHandle(
+		FAGX_GeometryMsgsTransform&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTransformStampedByHandle(
+		FAGX_GeometryMsgsTransformStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTwistByHandle(
+		FAGX_GeometryMsgsTwist&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTwistStampedByHandle(
+		FAGX_GeometryMsgsTwistStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTwistWithCovarianceByHandle(
+		FAGX_GeometryMsgsTwistWithCovariance&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsTwistWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsTwistWithCovarianceStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsVector3StampedByHandle(
+		FAGX_GeometryMsgsVector3Stamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsWrenchByHandle(
+		FAGX_GeometryMsgsWrench&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendGeometryMsgsWrenchStampedByHandle(
+		FAGX_GeometryMsgsWrenchStamped&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsBatteryStateByHandle(
+		FAGX_SensorMsgsBatteryState&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsChannelFloat32ByHandle(
+		FAGX_SensorMsgsChannelFloat32&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsCompressedImageByHandle(
+		FAGX_SensorMsgsCompressedImage&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsFluidPressureByHandle(
+		FAGX_SensorMsgsFluidPressure&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsIlluminanceByHandle(
+		FAGX_SensorMsgsIlluminance&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsImageByHandle(FAGX_SensorMsgsImage&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsImuByHandle(FAGX_SensorMsgsImu&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsJointStateByHandle(
+		FAGX_SensorMsgsJointState&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsJoyByHandle(FAGX_SensorMsgsJoy&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsJoyFeedbackByHandle(
+		FAGX_SensorMsgsJoyFeedback&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsJoyFeedbackArrayByHandle(
+		FAGX_SensorMsgsJoyFeedbackArray&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsLaserEchoByHandle(
+		FAGX_SensorMsgsLaserEcho&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsLaserScanByHandle(
+		FAGX_SensorMsgsLaserScan&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsMagneticFieldByHandle(
+		FAGX_SensorMsgsMagneticField&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsMultiDOFJointStateByHandle(
+		FAGX_SensorMsgsMultiDOFJointState&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsMultiEchoLaserScanByHandle(
+		FAGX_SensorMsgsMultiEchoLaserScan&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsNavSatStatusByHandle(
+		FAGX_SensorMsgsNavSatStatus&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsNavSatFixByHandle(
+		FAGX_SensorMsgsNavSatFix&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsPointCloudByHandle(
+		FAGX_SensorMsgsPointCloud&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsPointFieldByHandle(
+		FAGX_SensorMsgsPointField&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsPointCloud2ByHandle(
+		FAGX_SensorMsgsPointCloud2&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsRangeByHandle(FAGX_SensorMsgsRange&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsRegionOfInterestByHandle(
+		FAGX_SensorMsgsRegionOfInterest&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsCameraInfoByHandle(
+		FAGX_SensorMsgsCameraInfo&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsRelativeHumidityByHandle(
+		FAGX_SensorMsgsRelativeHumidity&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsTemperatureByHandle(
+		FAGX_SensorMsgsTemperature&& Message, FAGX_ROS2TopicHandle& Handle);
+	bool SendSensorMsgsTimeReferenceByHandle(
+		FAGX_SensorMsgsTimeReference&& Message, FAGX_ROS2TopicHandle& Handle);
+
+	//~ Begin UActorComponent Interface
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
+	//~ End UActorComponent Interface
+
 private:
 #if WITH_EDITOR
 	// ~Begin UActorComponent interface.
@@ -531,6 +1410,36 @@ private:
 	// ~Begin UActorComponent interface.
 #endif
 
-	// Key is the Topic.
-	TMap<FString, FROS2PublisherBarrier> NativeBarriers;
+	/**
+	 * Publish the message on the given topic, either directly or through the background thread
+	 * depending on bPublishAsync.
+	 */
+	template <typename MessageType>
+	bool Send(EAGX_ROS2MessageType Type, MessageType&& Msg, const FString& Topic);
+
+	template <typename MessageType>
+	bool Send(EAGX_ROS2MessageType Type, MessageType&& Msg, FAGX_ROS2TopicHandle& Handle);
+
+	/** Msg is copied, or moved if it is an rvalue, into the queue when publishing async. */
+	template <typename MessageType>
+	bool Publish(int32 BarrierIndex, MessageType&& Msg, const FString& Topic);
+
+	/** Returns INDEX_NONE if no Barrier could be created. */
+	int32 GetOrCreateBarrierIndex(EAGX_ROS2MessageType Type, const FString& Topic);
+
+	// Key is the Topic, value is the index of the Barrier in NativeBarriers. Topic Handles hold
+	// on to the index.
+	TMap<FString, int32> BarrierIndices;
+
+	// Incremented when the Barriers are released, so that Topic Handles resolved before that are
+	// resolved again.
+	uint32 TopicHandleGeneration {0};
+
+	// The Barriers are heap allocated so that the background publishing thread can hold on to them
+	// while new topics are added.
+	TArray<TUniquePtr<FROS2PublisherBarrier>> NativeBarriers;
+
+	// Declared after NativeBarriers so that the thread is stopped before the Barriers are
+	// destroyed.
+	TUniquePtr<FAGX_ROS2AsyncPublisher> AsyncPublisher;
 };
@@ -4,6 +4,7 @@
 
 // AGX Dynamics for Unreal includes.
 #include "ROS2/AGX_ROS2Messages.h"
+#include "ROS2/AGX_ROS2TopicHandle.h"
 #include "ROS2/ROS2SubscriberBarrier.h"
 #include "ROS2/AGX_ROS2Enums.h"
 #include "ROS2/AGX_ROS2Qos.h"
@@ -52,6 +53,19 @@ public:
 	 */
 	FROS2SubscriberBarrier* GetOrCreateBarrier(EAGX_ROS2MessageType Type, const FString& Topic);
 
+	/**
+	 * Returns the Barrier of the topic the given handle refers to. The handle is resolved from its
+	 * Topic, and updated, if it has not been used with this Component and message type before.
+	 */
+	FROS2SubscriberBarrier* GetOrCreateBarrier(
+		EAGX_ROS2MessageType Type, FAGX_ROS2TopicHandle& Handle);
+
+	/**
+	 * Create a resolved handle for the given topic. Receiving through the handle skips the topic
+	 * lookup done by the Receive functions taking a Topic string.
+	 */
+	FAGX_ROS2TopicHandle GetTopicHandle(EAGX_ROS2MessageType Type, const FString& Topic);
+
 	// AgxMsgs
 
 	UFUNCTION(
@@ -531,13 +545,1205 @@ public:
 	bool ReceiveSensorMsgsTimeReference(
 		FAGX_SensorMsgsTimeReference& OutMessage, const FString& Topic);
 
-private:
-#if WITH_EDITOR
-	// ~Begin UActorComponent interface.
-	virtual bool CanEditChange(const FProperty* InProperty) const override;
-	// ~Begin UActorComponent interface.
-#endif
+	// Topic Handle variants of the Receive functions, see FAGX_ROS2TopicHandle.
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive agx_msgs::Any (Handle)"))
+	bool ReceiveAgxMsgsAnyByHandle(
+		FAGX_AgxMsgsAny& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive agx_msgs::AnySequence (Handle)"))
+	bool ReceiveAgxMsgsAnySequenceByHandle(
+		FAGX_AgxMsgsAnySequence& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive builtin_interfaces::Time (Handle)"))
+	bool ReceiveBuiltinInterfacesTimeByHandle(
+		FAGX_BuiltinInterfacesTime& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive builtin_interfaces::Duration (Handle)"))
+	bool ReceiveBuiltinInterfacesDurationByHandle(
+		FAGX_BuiltinInterfacesDuration& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive rosgraph_msgs::Clock (Handle)"))
+	bool ReceiveRosgraphMsgsClockByHandle(
+		FAGX_RosgraphMsgsClock& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Bool (Handle)"))
+	bool ReceiveStdMsgsBoolByHandle(
+		FAGX_StdMsgsBool& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Byte (Handle)"))
+	bool ReceiveStdMsgsByteByHandle(
+		FAGX_StdMsgsByte& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::ByteMultiArray (Handle)"))
+	bool ReceiveStdMsgsByteMultiArrayByHandle(
+		FAGX_StdMsgsByteMultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Char (Handle)"))
+	bool ReceiveStdMsgsCharByHandle(
+		FAGX_StdMsgsChar& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::ColorRGBA (Handle)"))
+	bool ReceiveStdMsgsColorRGBAByHandle(
+		FAGX_StdMsgsColorRGBA& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Empty (Handle)"))
+	bool ReceiveStdMsgsEmptyByHandle(
+		FAGX_StdMsgsEmpty& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float32 (Handle)"))
+	bool ReceiveStdMsgsFloat32ByHandle(
+		FAGX_StdMsgsFloat32& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float32MultiArray (Handle)"))
+	bool ReceiveStdMsgsFloat32MultiArrayByHandle(
+		FAGX_StdMsgsFloat32MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float64 (Handle)"))
+	bool ReceiveStdMsgsFloat64ByHandle(
+		FAGX_StdMsgsFloat64& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float64MultiArray (Handle)"))
+	bool ReceiveStdMsgsFloat64MultiArrayByHandle(
+		FAGX_StdMsgsFloat64MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int16 (Handle)"))
+	bool ReceiveStdMsgsInt16ByHandle(
+		FAGX_StdMsgsInt16& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int16MultiArray (Handle)"))
+	bool ReceiveStdMsgsInt16MultiArrayByHandle(
+		FAGX_StdMsgsInt16MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int32 (Handle)"))
+	bool ReceiveStdMsgsInt32ByHandle(
+		FAGX_StdMsgsInt32& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int32MultiArray (Handle)"))
+	bool ReceiveStdMsgsInt32MultiArrayByHandle(
+		FAGX_StdMsgsInt32MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int64 (Handle)"))
+	bool ReceiveStdMsgsInt64ByHandle(
+		FAGX_StdMsgsInt64& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int64MultiArray (Handle)"))
+	bool ReceiveStdMsgsInt64MultiArrayByHandle(
+		FAGX_StdMsgsInt64MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int8 (Handle)"))
+	bool ReceiveStdMsgsInt8ByHandle(
+		FAGX_StdMsgsInt8& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int8MultiArray (Handle)"))
+	bool ReceiveStdMsgsInt8MultiArrayByHandle(
+		FAGX_StdMsgsInt8MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::String (Handle)"))
+	bool ReceiveStdMsgsStringByHandle(
+		FAGX_StdMsgsString& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt16 (Handle)"))
+	bool ReceiveStdMsgsUInt16ByHandle(
+		FAGX_StdMsgsUInt16& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt16MultiArray (Handle)"))
+	bool ReceiveStdMsgsUInt16MultiArrayByHandle(
+		FAGX_StdMsgsUInt16MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt32 (Handle)"))
+	bool ReceiveStdMsgsUInt32ByHandle(
+		FAGX_StdMsgsUInt32& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt32MultiArray (Handle)"))
+	bool ReceiveStdMsgsUInt32MultiArrayByHandle(
+		FAGX_StdMsgsUInt32MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt64 (Handle)"))
+	bool ReceiveStdMsgsUInt64ByHandle(
+		FAGX_StdMsgsUInt64& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt64MultiArray (Handle)"))
+	bool ReceiveStdMsgsUInt64MultiArrayByHandle(
+		FAGX_StdMsgsUInt64MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt8 (Handle)"))
+	bool ReceiveStdMsgsUInt8ByHandle(
+		FAGX_StdMsgsUInt8& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt8MultiArray (Handle)"))
+	bool ReceiveStdMsgsUInt8MultiArrayByHandle(
+		FAGX_StdMsgsUInt8MultiArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Header (Handle)"))
+	bool ReceiveStdMsgsHeaderByHandle(
+		FAGX_StdMsgsHeader& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Vector3 (Handle)"))
+	bool ReceiveGeometryMsgsVector3ByHandle(
+		FAGX_GeometryMsgsVector3& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Quaternion (Handle)"))
+	bool ReceiveGeometryMsgsQuaternionByHandle(
+		FAGX_GeometryMsgsQuaternion& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Accel (Handle)"))
+	bool ReceiveGeometryMsgsAccelByHandle(
+		FAGX_GeometryMsgsAccel& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelStamped (Handle)"))
+	bool ReceiveGeometryMsgsAccelStampedByHandle(
+		FAGX_GeometryMsgsAccelStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovariance (Handle)"))
+	bool ReceiveGeometryMsgsAccelWithCovarianceByHandle(
+		FAGX_GeometryMsgsAccelWithCovariance& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovarianceStamped (Handle)"))
+	bool ReceiveGeometryMsgsAccelWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsAccelWithCovarianceStamped& OutMessage,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Inertia (Handle)"))
+	bool ReceiveGeometryMsgsInertiaByHandle(
+		FAGX_GeometryMsgsInertia& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::InertiaStamped (Handle)"))
+	bool ReceiveGeometryMsgsInertiaStampedByHandle(
+		FAGX_GeometryMsgsInertiaStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Point (Handle)"))
+	bool ReceiveGeometryMsgsPointByHandle(
+		FAGX_GeometryMsgsPoint& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Point32 (Handle)"))
+	bool ReceiveGeometryMsgsPoint32ByHandle(
+		FAGX_GeometryMsgsPoint32& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PointStamped (Handle)"))
+	bool ReceiveGeometryMsgsPointStampedByHandle(
+		FAGX_GeometryMsgsPointStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Polygon (Handle)"))
+	bool ReceiveGeometryMsgsPolygonByHandle(
+		FAGX_GeometryMsgsPolygon& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PolygonStamped (Handle)"))
+	bool ReceiveGeometryMsgsPolygonStampedByHandle(
+		FAGX_GeometryMsgsPolygonStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Pose (Handle)"))
+	bool ReceiveGeometryMsgsPoseByHandle(
+		FAGX_GeometryMsgsPose& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Pose2D (Handle)"))
+	bool ReceiveGeometryMsgsPose2DByHandle(
+		FAGX_GeometryMsgsPose2D& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseArray (Handle)"))
+	bool ReceiveGeometryMsgsPoseArrayByHandle(
+		FAGX_GeometryMsgsPoseArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseStamped (Handle)"))
+	bool ReceiveGeometryMsgsPoseStampedByHandle(
+		FAGX_GeometryMsgsPoseStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovariance (Handle)"))
+	bool ReceiveGeometryMsgsPoseWithCovarianceByHandle(
+		FAGX_GeometryMsgsPoseWithCovariance& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovarianceStamped (Handle)"))
+	bool ReceiveGeometryMsgsPoseWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsPoseWithCovarianceStamped& OutMessage,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::QuaternionStamped (Handle)"))
+	bool ReceiveGeometryMsgsQuaternionStampedByHandle(
+		FAGX_GeometryMsgsQuaternionStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Transform (Handle)"))
+	bool ReceiveGeometryMsgsTransformByHandle(
+		FAGX_GeometryMsgsTransform& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TransformStamped (Handle)"))
+	bool ReceiveGeometryMsgsTransformStampedByHandle(
+		FAGX_GeometryMsgsTransformStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Twist (Handle)"))
+	bool ReceiveGeometryMsgsTwistByHandle(
+		FAGX_GeometryMsgsTwist& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistStamped (Handle)"))
+	bool ReceiveGeometryMsgsTwistStampedByHandle(
+		FAGX_GeometryMsgsTwistStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovariance (Handle)"))
+	bool ReceiveGeometryMsgsTwistWithCovarianceByHandle(
+		FAGX_GeometryMsgsTwistWithCovariance& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovarianceStamped (Handle)"))
+	bool ReceiveGeometryMsgsTwistWithCovarianceStampedByHandle(
+		FAGX_GeometryMsgsTwistWithCovarianceStamped& OutMessage,
+		UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Vector3Stamped (Handle)"))
+	bool ReceiveGeometryMsgsVector3StampedByHandle(
+		FAGX_GeometryMsgsVector3Stamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Wrench (Handle)"))
+	bool ReceiveGeometryMsgsWrenchByHandle(
+		FAGX_GeometryMsgsWrench& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::WrenchStamped (Handle)"))
+	bool ReceiveGeometryMsgsWrenchStampedByHandle(
+		FAGX_GeometryMsgsWrenchStamped& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::BatteryState (Handle)"))
+	bool ReceiveSensorMsgsBatteryStateByHandle(
+		FAGX_SensorMsgsBatteryState& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::ChannelFloat32 (Handle)"))
+	bool ReceiveSensorMsgsChannelFloat32ByHandle(
+		FAGX_SensorMsgsChannelFloat32& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::CompressedImage (Handle)"))
+	bool ReceiveSensorMsgsCompressedImageByHandle(
+		FAGX_SensorMsgsCompressedImage& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::FluidPressure (Handle)"))
+	bool ReceiveSensorMsgsFluidPressureByHandle(
+		FAGX_SensorMsgsFluidPressure& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Illuminance (Handle)"))
+	bool ReceiveSensorMsgsIlluminanceByHandle(
+		FAGX_SensorMsgsIlluminance& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Image (Handle)"))
+	bool ReceiveSensorMsgsImageByHandle(
+		FAGX_SensorMsgsImage& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Imu (Handle)"))
+	bool ReceiveSensorMsgsImuByHandle(
+		FAGX_SensorMsgsImu& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JointState (Handle)"))
+	bool ReceiveSensorMsgsJointStateByHandle(
+		FAGX_SensorMsgsJointState& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Joy (Handle)"))
+	bool ReceiveSensorMsgsJoyByHandle(
+		FAGX_SensorMsgsJoy& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedback (Handle)"))
+	bool ReceiveSensorMsgsJoyFeedbackByHandle(
+		FAGX_SensorMsgsJoyFeedback& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedbackArray (Handle)"))
+	bool ReceiveSensorMsgsJoyFeedbackArrayByHandle(
+		FAGX_SensorMsgsJoyFeedbackArray& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::LaserEcho (Handle)"))
+	bool ReceiveSensorMsgsLaserEchoByHandle(
+		FAGX_SensorMsgsLaserEcho& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::LaserScan (Handle)"))
+	bool ReceiveSensorMsgsLaserScanByHandle(
+		FAGX_SensorMsgsLaserScan& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MagneticField (Handle)"))
+	bool ReceiveSensorMsgsMagneticFieldByHandle(
+		FAGX_SensorMsgsMagneticField& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MultiDOFJointState (Handle)"))
+	bool ReceiveSensorMsgsMultiDOFJointStateByHandle(
+		FAGX_SensorMsgsMultiDOFJointState& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MultiEchoLaserScan (Handle)"))
+	bool ReceiveSensorMsgsMultiEchoLaserScanByHandle(
+		FAGX_SensorMsgsMultiEchoLaserScan& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::NavSatStatus (Handle)"))
+	bool ReceiveSensorMsgsNavSatStatusByHandle(
+		FAGX_SensorMsgsNavSatStatus& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::NavSatFix (Handle)"))
+	bool ReceiveSensorMsgsNavSatFixByHandle(
+		FAGX_SensorMsgsNavSatFix& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointCloud (Handle)"))
+	bool ReceiveSensorMsgsPointCloudByHandle(
+		FAGX_SensorMsgsPointCloud& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointField (Handle)"))
+	bool ReceiveSensorMsgsPointFieldByHandle(
+		FAGX_SensorMsgsPointField& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointCloud2 (Handle)"))
+	bool ReceiveSensorMsgsPointCloud2ByHandle(
+		FAGX_SensorMsgsPointCloud2& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Range (Handle)"))
+	bool ReceiveSensorMsgsRangeByHandle(
+		FAGX_SensorMsgsRange& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::RegionOfInterest (Handle)"))
+	bool ReceiveSensorMsgsRegionOfInterestByHandle(
+		FAGX_SensorMsgsRegionOfInterest& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::CameraInfo (Handle)"))
+	bool ReceiveSensorMsgsCameraInfoByHandle(
+		FAGX_SensorMsgsCameraInfo& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::RelativeHumidity (Handle)"))
+	bool ReceiveSensorMsgsRelativeHumidityByHandle(
+		FAGX_SensorMsgsRelativeHumidity& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Temperature (Handle)"))
+	bool ReceiveSensorMsgsTemperatureByHandle(
+		FAGX_SensorMsgsTemperature& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::TimeReference (Handle)"))
+	bool ReceiveSensorMsgsTimeReferenceByHandle(
+		FAGX_SensorMsgsTimeReference& OutMessage, UPARAM(ref) FAGX_ROS2TopicHandle& Handle);
+
+	/*
+	 * Batch variants of the Receive functions. Each call receives up to Max Messages of the queued
+	 * messages on the topic, oldest first, into Out Messages and returns the number received.
+	 *
+	 * With Latest Only set, only the newest queued message is received and all older ones are
+	 * discarded without being converted. Useful for high-rate topics where only the current state
+	 * matters.
+	 *
+	 * The number of messages that can be queued between calls is limited by the History Depth of
+	 * the QOS settings.
+	 */
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive agx_msgs::Any (Batch)"))
+	int32 ReceiveAgxMsgsAnyBatch(
+		TArray<FAGX_AgxMsgsAny>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive agx_msgs::AnySequence (Batch)"))
+	int32 ReceiveAgxMsgsAnySequenceBatch(
+		TArray<FAGX_AgxMsgsAnySequence>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive builtin_interfaces::Time (Batch)"))
+	int32 ReceiveBuiltinInterfacesTimeBatch(
+		TArray<FAGX_BuiltinInterfacesTime>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive builtin_interfaces::Duration (Batch)"))
+	int32 ReceiveBuiltinInterfacesDurationBatch(
+		TArray<FAGX_BuiltinInterfacesDuration>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive rosgraph_msgs::Clock (Batch)"))
+	int32 ReceiveRosgraphMsgsClockBatch(
+		TArray<FAGX_RosgraphMsgsClock>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Bool (Batch)"))
+	int32 ReceiveStdMsgsBoolBatch(
+		TArray<FAGX_StdMsgsBool>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Byte (Batch)"))
+	int32 ReceiveStdMsgsByteBatch(
+		TArray<FAGX_StdMsgsByte>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::ByteMultiArray (Batch)"))
+	int32 ReceiveStdMsgsByteMultiArrayBatch(
+		TArray<FAGX_StdMsgsByteMultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Char (Batch)"))
+	int32 ReceiveStdMsgsCharBatch(
+		TArray<FAGX_StdMsgsChar>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::ColorRGBA (Batch)"))
+	int32 ReceiveStdMsgsColorRGBABatch(
+		TArray<FAGX_StdMsgsColorRGBA>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Empty (Batch)"))
+	int32 ReceiveStdMsgsEmptyBatch(
+		TArray<FAGX_StdMsgsEmpty>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float32 (Batch)"))
+	int32 ReceiveStdMsgsFloat32Batch(
+		TArray<FAGX_StdMsgsFloat32>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float32MultiArray (Batch)"))
+	int32 ReceiveStdMsgsFloat32MultiArrayBatch(
+		TArray<FAGX_StdMsgsFloat32MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float64 (Batch)"))
+	int32 ReceiveStdMsgsFloat64Batch(
+		TArray<FAGX_StdMsgsFloat64>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Float64MultiArray (Batch)"))
+	int32 ReceiveStdMsgsFloat64MultiArrayBatch(
+		TArray<FAGX_StdMsgsFloat64MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int16 (Batch)"))
+	int32 ReceiveStdMsgsInt16Batch(
+		TArray<FAGX_StdMsgsInt16>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int16MultiArray (Batch)"))
+	int32 ReceiveStdMsgsInt16MultiArrayBatch(
+		TArray<FAGX_StdMsgsInt16MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int32 (Batch)"))
+	int32 ReceiveStdMsgsInt32Batch(
+		TArray<FAGX_StdMsgsInt32>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int32MultiArray (Batch)"))
+	int32 ReceiveStdMsgsInt32MultiArrayBatch(
+		TArray<FAGX_StdMsgsInt32MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int64 (Batch)"))
+	int32 ReceiveStdMsgsInt64Batch(
+		TArray<FAGX_StdMsgsInt64>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int64MultiArray (Batch)"))
+	int32 ReceiveStdMsgsInt64MultiArrayBatch(
+		TArray<FAGX_StdMsgsInt64MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int8 (Batch)"))
+	int32 ReceiveStdMsgsInt8Batch(
+		TArray<FAGX_StdMsgsInt8>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Int8MultiArray (Batch)"))
+	int32 ReceiveStdMsgsInt8MultiArrayBatch(
+		TArray<FAGX_StdMsgsInt8MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::String (Batch)"))
+	int32 ReceiveStdMsgsStringBatch(
+		TArray<FAGX_StdMsgsString>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt16 (Batch)"))
+	int32 ReceiveStdMsgsUInt16Batch(
+		TArray<FAGX_StdMsgsUInt16>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt16MultiArray (Batch)"))
+	int32 ReceiveStdMsgsUInt16MultiArrayBatch(
+		TArray<FAGX_StdMsgsUInt16MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt32 (Batch)"))
+	int32 ReceiveStdMsgsUInt32Batch(
+		TArray<FAGX_StdMsgsUInt32>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt32MultiArray (Batch)"))
+	int32 ReceiveStdMsgsUInt32MultiArrayBatch(
+		TArray<FAGX_StdMsgsUInt32MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt64 (Batch)"))
+	int32 ReceiveStdMsgsUInt64Batch(
+		TArray<FAGX_StdMsgsUInt64>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt64MultiArray (Batch)"))
+	int32 ReceiveStdMsgsUInt64MultiArrayBatch(
+		TArray<FAGX_StdMsgsUInt64MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt8 (Batch)"))
+	int32 ReceiveStdMsgsUInt8Batch(
+		TArray<FAGX_StdMsgsUInt8>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::UInt8MultiArray (Batch)"))
+	int32 ReceiveStdMsgsUInt8MultiArrayBatch(
+		TArray<FAGX_StdMsgsUInt8MultiArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive std_msgs::Header (Batch)"))
+	int32 ReceiveStdMsgsHeaderBatch(
+		TArray<FAGX_StdMsgsHeader>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Vector3 (Batch)"))
+	int32 ReceiveGeometryMsgsVector3Batch(
+		TArray<FAGX_GeometryMsgsVector3>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Quaternion (Batch)"))
+	int32 ReceiveGeometryMsgsQuaternionBatch(
+		TArray<FAGX_GeometryMsgsQuaternion>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Accel (Batch)"))
+	int32 ReceiveGeometryMsgsAccelBatch(
+		TArray<FAGX_GeometryMsgsAccel>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelStamped (Batch)"))
+	int32 ReceiveGeometryMsgsAccelStampedBatch(
+		TArray<FAGX_GeometryMsgsAccelStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovariance (Batch)"))
+	int32 ReceiveGeometryMsgsAccelWithCovarianceBatch(
+		TArray<FAGX_GeometryMsgsAccelWithCovariance>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::AccelWithCovarianceStamped (Batch)"))
+	int32 ReceiveGeometryMsgsAccelWithCovarianceStampedBatch(
+		TArray<FAGX_GeometryMsgsAccelWithCovarianceStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Inertia (Batch)"))
+	int32 ReceiveGeometryMsgsInertiaBatch(
+		TArray<FAGX_GeometryMsgsInertia>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::InertiaStamped (Batch)"))
+	int32 ReceiveGeometryMsgsInertiaStampedBatch(
+		TArray<FAGX_GeometryMsgsInertiaStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Point (Batch)"))
+	int32 ReceiveGeometryMsgsPointBatch(
+		TArray<FAGX_GeometryMsgsPoint>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Point32 (Batch)"))
+	int32 ReceiveGeometryMsgsPoint32Batch(
+		TArray<FAGX_GeometryMsgsPoint32>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PointStamped (Batch)"))
+	int32 ReceiveGeometryMsgsPointStampedBatch(
+		TArray<FAGX_GeometryMsgsPointStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Polygon (Batch)"))
+	int32 ReceiveGeometryMsgsPolygonBatch(
+		TArray<FAGX_GeometryMsgsPolygon>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PolygonStamped (Batch)"))
+	int32 ReceiveGeometryMsgsPolygonStampedBatch(
+		TArray<FAGX_GeometryMsgsPolygonStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Pose (Batch)"))
+	int32 ReceiveGeometryMsgsPoseBatch(
+		TArray<FAGX_GeometryMsgsPose>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Pose2D (Batch)"))
+	int32 ReceiveGeometryMsgsPose2DBatch(
+		TArray<FAGX_GeometryMsgsPose2D>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseArray (Batch)"))
+	int32 ReceiveGeometryMsgsPoseArrayBatch(
+		TArray<FAGX_GeometryMsgsPoseArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseStamped (Batch)"))
+	int32 ReceiveGeometryMsgsPoseStampedBatch(
+		TArray<FAGX_GeometryMsgsPoseStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovariance (Batch)"))
+	int32 ReceiveGeometryMsgsPoseWithCovarianceBatch(
+		TArray<FAGX_GeometryMsgsPoseWithCovariance>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::PoseWithCovarianceStamped (Batch)"))
+	int32 ReceiveGeometryMsgsPoseWithCovarianceStampedBatch(
+		TArray<FAGX_GeometryMsgsPoseWithCovarianceStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::QuaternionStamped (Batch)"))
+	int32 ReceiveGeometryMsgsQuaternionStampedBatch(
+		TArray<FAGX_GeometryMsgsQuaternionStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Transform (Batch)"))
+	int32 ReceiveGeometryMsgsTransformBatch(
+		TArray<FAGX_GeometryMsgsTransform>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TransformStamped (Batch)"))
+	int32 ReceiveGeometryMsgsTransformStampedBatch(
+		TArray<FAGX_GeometryMsgsTransformStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Twist (Batch)"))
+	int32 ReceiveGeometryMsgsTwistBatch(
+		TArray<FAGX_GeometryMsgsTwist>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistStamped (Batch)"))
+	int32 ReceiveGeometryMsgsTwistStampedBatch(
+		TArray<FAGX_GeometryMsgsTwistStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovariance (Batch)"))
+	int32 ReceiveGeometryMsgsTwistWithCovarianceBatch(
+		TArray<FAGX_GeometryMsgsTwistWithCovariance>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::TwistWithCovarianceStamped (Batch)"))
+	int32 ReceiveGeometryMsgsTwistWithCovarianceStampedBatch(
+		TArray<FAGX_GeometryMsgsTwistWithCovarianceStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Vector3Stamped (Batch)"))
+	int32 ReceiveGeometryMsgsVector3StampedBatch(
+		TArray<FAGX_GeometryMsgsVector3Stamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::Wrench (Batch)"))
+	int32 ReceiveGeometryMsgsWrenchBatch(
+		TArray<FAGX_GeometryMsgsWrench>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive geometry_msgs::WrenchStamped (Batch)"))
+	int32 ReceiveGeometryMsgsWrenchStampedBatch(
+		TArray<FAGX_GeometryMsgsWrenchStamped>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::BatteryState (Batch)"))
+	int32 ReceiveSensorMsgsBatteryStateBatch(
+		TArray<FAGX_SensorMsgsBatteryState>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::ChannelFloat32 (Batch)"))
+	int32 ReceiveSensorMsgsChannelFloat32Batch(
+		TArray<FAGX_SensorMsgsChannelFloat32>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::CompressedImage (Batch)"))
+	int32 ReceiveSensorMsgsCompressedImageBatch(
+		TArray<FAGX_SensorMsgsCompressedImage>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::FluidPressure (Batch)"))
+	int32 ReceiveSensorMsgsFluidPressureBatch(
+		TArray<FAGX_SensorMsgsFluidPressure>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Illuminance (Batch)"))
+	int32 ReceiveSensorMsgsIlluminanceBatch(
+		TArray<FAGX_SensorMsgsIlluminance>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Image (Batch)"))
+	int32 ReceiveSensorMsgsImageBatch(
+		TArray<FAGX_SensorMsgsImage>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Imu (Batch)"))
+	int32 ReceiveSensorMsgsImuBatch(
+		TArray<FAGX_SensorMsgsImu>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JointState (Batch)"))
+	int32 ReceiveSensorMsgsJointStateBatch(
+		TArray<FAGX_SensorMsgsJointState>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Joy (Batch)"))
+	int32 ReceiveSensorMsgsJoyBatch(
+		TArray<FAGX_SensorMsgsJoy>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedback (Batch)"))
+	int32 ReceiveSensorMsgsJoyFeedbackBatch(
+		TArray<FAGX_SensorMsgsJoyFeedback>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::JoyFeedbackArray (Batch)"))
+	int32 ReceiveSensorMsgsJoyFeedbackArrayBatch(
+		TArray<FAGX_SensorMsgsJoyFeedbackArray>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::LaserEcho (Batch)"))
+	int32 ReceiveSensorMsgsLaserEchoBatch(
+		TArray<FAGX_SensorMsgsLaserEcho>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::LaserScan (Batch)"))
+	int32 ReceiveSensorMsgsLaserScanBatch(
+		TArray<FAGX_SensorMsgsLaserScan>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MagneticField (Batch)"))
+	int32 ReceiveSensorMsgsMagneticFieldBatch(
+		TArray<FAGX_SensorMsgsMagneticField>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MultiDOFJointState (Batch)"))
+	int32 ReceiveSensorMsgsMultiDOFJointStateBatch(
+		TArray<FAGX_SensorMsgsMultiDOFJointState>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::MultiEchoLaserScan (Batch)"))
+	int32 ReceiveSensorMsgsMultiEchoLaserScanBatch(
+		TArray<FAGX_SensorMsgsMultiEchoLaserScan>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::NavSatStatus (Batch)"))
+	int32 ReceiveSensorMsgsNavSatStatusBatch(
+		TArray<FAGX_SensorMsgsNavSatStatus>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::NavSatFix (Batch)"))
+	int32 ReceiveSensorMsgsNavSatFixBatch(
+		TArray<FAGX_SensorMsgsNavSatFix>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointCloud (Batch)"))
+	int32 ReceiveSensorMsgsPointCloudBatch(
+		TArray<FAGX_SensorMsgsPointCloud>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointField (Batch)"))
+	int32 ReceiveSensorMsgsPointFieldBatch(
+		TArray<FAGX_SensorMsgsPointField>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::PointCloud2 (Batch)"))
+	int32 ReceiveSensorMsgsPointCloud2Batch(
+		TArray<FAGX_SensorMsgsPointCloud2>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Range (Batch)"))
+	int32 ReceiveSensorMsgsRangeBatch(
+		TArray<FAGX_SensorMsgsRange>& OutMessages, const FString& Topic, int32 MaxMessages = 64,
+		bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::RegionOfInterest (Batch)"))
+	int32 ReceiveSensorMsgsRegionOfInterestBatch(
+		TArray<FAGX_SensorMsgsRegionOfInterest>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::CameraInfo (Batch)"))
+	int32 ReceiveSensorMsgsCameraInfoBatch(
+		TArray<FAGX_SensorMsgsCameraInfo>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::RelativeHumidity (Batch)"))
+	int32 ReceiveSensorMsgsRelativeHumidityBatch(
+		TArray<FAGX_SensorMsgsRelativeHumidity>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::Temperature (Batch)"))
+	int32 ReceiveSensorMsgsTemperatureBatch(
+		TArray<FAGX_SensorMsgsTemperature>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	UFUNCTION(
+		BlueprintCallable, Category = "AGX ROS2",
+		Meta = (DisplayName = "Receive sensor_msgs::TimeReference (Batch)"))
+	int32 ReceiveSensorMsgsTimeReferenceBatch(
+		TArray<FAGX_SensorMsgsTimeReference>& OutMessages, const FString& Topic,
+		int32 MaxMessages = 64, bool bLatestOnly = false);
+
+	//~ Begin UActorComponent Interface
+	virtual void EndPlay(const EEndPlayReason::Type Reason) override;
+	//~ End UActorComponent Interface
+
+private:
+#if WITH_EDITOR
+	// ~Begin UActorComponent interface.
+	virtual bool CanEditChange(const FProperty* InProperty) const override;
+	// ~Begin UActorComponent interface.
+#endif
+
+	template <typename MessageType>
+	int32 ReceiveBatch(
+		EAGX_ROS2MessageType Type, TArray<MessageType>& OutMessages, const FString& Topic,
+		int32 MaxMessages, bool bLatestOnly);
+
+	/** Returns INDEX_NONE if no Barrier could be created. */
+	int32 GetOrCreateBarrierIndex(EAGX_ROS2MessageType Type, const FString& Topic);
+
+	// Key is the Topic, value is the index of the Barrier in NativeBarriers. Topic Handles hold
+	// on to the index.
+	TMap<FString, int32> BarrierIndices;
+	TArray<FROS2SubscriberBarrier> NativeBarriers;
 
-	// Key is the Topic.
-	TMap<FString, FROS2SubscriberBarrier> NativeBarriers;
+	// Incremented when the Barriers are released, so that Topic Handles resolved before that are
+	// resolved again.
+	uint32 TopicHandleGeneration {0};
 };
@@ -0,0 +1,98 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "ROS2/AGX_ROS2Enums.h"
+
+// Unreal Engine includes.
+#include "Components/ActorComponent.h"
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "AGX_ROS2TopicHandle.generated.h"
+
+/**
+ * Refers to one topic of a ROS2 Publisher or Subscriber Component.
+ *
+ * Sending or receiving through a Topic Handle instead of a Topic string avoids looking up the topic
+ * by name on every call. The handle is resolved the first time it is used, and from then on refers
+ * directly to the topic of the Component it was used with. Store the handle in a variable and pass
+ * the same variable on every call, the Send and Receive functions update it in place.
+ *
+ * A handle that is used with a different Component or with a different message type, whose Topic
+ * has been changed with Set Topic, or whose Component has released its topics since the handle was
+ * resolved, is resolved again from the Topic.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_ROS2TopicHandle
+{
+	GENERATED_BODY()
+
+	FAGX_ROS2TopicHandle() = default;
+	explicit FAGX_ROS2TopicHandle(const FString& InTopic)
+		: Topic(InTopic)
+	{
+	}
+
+	const FString& GetTopic() const
+	{
+		return Topic;
+	}
+
+	/** Change the topic. The handle is resolved again the next time it is used. */
+	void SetTopic(const FString& InTopic)
+	{
+		Topic = InTopic;
+		Index = INDEX_NONE;
+	}
+
+	bool IsResolved() const
+	{
+		return Index != INDEX_NONE && Owner.IsValid();
+	}
+
+	/**
+	 * Whether the handle refers to a topic of the given Component and message type, and neither
+	 * the Topic nor the topics of the Component have changed since the handle was resolved.
+	 *
+	 * @param ComponentGeneration The current Topic Handle generation of the Component.
+	 */
+	bool IsResolvedFor(
+		const UActorComponent& Component, EAGX_ROS2MessageType Type,
+		uint32 ComponentGeneration) const
+	{
+		return Index != INDEX_NONE && Generation == ComponentGeneration && MessageType == Type &&
+			   Owner.Get() == &Component;
+	}
+
+private:
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX ROS2",
+		Meta = (AllowPrivateAccess = "true"))
+	FString Topic;
+
+public:
+	// Resolved state. Set by the ROS2 Publisher and Subscriber Components, not serialized.
+	TWeakObjectPtr<const UActorComponent> Owner;
+	int32 Index {INDEX_NONE};
+	EAGX_ROS2MessageType MessageType {EAGX_ROS2MessageType::Invalid};
+	uint32 Generation {0};
+};
+
+UCLASS()
+class AGXUNREAL_API UAGX_ROS2TopicHandle_FL : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Change the topic. The handle is resolved again the next time it is used. */
+	UFUNCTION(BlueprintCallable, Category = "AGX ROS2")
+	static UPARAM(Ref) FAGX_ROS2TopicHandle& SetTopic(
+		UPARAM(Ref) FAGX_ROS2TopicHandle& Handle, const FString& Topic)
+	{
+		Handle.SetTopic(Topic);
+		return Handle;
+	}
+};
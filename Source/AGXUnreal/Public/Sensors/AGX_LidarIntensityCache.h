@@ -0,0 +1,71 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UAGX_LidarLambertianOpaqueMaterial;
+class UMaterialInterface;
+class UPrimitiveComponent;
+
+struct FPropertyChangedEvent;
+
+/**
+ * Thread safe cache of the surface reflectivity used by the line trace Lidar Sensor intensity
+ * approximation, so that the per-ray cost is a hash lookup instead of a name based material
+ * parameter lookup.
+ *
+ * The reflectivity of a Primitive Component is the Reflectivity of the Lidar Lambertian Opaque
+ * Material assigned to it through a Surface Material Asset User Data, if any, and otherwise one
+ * minus the Roughness scalar parameter of its first material.
+ *
+ * Per-component overrides and Material Instance Dynamics may change during play, so they are
+ * forgotten by BeginScan. Other materials are kept until Reset, or, in the editor, until a property
+ * of the material is changed.
+ */
+class AGXUNREAL_API FAGX_LidarIntensityCache
+{
+public:
+	~FAGX_LidarIntensityCache();
+
+	/** Start listening for material changes. Must be called on the game thread. */
+	void Init();
+
+	/** Stop listening for material changes and forget everything. Game thread only. */
+	void Reset();
+
+	/**
+	 * Forget everything that may have changed since the previous scan. Must be called on the game
+	 * thread, when no scan is in progress.
+	 */
+	void BeginScan();
+
+	/**
+	 * Thread safe. The reflectivity, in the range [0..1], of the surface of the given Component.
+	 */
+	double GetReflectivity(UPrimitiveComponent& Component);
+
+private:
+	const UAGX_LidarLambertianOpaqueMaterial* GetOverride(UPrimitiveComponent& Component);
+
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	FDelegateHandle ObjectPropertyChangedHandle;
+#endif
+
+	FRWLock Lock;
+
+	/** Per-component Surface Material override, null for components without one. */
+	TMap<TObjectKey<UPrimitiveComponent>, TWeakObjectPtr<const UAGX_LidarLambertianOpaqueMaterial>>
+		Overrides;
+
+	/** Reflectivity of materials that cannot change during play. */
+	TMap<TObjectKey<UMaterialInterface>, double> Materials;
+
+	/** Reflectivity of Material Instance Dynamics, forgotten by BeginScan. */
+	TMap<TObjectKey<UMaterialInterface>, double> DynamicMaterials;
+};
@@ -27,3 +27,17 @@ enum class EAGX_LidarLineTraceScanPattern
 	/** Scans one horizontal line, then goes to the next. */
 	VerticalSweep
 };
+
+/** Specifies how the line traces of a Lidar scan are run. */
+UENUM()
+enum class EAGX_LidarLineTraceQueryMode
+{
+	/** The line traces are run in parallel and the scan waits for all of them to finish. */
+	Synchronous,
+
+	/**
+	 * The line traces are submitted as a batch to the engine's asynchronous trace pipeline and the
+	 * scanned points are collected one frame later.
+	 */
+	Asynchronous
+};
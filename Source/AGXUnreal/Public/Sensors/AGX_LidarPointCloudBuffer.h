@@ -0,0 +1,255 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Sensors/AGX_LidarScanPoint.h"
+
+// Unreal Engine includes.
+#include "Algo/BinarySearch.h"
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/RefCounting.h"
+#include "Templates/SharedPointer.h"
+
+// Standard library includes.
+#include <atomic>
+
+/** A scanned point packed as three floats, position X, Y, Z, 12 bytes. */
+struct FAGX_LidarPackedPointXYZ
+{
+	float X;
+	float Y;
+	float Z;
+};
+
+/** A scanned point packed as four floats, position X, Y, Z and Intensity, 16 bytes. */
+struct FAGX_LidarPackedPointXYZI
+{
+	float X;
+	float Y;
+	float Z;
+	float Intensity;
+};
+
+static_assert(sizeof(FAGX_LidarPackedPointXYZ) == 3 * sizeof(float));
+static_assert(sizeof(FAGX_LidarPackedPointXYZI) == 4 * sizeof(float));
+
+template <typename ElementType>
+class TAGX_LidarPointCloudBufferPool;
+
+/**
+ * Reference counted point cloud storage handed out by a TAGX_LidarPointCloudBufferPool.
+ *
+ * Buffers are held through TRefCountPtr. When the last reference is released the buffer goes back
+ * to the pool it came from, keeping its allocation, so that a consumer can keep a point cloud for
+ * as long as it needs without copying it and without the producer allocating a new one for every
+ * output. The reference count is thread safe, the contents are not: a buffer must not be modified
+ * once it has been handed to a consumer.
+ */
+template <typename ElementType>
+class TAGX_LidarPointCloudBuffer
+{
+public:
+	TArray<ElementType> Data;
+
+	/** Simulation time at which the point cloud was output [s]. */
+	double TimeStamp {0.0};
+
+	uint32 AddRef() const
+	{
+		return RefCount.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	uint32 Release() const
+	{
+		const uint32 Remaining = RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		if (Remaining == 0)
+		{
+			if (TSharedPtr<TAGX_LidarPointCloudBufferPool<ElementType>, ESPMode::ThreadSafe> Owner =
+					Pool.Pin())
+			{
+				Owner->Return(const_cast<TAGX_LidarPointCloudBuffer*>(this));
+			}
+			else
+			{
+				delete this;
+			}
+		}
+		return Remaining;
+	}
+
+	uint32 GetRefCount() const
+	{
+		return RefCount.load(std::memory_order_relaxed);
+	}
+
+private:
+	friend class TAGX_LidarPointCloudBufferPool<ElementType>;
+
+	mutable std::atomic<uint32> RefCount {0};
+	TWeakPtr<TAGX_LidarPointCloudBufferPool<ElementType>, ESPMode::ThreadSafe> Pool;
+
+	// Index into the pool's size classes, or INDEX_NONE for buffers that are not reused.
+	int32 SizeClass {INDEX_NONE};
+	uint32 Generation {0};
+};
+
+/**
+ * Thread safe pool of point cloud buffers, divided into size classes.
+ *
+ * The size classes are set up by Configure from the largest point cloud a producer expects, e.g.
+ * a complete scan cycle, so that a buffer of a given size class always has room for the point
+ * clouds it is acquired for. A producer that outputs point clouds of similar size every cycle
+ * therefore performs no heap allocations once every size class it uses has a free buffer.
+ *
+ * Pools must be created with MakeShared<..., ESPMode::ThreadSafe>. Buffers may outlive the pool,
+ * they are then deleted when released.
+ */
+template <typename ElementType>
+class TAGX_LidarPointCloudBufferPool
+	: public TSharedFromThis<TAGX_LidarPointCloudBufferPool<ElementType>, ESPMode::ThreadSafe>
+{
+public:
+	using FBuffer = TAGX_LidarPointCloudBuffer<ElementType>;
+
+	/** Capacity of the smallest size class, smaller classes are not worth a free list. */
+	static constexpr int32 MinCapacity = 256;
+
+	~TAGX_LidarPointCloudBufferPool()
+	{
+		ReleaseFreeBuffers();
+	}
+
+	/**
+	 * Set up size classes for point clouds of at most MaxNumElements elements. The capacities are
+	 * MaxNumElements and repeated halvings of it down to MinCapacity. Free buffers from a previous
+	 * configuration are released and buffers currently in use are not reused.
+	 */
+	void Configure(int32 MaxNumElements)
+	{
+		FScopeLock ScopeLock(&Lock);
+		ReleaseFreeBuffers();
+		++Generation;
+		Capacities.Reset();
+		for (int32 Capacity = FMath::Max(MaxNumElements, MinCapacity); Capacity >= MinCapacity;
+			 Capacity /= 2)
+		{
+			Capacities.Insert(Capacity, 0);
+		}
+		FreeBuffers.SetNum(Capacities.Num());
+	}
+
+	/**
+	 * Get an empty buffer with room for at least NumElements elements, reusing a free buffer of
+	 * the smallest size class that is large enough if there is one. Requests larger than the
+	 * largest size class get a buffer that is deleted, instead of reused, when released.
+	 */
+	TRefCountPtr<FBuffer> Acquire(int32 NumElements)
+	{
+		FBuffer* Buffer = nullptr;
+		int32 SizeClass = INDEX_NONE;
+		int32 Capacity = NumElements;
+		uint32 CurrentGeneration = 0;
+		{
+			FScopeLock ScopeLock(&Lock);
+			const int32 LowerBound = Algo::LowerBound(Capacities, NumElements);
+			if (LowerBound < Capacities.Num())
+			{
+				SizeClass = LowerBound;
+				Capacity = Capacities[SizeClass];
+				TArray<FBuffer*>& Free = FreeBuffers[SizeClass];
+				if (Free.Num() > 0)
+				{
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+					Buffer = Free.Pop(false);
+#else
+					Buffer = Free.Pop(EAllowShrinking::No);
+#endif
+				}
+			}
+			CurrentGeneration = Generation;
+		}
+
+		if (Buffer == nullptr)
+		{
+			Buffer = new FBuffer();
+			Buffer->Pool = this->AsShared();
+			Buffer->SizeClass = SizeClass;
+			Buffer->Generation = CurrentGeneration;
+			Buffer->Data.Reserve(Capacity);
+			NumBuffersCreated.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Buffer->TimeStamp = 0.0;
+		return TRefCountPtr<FBuffer>(Buffer);
+	}
+
+	/** The number of buffers this pool has allocated so far. */
+	int32 GetNumBuffersCreated() const
+	{
+		return NumBuffersCreated.load(std::memory_order_relaxed);
+	}
+
+private:
+	friend class TAGX_LidarPointCloudBuffer<ElementType>;
+
+	void Return(FBuffer* Buffer)
+	{
+		Buffer->Data.Reset();
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (Buffer->SizeClass != INDEX_NONE && Buffer->Generation == Generation)
+			{
+				FreeBuffers[Buffer->SizeClass].Push(Buffer);
+				return;
+			}
+		}
+
+		delete Buffer;
+	}
+
+	void ReleaseFreeBuffers()
+	{
+		for (TArray<FBuffer*>& Buffers : FreeBuffers)
+		{
+			for (FBuffer* Buffer : Buffers)
+				delete Buffer;
+			Buffers.Reset();
+		}
+	}
+
+	FCriticalSection Lock;
+	TArray<int32> Capacities; // Ascending.
+	TArray<TArray<FBuffer*>> FreeBuffers; // One free list per size class.
+	uint32 Generation {0};
+	std::atomic<int32> NumBuffersCreated {0};
+};
+
+using FAGX_LidarScanPointBuffer = TAGX_LidarPointCloudBuffer<FAGX_LidarScanPoint>;
+using FAGX_LidarPackedXYZBuffer = TAGX_LidarPointCloudBuffer<FAGX_LidarPackedPointXYZ>;
+using FAGX_LidarPackedXYZIBuffer = TAGX_LidarPointCloudBuffer<FAGX_LidarPackedPointXYZI>;
+
+using FAGX_LidarScanPointBufferPool = TAGX_LidarPointCloudBufferPool<FAGX_LidarScanPoint>;
+using FAGX_LidarPackedXYZBufferPool = TAGX_LidarPointCloudBufferPool<FAGX_LidarPackedPointXYZ>;
+using FAGX_LidarPackedXYZIBufferPool = TAGX_LidarPointCloudBufferPool<FAGX_LidarPackedPointXYZI>;
+
+class AGXUNREAL_API FAGX_LidarPointCloudUtilities
+{
+public:
+	/**
+	 * Write the position of every valid point in Points to OutPacked, replacing its contents.
+	 * The positions are written as is, i.e. in the frame and unit of the scan points.
+	 */
+	static void Pack(
+		const TArray<FAGX_LidarScanPoint>& Points, TArray<FAGX_LidarPackedPointXYZ>& OutPacked);
+
+	/**
+	 * Write the position and intensity of every valid point in Points to OutPacked, replacing its
+	 * contents. The positions are written as is, i.e. in the frame and unit of the scan points.
+	 */
+	static void Pack(
+		const TArray<FAGX_LidarScanPoint>& Points, TArray<FAGX_LidarPackedPointXYZI>& OutPacked);
+};
@@ -4,22 +4,34 @@
 
 // AGX Dynamics for Unreal includes.
 #include "AGX_Real.h"
+#include "Sensors/AGX_LidarIntensityCache.h"
 #include "Sensors/AGX_LidarLineTraceEnums.h"
+#include "Sensors/AGX_LidarPointCloudBuffer.h"
 #include "Sensors/AGX_LidarScanPoint.h"
 
 // Unreal Engine includes.
 #include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
 
 class UTextureRenderTarget2D;
 
 struct FAGX_SensorMsgsPointCloud2;
+struct FTraceDatum;
+struct FTraceHandle;
 
 #include "AGX_LidarSensorLineTraceComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
 	FOnPointCloudDataOutput, const TArray<FAGX_LidarScanPoint>&, Points);
 
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FOnPointCloudBufferOutput, const TRefCountPtr<const FAGX_LidarScanPointBuffer>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FOnPackedXYZOutput, const TRefCountPtr<const FAGX_LidarPackedXYZBuffer>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(
+	FOnPackedXYZIOutput, const TRefCountPtr<const FAGX_LidarPackedXYZIBuffer>&);
+
 /**
  * EXPERIMENTAL
  *
@@ -94,6 +106,29 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "AGX Lidar")
 	FOnPointCloudDataOutput PointCloudDataOutput;
 
+	/**
+	 * Native counterpart of PointCloudDataOutput, executed at the same time with the same points.
+	 * The buffer is reference counted and never modified after it has been output, so subscribers
+	 * may keep the reference, e.g. to forward the point cloud to another thread, instead of copying
+	 * the points. The buffer is returned to the Lidar Sensor's pool when the last reference is
+	 * released.
+	 */
+	FOnPointCloudBufferOutput PointCloudBufferOutput;
+
+	/**
+	 * Executed at the same time as PointCloudDataOutput with the valid points packed as X, Y, Z
+	 * floats, in the local frame of the Lidar Sensor [cm]. The points are only packed if this
+	 * delegate is bound. The same ownership rules as for PointCloudBufferOutput apply.
+	 */
+	FOnPackedXYZOutput PackedXYZOutput;
+
+	/**
+	 * Executed at the same time as PointCloudDataOutput with the valid points packed as X, Y, Z,
+	 * Intensity floats, in the local frame of the Lidar Sensor [cm]. The points are only packed if
+	 * this delegate is bound. The same ownership rules as for PointCloudBufferOutput apply.
+	 */
+	FOnPackedXYZIOutput PackedXYZIOutput;
+
 	/**
 	 * Determines in what order points are scanned during a scan cycle.
 	 */
@@ -126,11 +161,50 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Lidar", Meta = (ClampMin = "0.0"))
 	FAGX_Real Range {20000.0};
 
+	/**
+	 * Determines how the line traces of the automatic scans are run.
+	 * Synchronous scans finish within the step in which they are made. Asynchronous scans are
+	 * submitted as a batch to the engine's asynchronous trace pipeline, which takes the trace cost
+	 * off the game thread, and their points are added to the output one frame later.
+	 * Manual scans are always synchronous.
+	 */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadOnly, Category = "AGX Lidar",
+		Meta =
+			(EditCondition = "ExecutionMode == EAGX_LidarLineTraceExecutonMode::Auto",
+			 ExposeOnSpawn))
+	EAGX_LidarLineTraceQueryMode QueryMode {EAGX_LidarLineTraceQueryMode::Synchronous};
+
+	/**
+	 * The collision channel used by the line traces. Only objects that block this channel are
+	 * detected by the Lidar Sensor.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Lidar")
+	TEnumAsByte<ECollisionChannel> TraceChannel {ECC_Visibility};
+
+	/**
+	 * Determines whether the line traces are run against the complex (per-triangle) collision of
+	 * the objects or against their simple collision shapes. Simple collision is faster but less
+	 * accurate.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Lidar")
+	bool bTraceComplex {true};
+
+	/**
+	 * Determines whether each scan first finds the objects within Range of the Lidar Sensor, using
+	 * a single overlap query, and skips the line traces of rays that cannot hit any of them.
+	 * This is beneficial in sparse scenes, where most rays miss. The overlap query uses the
+	 * simple collision shapes of the objects.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Lidar")
+	bool bCullAgainstRangeSphere {false};
+
 	/**
 	 * Determines whether an intensity value is calculated or not. If set to false, the value zero
 	 * is written instead. Using this functionality comes with a performance cost.
 	 * The intensity calculation takes the angle of incident, material roughness and distance into
-	 * account.
+	 * account. A Lidar Lambertian Opaque Material assigned with a Lidar Surface Material Component
+	 * replaces the material roughness with its Reflectivity.
 	 * The intensity drop over distance is a function of the specified Beam Exit Diameter and Beam
 	 * Divergence.
 	 */
@@ -235,8 +309,66 @@ private:
 	bool bIsValid {false};
 	FDelegateHandle PostStepForwardHandle;
 
-	// Buffer for storing scan data until the next data output is run.
-	TArray<FAGX_LidarScanPoint> Buffer;
+	// Buffer for storing scan data until the next data output is run. Always valid during play.
+	TRefCountPtr<FAGX_LidarScanPointBuffer> Buffer;
+
+	// Pools for the output buffers, with size classes sized for the scan pattern so that steady
+	// state scanning doesn't allocate.
+	TSharedPtr<FAGX_LidarScanPointBufferPool, ESPMode::ThreadSafe> ScanPointPool;
+	TSharedPtr<FAGX_LidarPackedXYZBufferPool, ESPMode::ThreadSafe> PackedXYZPool;
+	TSharedPtr<FAGX_LidarPackedXYZIBufferPool, ESPMode::ThreadSafe> PackedXYZIPool;
+
+	// The number of points a buffer is expected to hold at output.
+	int32 NumPointsPerOutput {0};
+
+	/** Create the buffer pools for the current scan pattern, see GetRayDirections. */
+	void InitBufferPools();
+
+	/** Execute the output delegates with the current Buffer and start a new one. */
+	void OutputBuffer();
+
+	// Local frame ray directions for the scan pattern parameters they were computed for.
+	struct FAGX_LidarRayTable
+	{
+		FVector2D FOV {FVector2D::ZeroVector};
+		FVector2D Resolution {FVector2D::ZeroVector};
+		EAGX_LidarLineTraceScanPattern ScanPattern {
+			EAGX_LidarLineTraceScanPattern::HorizontalSweep};
+		TArray<FVector> Directions;
+	};
+
+	FAGX_LidarRayTable RayTable;
+
+	/**
+	 * The local frame direction of every ray in the scan cycle, in scan order. Recomputed if any
+	 * of FOV, Resolution or ScanPattern has changed since the last call, in which case the buffer
+	 * pools are recreated if they exist.
+	 */
+	TArrayView<const FVector> GetRayDirections();
+
+	FAGX_LidarIntensityCache IntensityCache;
+
+	// A partial scan whose line traces are run by the engine's asynchronous trace pipeline.
+	struct FAGX_LidarAsyncScan
+	{
+		uint32 Id {0};
+		FTransform Origin {FTransform::Identity};
+		double TimeStamp {0.0};
+		double BeamExitRadius {0.0};
+		double BeamDivergenceRad {0.0};
+		bool bCalculateIntensity {false};
+		TRefCountPtr<FAGX_LidarScanPointBuffer> Points;
+		int32 NumPending {0}; // Number of line traces not yet completed.
+	};
+
+	// Asynchronous scans, in submission order, whose points have not yet been moved to Buffer.
+	TArray<FAGX_LidarAsyncScan> AsyncScans;
+	uint32 NextAsyncScanId {0};
+
+	void OnAsyncTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum, uint32 ScanId);
+
+	/** Move the points of completed asynchronous scans to Buffer, keeping the scan order. */
+	void FlushAsyncScans();
 
 	bool CheckValid() const;
 	void OnStepForward(double TimeStamp);
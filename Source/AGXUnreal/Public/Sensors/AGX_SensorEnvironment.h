@@ -9,6 +9,7 @@
 #include "Sensors/AGX_ShapeInstanceData.h"
 
 // Unreal Engine includes.
+#include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 
@@ -96,12 +97,15 @@ public:
 	bool bSetPreIntegratePosition {true};
 
 	/**
-	 * Whether or not the transform of added Instanced Static Meshes should be updated each
-	 * Tick. Updating Instanced Static Mesh transforms comes with some perfomance cost,
-	 * especially if a large number of instances are present.
+	 * Whether or not the instance transforms of added Instanced Static Meshes that are not Static
+	 * should be updated each Tick. Updating Instanced Static Mesh transforms comes with some
+	 * perfomance cost, especially if a large number of instances are present.
 	 * As an optimization, this can be disabled by setting this property to false. Note that any
-	 * transformation change of an Instanced Static Mesh Instance during Play will not be reflected
-	 * in the Lidar simulation.
+	 * transformation change of an Instanced Static Mesh Instance during Play will then not be
+	 * reflected in the Lidar simulation, only movement of the Instanced Static Mesh Component
+	 * itself.
+	 *
+	 * Instances of Instanced Static Mesh Components with Static Mobility are never updated.
 	 */
 	UPROPERTY(
 		EditAnywhere, BlueprintReadWrite, Category = "AGX Sensor Environment", AdvancedDisplay)
@@ -339,6 +343,10 @@ private:
 		UInstancedStaticMeshComponent& Mesh, int32 Index);
 	void OnLidarEndOverlapAGXMeshComponent(UAGX_SimpleMeshComponent& Mesh);
 
+	void TrackTransformUpdates(USceneComponent& Component, FDelegateHandle& OutHandle);
+	void OnTrackedComponentTransformUpdated(
+		USceneComponent* Component, EUpdateTransformFlags Flags, ETeleportType Teleport);
+
 #if WITH_EDITOR
 	virtual void PostInitProperties() override;
 	void InitPropertyDispatcher();
@@ -353,5 +361,14 @@ private:
 	TMap<TWeakObjectPtr<UAGX_SimpleMeshComponent>, FAGX_RtShapeInstanceData> TrackedAGXMeshes;
 	TSet<FAGX_IMUSensorReference> TrackedIMUs;
 
+	// Tracked Components that have moved since the last Tick.
+	TSet<TWeakObjectPtr<USceneComponent>> MovedComponents;
+	FDelegateHandle InstanceIndexUpdatedHandle;
+
+	// Lidar collision spheres that an Instanced Static Mesh instance has been added within since
+	// the last Tick. Adding an instance doesn't generate any overlap events, so these spheres must
+	// update their overlaps explicitly.
+	TSet<TWeakObjectPtr<USphereComponent>> SpheresWithAddedInstances;
+
 	FSensorEnvironmentBarrier NativeBarrier;
 };
@@ -7,6 +7,8 @@
 #include "Sensors/RtShapeInstanceBarrier.h"
 #include "Sensors/RtShapeBarrier.h"
 
+// Unreal Engine includes.
+#include "Delegates/IDelegateInstance.h"
 
 struct FAGX_RtInstanceData
 {
@@ -27,10 +29,16 @@ struct FAGX_RtShapeInstanceData
 {
 	FRtShapeBarrier Shape;
 	FAGX_RtInstanceData InstanceData;
+
+	// Binding to the Component's TransformUpdated delegate. Not bound for static Components.
+	FDelegateHandle TransformUpdatedHandle;
 };
 
 struct FAGX_RtInstancedShapeInstanceData
 {
 	FRtShapeBarrier Shape;
 	TMap<int32, FAGX_RtInstanceData> InstancesData;
+
+	// Binding to the Component's TransformUpdated delegate. Not bound for static Components.
+	FDelegateHandle TransformUpdatedHandle;
 };
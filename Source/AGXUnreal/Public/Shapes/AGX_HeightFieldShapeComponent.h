@@ -60,6 +60,12 @@ private:
 	/// Create the AGX Dynamics objects owned by the FBoxShapeBarrier.
 	void CreateNative();
 	virtual void Serialize(FArchive& Archive) override;
+#if WITH_EDITOR
+	virtual void CookAdditionalFilesOverride(
+		const TCHAR* PackageFilename, const ITargetPlatform* TargetPlatform,
+		TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile)
+		override;
+#endif
 
 private:
 	FHeightFieldShapeBarrier NativeBarrier;
@@ -5,6 +5,7 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_NativeOwner.h"
 #include "Terrain/AGX_DelegateParticleData.h"
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
 #include "Terrain/AGX_TerrainMeshUtilities.h"
 #include "Terrain/TerrainBarrier.h"
 
@@ -57,9 +58,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AGX Movable Terrain")
 	bool WriteTransformToNative();
 
+	/**
+	 * Broadcast every Step Forward with all particle data, if bound. Prefer Add Particle Data
+	 * Subscription from C++, which reads only the requested fields.
+	 */
 	UPROPERTY(BlueprintAssignable, Category = "AGX Movable Terrain")
 	FParticleDataMovableMulticastDelegate OnParticleData;
 
+	/**
+	 * Subscribe to the particle data of this Terrain. Only the requested fields are read from AGX
+	 * Dynamics, and no particle data is read at all when there are no due subscriptions and
+	 * nothing is bound to On Particle Data.
+	 *
+	 * @param Fields The particle data needed by the subscriber.
+	 * @param UpdateInterval Minimum time between two callbacks [s]. Zero means every Step Forward.
+	 * @param Callback Called with the particle data.
+	 * @return Identifier to pass to Remove Particle Data Subscription.
+	 */
+	int32 AddParticleDataSubscription(
+		EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback);
+
+	void RemoveParticleDataSubscription(int32 SubscriptionId);
+
 	virtual FTerrainBarrier* GetNative();
 	virtual const FTerrainBarrier* GetNative() const;
 	virtual FTerrainBarrier* GetOrCreateNative();
@@ -386,6 +406,7 @@ public:
 private:
 	FTerrainBarrier NativeBarrier;
 	FDelegateHandle PostStepForwardHandle;
+	FAGX_ParticleDataSubscriptions ParticleDataSubscriptions;
 
 	UPROPERTY()
 	TArray<float> CurrentHeights;
@@ -397,6 +418,14 @@ private:
 
 	HeightMesh TerrainMesh;
 	HeightMesh CollisionMesh;
+	FAGX_MeshTileBins TerrainMeshTileBins;
+	FAGX_MeshTileBins CollisionMeshTileBins;
+
+	/**
+	 * Regenerate and re-upload the tiles of the Terrain and, if enabled, Collision meshes that
+	 * contain any of the given modified terrain vertices.
+	 */
+	void UpdateDirtyMeshTiles(const TArray<std::tuple<int32, int32>>& ModifiedVertices);
 
 	void InitializeHeights();
 
@@ -0,0 +1,64 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Terrain/TerrainParticleTypes.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/**
+ * Called with the particle data requested by a particle data subscription. Only the arrays for the
+ * requested fields, and the Exists array, are guaranteed to be populated. The data is owned by the
+ * Terrain and is only valid during the call.
+ */
+DECLARE_DELEGATE_OneParam(FAGX_ParticleDataCallback, const FParticleDataById& /*ParticleData*/);
+
+/**
+ * The set of particle data subscriptions of a Terrain. Each subscription declares which particle
+ * data fields it needs and how often. When updated, the particle data is read from AGX Dynamics
+ * only if at least one subscription is due, and then only the union of the fields requested by the
+ * due subscriptions is read. The particle data arrays are kept between updates so that their
+ * memory can be reused.
+ */
+class AGXUNREAL_API FAGX_ParticleDataSubscriptions
+{
+public:
+	/**
+	 * Add a subscription.
+	 *
+	 * @param Fields The particle data needed by the subscriber.
+	 * @param UpdateInterval Minimum time between two callbacks [s]. Zero means every update.
+	 * @param Callback Called with the particle data.
+	 * @return Identifier to pass to Remove when the subscription is no longer needed.
+	 */
+	int32 Add(EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback);
+
+	void Remove(int32 SubscriptionId);
+
+	bool IsEmpty() const;
+
+	/**
+	 * Call the Callback of every subscription that is due at Time.
+	 *
+	 * @param Time The current time [s].
+	 * @param Fetch Called at most once, to read the given fields into the given particle data.
+	 */
+	void Update(double Time, TFunctionRef<void(EParticleDataFlags, FParticleDataById&)> Fetch);
+
+private:
+	struct FSubscription
+	{
+		int32 Id;
+		EParticleDataFlags Fields;
+		double UpdateInterval;
+		double NextUpdateTime;
+		FAGX_ParticleDataCallback Callback;
+	};
+
+	TArray<FSubscription> Subscriptions;
+	FParticleDataById ParticleData;
+	int32 NextId {0};
+};
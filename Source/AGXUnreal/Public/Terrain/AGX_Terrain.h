@@ -5,7 +5,9 @@
 // AGX Dynamics for Unreal includes.
 #include "AGX_Real.h"
 #include "Terrain/AGX_DelegateParticleData.h"
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
 #include "Terrain/AGX_TerrainHeightFetcher.h"
+#include "Terrain/AGX_TerrainHeightSnapshot.h"
 #include "Terrain/AGX_TerrainPagingSettings.h"
 #include "Terrain/AGX_Shovel.h"
 #include "Terrain/TerrainBarrier.h"
@@ -45,7 +47,7 @@
 #endif
 
 // Standard library includes.
-#include <mutex>
+#include <limits>
 
 #include "AGX_Terrain.generated.h"
 
@@ -282,9 +284,28 @@ public:
 	FTerrainPagerBarrier* GetNativeTerrainPager();
 	const FTerrainPagerBarrier* GetNativeTerrainPager() const;
 
+	/**
+	 * Broadcast every tick with all particle data, if bound. Prefer Add Particle Data Subscription
+	 * from C++, which reads only the requested fields.
+	 */
 	UPROPERTY(BlueprintAssignable, Category = "AGX Terrain Particles")
 	FParticleDataMulticastDelegate OnParticleData;
 
+	/**
+	 * Subscribe to the particle data of this Terrain. Only the requested fields are read from AGX
+	 * Dynamics, and no particle data is read at all when there are no due subscriptions and
+	 * nothing is bound to On Particle Data.
+	 *
+	 * @param Fields The particle data needed by the subscriber.
+	 * @param UpdateInterval Minimum time between two callbacks [s]. Zero means every tick.
+	 * @param Callback Called with the particle data.
+	 * @return Identifier to pass to Remove Particle Data Subscription.
+	 */
+	int32 AddParticleDataSubscription(
+		EParticleDataFlags Fields, double UpdateInterval, FAGX_ParticleDataCallback Callback);
+
+	void RemoveParticleDataSubscription(int32 SubscriptionId);
+
 #if WITH_EDITOR
 	virtual void PostInitProperties() override;
 	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& Event) override;
@@ -303,6 +324,7 @@ private:
 	bool CreateNativeTerrainPager();
 	void CreateNativeShovels();
 	void AddTerrainPagerBodies();
+	void PrefetchTerrainPagerHeights();
 	bool UpdateNativeTerrainMaterial();
 	bool UpdateNativeTerrainProperties();
 	bool UpdateNativeShapeMaterial();
@@ -316,6 +338,10 @@ private:
 #if WITH_EDITOR
 	void InitPropertyDispatcher();
 	virtual void PostLoad() override;
+	virtual void CookAdditionalFilesOverride(
+		const TCHAR* PackageFilename, const ITargetPlatform* TargetPlatform,
+		TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile)
+		override;
 #endif
 	virtual void Serialize(FArchive& Archive) override;
 
@@ -366,25 +392,34 @@ private:
 	FTerrainBarrier NativeBarrier;
 	FTerrainPagerBarrier NativeTerrainPagerBarrier;
 	FAGX_TerrainHeightFetcher HeightFetcher;
+
+	/**
+	 * The Source Landscape heights within the bounds, used by the Terrain Pager. Holds the original
+	 * heights when paging, in place of OriginalHeights.
+	 */
+	FAGX_TerrainHeightSnapshot HeightSnapshot;
+	FAGX_ParticleDataSubscriptions ParticleDataSubscriptions;
 	FDelegateHandle PostStepForwardHandle;
 
 	// Height field related variables.
-	std::mutex OriginalHeightsMutex;
 	TArray<float> OriginalHeights;
 	TArray<float> CurrentHeights;
 	TArray<FFloat16> DisplacementData;
 	TArray<FUpdateTextureRegion2D> DisplacementMapRegions; // TODO: Remove!
+	TBitArray<> DisplacementMapDirtyBlocks;
+	bool bDisplacementMapNeedsFullUpload = true;
 	int32 NumVerticesX = 0;
 	int32 NumVerticesY = 0;
 	bool DisplacementMapInitialized = false;
 
 	/**
-	 * Thread safe convenience function for reading heights from the source Landscape.
+	 * Thread safe, lock free, function for reading heights from the source Landscape.
 	 * The WorldPosStart is projected onto the Landscape and acts as the starting point (corner) of
 	 * the area that will be sampled (it does not snap to the nearest vertex). The steps between
 	 * height values are determined by the source Landscape quad size, and the number of steps by
 	 * VertsX and VertsY in the Landscape local positive X and Y direction respectively. The heights
-	 * are written to OutHeights in the ordering of AGX Dynamics.
+	 * are written to OutHeights in the ordering of AGX Dynamics. The heights are served from
+	 * HeightSnapshot.
 	 *
 	 * Returns true if the heights could be read, false otherwise.
 	 */
@@ -0,0 +1,99 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "Async/TaskGraphInterfaces.h"
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+// Standard library includes.
+#include <atomic>
+
+class ALandscape;
+
+/**
+ * Immutable copy of the Source Landscape heights within the bounds of a paging Terrain.
+ *
+ * The bounds vertex grid is divided into square chunks. A chunk is sampled from the Landscape, in
+ * parallel, the first time any of its heights are needed, or ahead of time by Prefetch. A sampled
+ * chunk is published through an atomic pointer and never modified after that, so reading heights
+ * never takes a lock, neither on the Terrain Pager worker thread nor on the game thread.
+ *
+ * Heights are stored in the Landscape's local frame, without scale.
+ */
+class AGXUNREAL_API FAGX_TerrainHeightSnapshot
+{
+public:
+	~FAGX_TerrainHeightSnapshot();
+
+	/**
+	 * Prepare the snapshot for a bounds vertex grid. No heights are sampled here.
+	 *
+	 * @param Landscape The Landscape to sample. Must outlive the snapshot, or until Reset.
+	 * @param BoundsCenter The center of the bounds, in world space.
+	 * @param NumVerticesX Number of vertices along the Landscape's local X axis.
+	 * @param NumVerticesY Number of vertices along the Landscape's local Y axis.
+	 */
+	void Init(
+		const ALandscape& Landscape, const FVector& BoundsCenter, int32 NumVerticesX,
+		int32 NumVerticesY);
+
+	/**
+	 * Wait for any prefetch in progress and free all sampled heights. Must be called on the game
+	 * thread, when nothing else reads from the snapshot.
+	 */
+	void Reset();
+
+	bool IsInitialized() const;
+
+	/**
+	 * Thread safe. Read the heights of VertsX by VertsY vertices starting at the vertex at
+	 * WorldPosStart, in the ordering of AGX Dynamics. Chunks not yet sampled are sampled in
+	 * parallel before the heights are copied.
+	 *
+	 * Returns false if the area is not within the bounds.
+	 */
+	bool GetHeights(
+		const FVector& WorldPosStart, int32 VertsX, int32 VertsY, TArray<float>& OutHeights);
+
+	/**
+	 * Thread safe. The height of the bounds vertex at the given index, with index zero at the
+	 * bounds corner with the smallest local X and Y.
+	 */
+	float GetHeight(int32 VertexX, int32 VertexY);
+
+	/**
+	 * Start sampling, on background threads, every chunk within Radius of WorldPosition that has
+	 * not been sampled or requested yet. Must be called on the game thread.
+	 */
+	void Prefetch(const FVector& WorldPosition, double Radius);
+
+private:
+	struct FChunk
+	{
+		TArray<float> Heights;
+	};
+
+	const FChunk& GetOrSampleChunk(int32 ChunkIndex);
+	FChunk* SampleChunk(int32 ChunkIndex) const;
+	void ReleaseChunks();
+
+	/** Landscape-local vertex index of the bounds vertex with index zero. */
+	FIntPoint CornerMin {0, 0};
+	FIntPoint NumVertices {0, 0};
+	FIntPoint NumChunks {0, 0};
+
+	// Copies of Landscape state, so that sampling threads read as little as possible from the
+	// Landscape itself.
+	const ALandscape* Landscape = nullptr;
+	FTransform LandscapeTransform;
+	FVector2D QuadSize {1.0, 1.0};
+	float FallbackHeight = 0.0f;
+
+	TUniquePtr<std::atomic<FChunk*>[]> Chunks;
+	TUniquePtr<std::atomic<bool>[]> ChunkRequested;
+
+	/** Prefetch tasks that may still be running. Only accessed from the game thread. */
+	FGraphEventArray PrefetchTasks;
+};
@@ -136,6 +136,35 @@ struct HeightMesh
 	}
 };
 
+/**
+ * The tiles of a Height Mesh binned into a uniform grid, so that the tiles containing a position
+ * can be found without testing every tile of the mesh.
+ */
+struct AGXUNREAL_API FAGX_MeshTileBins
+{
+	/**
+	 * Bin the tiles of Mesh. Each tile is grown by Margin in all directions before binning.
+	 */
+	void Init(const HeightMesh& Mesh, double Margin);
+
+	int32 NumTiles() const;
+
+	/**
+	 * Set the bit in OutTiles of every tile, grown by the margin, that contains Position. OutTiles
+	 * must have one bit per tile, in the same order as the tiles of the binned Height Mesh.
+	 */
+	void MarkTiles(const FVector2D& Position, TBitArray<>& OutTiles) const;
+
+private:
+	FBox2D Bounds {ForceInit};
+	FVector2D CellSize {1.0, 1.0};
+	FIntPoint NumCells {0, 0};
+	TArray<FBox2D> TileBoxes;
+
+	/// Indices of the tiles overlapping each cell, row-major.
+	TArray<TArray<int32>> Cells;
+};
+
 class UAGX_SimpleMeshComponent;
 
 /**
@@ -55,6 +55,14 @@ struct AGXUNREAL_API FAGX_TerrainPagingSettings
 	UPROPERTY(EditAnywhere, Category = "AGX Terrain Paging Settings")
 	double TileSize {2500.0};
 
+	/**
+	 * How far ahead in time, along the velocity of each tracked Rigid Body, Landscape heights are
+	 * prefetched for tiles that may soon be loaded [s]. Zero prefetches around the current
+	 * position only.
+	 */
+	UPROPERTY(EditAnywhere, Category = "AGX Terrain Paging Settings", Meta = (ClampMin = "0.0"))
+	double HeightPrefetchTime {1.0};
+
 	/**
 	 * Specifies whether or not to draw Terrain Paging grid debug rendering.
 	 */
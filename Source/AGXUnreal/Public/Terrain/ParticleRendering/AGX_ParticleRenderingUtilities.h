@@ -2,9 +2,14 @@
 
 #pragma once
 
+// AGX Dynamics for Unreal includes.
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
+
 // Unreal Engine includes.
 #include "CoreMinimal.h"
 
+struct FCoarseParticle;
+
 class AAGX_Terrain;
 class UAGX_MovableTerrainComponent;
 class UActorComponent;
@@ -12,6 +17,19 @@ class UNiagaraSystem;
 class UNiagaraComponent;
 class USceneComponent;
 
+/**
+ * Scratch memory for AGX_ParticleRenderingUtilities::GetActiveVoxels. Keep an instance alive
+ * between calls to avoid reallocating the memory every frame.
+ */
+struct AGXUNREAL_API FAGX_ActiveVoxelsBuffers
+{
+	/// Packed voxel indices found by each parallel task.
+	TArray<TArray<uint64>> TaskVoxelKeys;
+
+	/// Packed voxel indices found by all tasks, before removing duplicates.
+	TArray<uint64> VoxelKeys;
+};
+
 class AGXUNREAL_API AGX_ParticleRenderingUtilities
 {
 public:
@@ -31,6 +49,30 @@ public:
 	static UAGX_MovableTerrainComponent* GetParentMovableTerrainComponent(
 		const USceneComponent& SceneComponent, bool SkipWarnings = false);
 
+	/**
+	 * Add a particle data subscription to the parent Terrain Actor or, if there is none, the
+	 * parent Movable Terrain Component of the given particle renderer. Returns INDEX_NONE if
+	 * neither is found.
+	 */
+	static int32 AddParticleDataSubscription(
+		USceneComponent& Renderer, EParticleDataFlags Fields, FAGX_ParticleDataCallback Callback);
+
+	/**
+	 * Remove a particle data subscription previously added with Add Particle Data Subscription.
+	 */
+	static void RemoveParticleDataSubscription(USceneComponent& Renderer, int32 SubscriptionId);
+
+	/**
+	 * Find the voxels, of size VoxelSize, that intersect the bounding box of at least one of the
+	 * given coarse particles. The work is split over multiple threads for large particle counts.
+	 *
+	 * The resulting voxel indices are unique, sorted, and written to the XYZ components of
+	 * OutActiveVoxels. Voxel indices must be within [-2^20, 2^20) along each axis.
+	 */
+	static void GetActiveVoxels(
+		TArrayView<const FCoarseParticle> Particles, float VoxelSize,
+		FAGX_ActiveVoxelsBuffers& Buffers, TArray<FIntVector4>& OutActiveVoxels);
+
 	/**
 	 * Initializes the Niagara VFX System and attaches to the parent of the given component.
 	 */
@@ -122,10 +122,10 @@ public:
 	// ~End UNiagaraDataInterfaceBase Interface.
 
 	/** Sets the CoarseParticles in local data storage. */
-	void SetCoarseParticles(TArray<FCoarseParticle> NewCoarseParticles);
+	void SetCoarseParticles(const TArray<FCoarseParticle>& NewCoarseParticles);
 
 	/** Sets the Active Voxel Indices in local data storage. */
-	void SetActiveVoxelIndices(TArray<FIntVector4> AVIs);
+	void SetActiveVoxelIndices(const TArray<FIntVector4>& AVIs);
 
 	/** Get the number of elements that are currently allocated for in the hash table. */
 	int GetHashTableCapacity();
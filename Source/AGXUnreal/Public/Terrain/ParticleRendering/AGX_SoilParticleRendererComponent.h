@@ -5,6 +5,7 @@
 // AGX Dynamics for Unreal includes.
 #include "Terrain/TerrainParticleTypes.h"
 #include "Terrain/AGX_DelegateParticleData.h"
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
 
 // Unreal Engine includes.
 #include "Components/SceneComponent.h"
@@ -71,6 +72,7 @@ public:
 protected:
 	// ~Begin ActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	// ~End ActorComponent interface
 
 	// ~Begin UObject interface.
@@ -83,8 +85,39 @@ protected:
 private:
 	UNiagaraComponent* ParticleSystemComponent = nullptr;
 
-	UFUNCTION()
-	void HandleParticleData(FDelegateParticleData& data);
+	int32 ParticleDataSubscriptionId = INDEX_NONE;
+
+	/**
+	 * The user parameters declared by a Niagara System that this component knows how to populate.
+	 * Resolved once per Niagara System instead of once per frame.
+	 */
+	struct FNiagaraBindings
+	{
+		TWeakObjectPtr<const UNiagaraSystem> System;
+		bool bPositionsAndRadii = false;
+		bool bOrientations = false;
+		bool bVelocitiesAndMasses = false;
+		bool bExists = false;
+		bool bParticleCount = false;
+
+		/// The particle data fields needed by the bound user parameters.
+		EParticleDataFlags GetFields() const;
+	};
+
+	FNiagaraBindings NiagaraBindings;
+
+	/**
+	 * The particle data last written to the Niagara System, packed the way the Niagara array
+	 * parameters want it. Reused between frames, and used to skip parameters that did not change.
+	 */
+	FDelegateParticleData NiagaraParticleData;
+
+	/// Set when the Niagara parameters must be written even if the particle data did not change.
+	bool bNiagaraParticleDataDirty = true;
+
+	void ResolveNiagaraBindings(const UNiagaraSystem* System);
+
+	void HandleParticleData(const FParticleDataById& ParticleData);
 
 #if WITH_EDITOR
 	void InitPropertyDispatcher();
@@ -4,6 +4,9 @@
 
 // AGX Dynamics for Unreal includes.
 #include "Terrain/AGX_DelegateParticleData.h"
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
+#include "Terrain/ParticleRendering/AGX_ParticleRenderingUtilities.h"
+#include "Terrain/ParticleRendering/ParticleUpsamplingDataHandler.h"
 #include "Terrain/TerrainParticleTypes.h"
 
 // Unreal Engine includes.
@@ -114,6 +117,7 @@ public:
 protected:
 	// ~Begin UActorComponent interface.
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	// ~End UActorComponent interface.
 
 	// ~Begin UObject interface.
@@ -133,19 +137,12 @@ private:
 
 	float ElementSize = 0;
 
-	UFUNCTION()
-	void HandleParticleData(FDelegateParticleData& data);
+	int32 ParticleDataSubscriptionId = INDEX_NONE;
 
-	/**
-	 * Appends the voxel indices that a coarse particle intersects with to the given array.
-	 * The Position and Radius refers to the position and radius of a coarse particle in the
-	 * simulation.
-	 */
-	void AppendIfActiveVoxel(
-		TSet<FIntVector>& ActiveVoxelIndices, FVector Position, float Radius, float SizeOfVoxel);
+	void HandleParticleData(const FParticleDataById& ParticleData);
 
-	/**
-	 * Converts the active voxels from the set to a TArray
-	 */
-	TArray<FIntVector4> GetActiveVoxelsFromSet(TSet<FIntVector> VoxelSet);
+	// Per-frame buffers, kept between frames to reuse the allocated memory.
+	TArray<FCoarseParticle> CoarseParticles;
+	TArray<FIntVector4> ActiveVoxelIndices;
+	FAGX_ActiveVoxelsBuffers ActiveVoxelsBuffers;
 };
@@ -9,12 +9,68 @@
 #include <tuple>
 
 class ALandscape;
+class UPackage;
 
 namespace AGX_HeightFieldUtilities
 {
-	// StartPos is in world coordinate system.
+	// StartPos is in world coordinate system. If bUseHeightCache is set, and the height cache is
+	// enabled, then the heights are read from, or written to, the on-disk height cache. See
+	// IsHeightCacheEnabled and GetHeightCacheKey. In cooked builds the heights are instead read
+	// from the heights cooked with the package of CookedCacheOwner, see CookHeights, and nothing is
+	// written.
 	AGXUNREAL_API FHeightFieldShapeBarrier CreateHeightField(
-		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY);
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		bool bUseHeightCache = true, const UObject* CookedCacheOwner = nullptr);
+
+	// Read the Landscape heights of the vertices in the given area, row by row starting at the
+	// largest Y. Blocks of rows are read in parallel unless bParallel is false. StartPos is in
+	// world coordinate system.
+	AGXUNREAL_API TArray<float> GetLandscapeHeights(
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		bool bParallel = true);
+
+	// Directory where the height cache files are stored.
+	AGXUNREAL_API FString GetHeightCacheDir();
+
+	// True if the height cache is enabled in the AGX Simulation project settings.
+	AGXUNREAL_API bool IsHeightCacheEnabled();
+
+	// Directory that the cooked heights of the given package are read from in cooked builds.
+	AGXUNREAL_API FString GetCookedHeightCacheDir(const UPackage& Package);
+
+	// Compute the height cache key for the given area of the Landscape. The key depends on the
+	// Landscape GUID, transform, the area read, the resolution, and the content of the Landscape,
+	// so editing or moving the Landscape invalidates the cached heights. Returns false if no key
+	// could be computed, in which case the heights should not be cached.
+	AGXUNREAL_API bool GetHeightCacheKey(
+		const ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		FString& OutKey);
+
+	// Returns false if there are no cached heights, or not exactly NumHeights, for the key.
+	AGXUNREAL_API bool LoadCachedHeights(
+		const FString& Key, int32 NumHeights, TArray<float>& OutHeights);
+
+	// Returns false if there are no cooked heights, or not exactly NumHeights, for the key in the
+	// given package.
+	AGXUNREAL_API bool LoadCookedHeights(
+		const UPackage& Package, const FString& Key, int32 NumHeights, TArray<float>& OutHeights);
+
+	AGXUNREAL_API bool SaveCachedHeights(const FString& Key, const TArray<float>& Heights);
+
+#if WITH_EDITOR
+	// Read the heights of the given area of the Landscape and write them, as an additional cooked
+	// file, next to the package being cooked, so that CreateHeightField in the cooked build can
+	// read them instead of reading the Landscape. Call from CookAdditionalFilesOverride.
+	AGXUNREAL_API void CookHeights(
+		ALandscape& Landscape, const FVector& StartPos, double LengthX, double LengthY,
+		const TCHAR* PackageFilename,
+		TFunctionRef<void(const TCHAR* Filename, void* Data, int64 Size)> WriteAdditionalFile);
+#endif
+
+	// Remove the least recently used height cache files in Directory until the total size of the
+	// remaining ones is at most MaxSizeBytes. LoadCachedHeights marks an entry as used.
+	AGXUNREAL_API void PruneHeightCache(
+		int64 MaxSizeBytes, const FString& Directory = GetHeightCacheDir());
 
 	// Overall resolution using outer bounds (i.e. holes does not affect this value unless a
 	// complete part if a side has been removed using the Landscape tool.
@@ -50,6 +50,16 @@ struct FTrimeshShapeBarrier;
 
 struct FStaticMeshVertexBuffers;
 
+/**
+ * Collision triangle mesh of one LOD of a Static Mesh, with vertices at the same location merged.
+ * Positions are in the Static Mesh's own frame, without any transform or scale applied.
+ */
+struct AGXUNREAL_API FAGX_CollisionMeshData
+{
+	TArray<FVector3f> Vertices;
+	TArray<FTriIndices> Indices;
+};
+
 /// \todo Each nested ***ConstructionData classes below could contain the respective Make-function
 /// as a member function, to even furter reduce potential usage mistakes!
 
@@ -340,12 +350,46 @@ public:
 	 * share vertices between triangles more aggressively.
 	 *
 	 * The vertex positions are given in double precision because that is what AGX Dynamics expects.
+	 *
+	 * The simplified mesh is shared with all other callers using the same Static Mesh and LOD, see
+	 * the overload below, so only the transformation to RelativeTo is done per call.
 	 */
 	static bool GetStaticMeshCollisionData(
 		const FAGX_MeshWithTransform& InMesh, const FTransform& RelativeTo,
 		TArray<FVector>& OutVertices, TArray<FTriIndices>& OutIndices,
 		const uint32* LodIndexOverride = nullptr);
 
+	using FCollisionMeshDataPtr = TSharedPtr<const FAGX_CollisionMeshData, ESPMode::ThreadSafe>;
+
+	/**
+	 * Get the collision mesh data for one LOD of a Static Mesh from a process-wide cache, creating
+	 * it on first use. The data is shared, and reused until the Static Mesh is rebuilt with other
+	 * content.
+	 *
+	 * Thread safe, so it may be called from worker threads. On a cache miss in a cooked build the
+	 * mesh data may have to be read back from GPU memory, which blocks the calling thread until
+	 * the render thread has copied it.
+	 *
+	 * @return The collision mesh data, or nullptr if the Static Mesh doesn't have valid render
+	 * data for the LOD.
+	 */
+	static FCollisionMeshDataPtr GetStaticMeshCollisionData(
+		const UStaticMesh& StaticMesh, uint32 LodIndex);
+
+	/**
+	 * Tell the collision mesh data cache that the Static Mesh has been rebuilt, e.g. with
+	 * BuildFromMeshDescriptions. The next lookup checks the mesh content again.
+	 *
+	 * Rebuilds that change the size or bounds of the mesh, and edits made in the editor, are
+	 * detected without this.
+	 */
+	static void InvalidateStaticMeshCollisionData(const UStaticMesh& StaticMesh);
+
+	/**
+	 * Forget all cached collision mesh data. Data already handed out remains valid.
+	 */
+	static void ClearStaticMeshCollisionDataCache();
+
 	static TArray<FAGX_MeshWithTransform> ToMeshWithTransformArray(
 		const TArray<AStaticMeshActor*> Actors);
 
@@ -565,10 +609,44 @@ public:
 
 	/**
 	 * Simple comparison to test if two meshes are equal.
-	 * Does not test all possible data, but does vertex and RenderMaterial comparisons.
+	 * Does not test all possible data, but does vertex and RenderMaterial comparisons. If both
+	 * meshes have a content hash, see SetMeshContentHash, then the hashes are compared instead of
+	 * the vertices.
 	 */
 	static bool AreStaticMeshesEqual(UStaticMesh* MeshA, UStaticMesh* MeshB);
 
+	/**
+	 * Compute a hash of the given triangle mesh data. Positions, normals and texture coordinates
+	 * are quantized before hashing so that meshes that differ only by floating-point noise get the
+	 * same hash. Any of the arrays may be empty.
+	 *
+	 * @return The hash as a hexadecimal string.
+	 */
+	static FString ComputeMeshContentHash(
+		const TArray<FVector>& Positions, const TArray<uint32>& Indices,
+		const TArray<FVector>& Normals, const TArray<FVector2D>& UVs);
+
+	/**
+	 * Hash of the positions, indices and triangle normals of the given Trimesh.
+	 */
+	static FString ComputeMeshContentHash(const FTrimeshShapeBarrier& Trimesh);
+
+	/**
+	 * Hash of the positions, indices, normals and texture coordinates of the given Render Data.
+	 */
+	static FString ComputeMeshContentHash(const FRenderDataBarrier& RenderData);
+
+	/**
+	 * Remember the content hash of the data that a Static Mesh was created from, in the package
+	 * meta data. Does nothing in non-editor builds.
+	 */
+	static void SetMeshContentHash(UStaticMesh& Mesh, const FString& Hash);
+
+	/**
+	 * Get the content hash set with SetMeshContentHash, or an empty string if there is none.
+	 */
+	static FString GetMeshContentHash(const UStaticMesh& Mesh);
+
 	/**
 	 * Checks whether two Render Materials are equal.
 	 */
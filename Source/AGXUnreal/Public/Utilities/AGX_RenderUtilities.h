@@ -23,6 +23,15 @@ public:
 		UTextureRenderTarget2D& Texture, uint32 NumRegions, FUpdateTextureRegion2D* Regions,
 		uint32 SourcePitch, uint32 SourceBitsPerPixel, uint8* SourceData, bool bFreeData);
 
+	/**
+	 * Same as above, but the Regions array is moved into the render command so the caller doesn't
+	 * need to keep it alive. SourceData is not copied and must remain valid until the render
+	 * command has run.
+	 */
+	static bool UpdateRenderTextureRegions(
+		UTextureRenderTarget2D& Texture, TArray<FUpdateTextureRegion2D>&& Regions,
+		uint32 SourcePitch, uint32 SourceBitsPerPixel, uint8* SourceData);
+
 	/**
 	 * Renders the given ShapeContacts to the screen.
 	 * The rendering is not avaiable in built applications built with Shipping configuration.
@@ -0,0 +1,102 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// AGX Dynamics for Unreal includes.
+#include "Utilities/AGX_Statistics.h"
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_StatisticsHistory.generated.h"
+
+/**
+ * The AGX Dynamics statistics for a single step, as recorded by the AGX Simulation statistics
+ * history.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_StatisticsSample
+{
+	GENERATED_BODY()
+
+	/// The simulation time stamp at the end of the step [s].
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	double TimeStamp {0.0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	FAGX_Statistics Statistics;
+};
+
+/**
+ * Aggregate of a single statistic over all samples in the statistics history. Samples where AGX
+ * Dynamics did not report the statistic are not included.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREAL_API FAGX_StatisticsSummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	int32 NumSamples {0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	double Min {0.0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	double Max {0.0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	double Mean {0.0};
+
+	/// The value at the requested percentile, using the nearest-rank method.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AGX Statistics")
+	double Percentile {0.0};
+};
+
+/**
+ * Fixed-size ring buffer of per-step AGX Dynamics statistics. Once full, each new sample replaces
+ * the oldest one. All memory is allocated up front, so adding a sample never allocates.
+ */
+class AGXUNREAL_API FAGX_StatisticsHistory
+{
+public:
+	/// Discard all samples and make room for Capacity samples.
+	void SetCapacity(int32 Capacity);
+
+	int32 GetCapacity() const;
+
+	int32 Num() const;
+
+	/// Discard all samples but keep the allocated memory.
+	void Reset();
+
+	void Add(double TimeStamp, const FAGX_Statistics& Statistics);
+
+	/// Copy all samples, oldest first, into OutSamples.
+	void GetSamples(TArray<FAGX_StatisticsSample>& OutSamples) const;
+
+	/**
+	 * Aggregate a single statistic over all samples.
+	 *
+	 * @param StatisticName The name of a member of FAGX_Statistics, e.g. Sim_StepForwardTime.
+	 * @param Percentile The percentile to compute, in the range [0, 100].
+	 * @param OutSummary The aggregated values.
+	 * @return False if there is no statistic named StatisticName.
+	 */
+	bool GetSummary(
+		FName StatisticName, double Percentile, FAGX_StatisticsSummary& OutSummary) const;
+
+	/// Write all samples, oldest first, as comma-separated values with one row per sample.
+	bool ExportCsv(const FString& FilePath) const;
+
+private:
+	/// Index into Samples of the I'th oldest sample.
+	int32 GetIndex(int32 I) const;
+
+private:
+	TArray<FAGX_StatisticsSample> Samples;
+	int32 Capacity {0};
+
+	// Where the next sample will be written once Samples is full.
+	int32 Next {0};
+};
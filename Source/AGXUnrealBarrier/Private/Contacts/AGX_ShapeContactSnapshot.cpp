@@ -0,0 +1,18 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "Contacts/AGX_ShapeContactSnapshot.h"
+
+void FAGX_ShapeContactSnapshot::Reset()
+{
+	FirstShapeGuids.Reset();
+	SecondShapeGuids.Reset();
+	FirstBodyGuids.Reset();
+	SecondBodyGuids.Reset();
+	FirstPoints.Reset();
+	Locations.Reset();
+	Normals.Reset();
+	Depths.Reset();
+	Forces.Reset();
+	ShapeContactIndices.Reset();
+	GuidCache.Reset();
+}
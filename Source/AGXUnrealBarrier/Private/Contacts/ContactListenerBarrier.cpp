@@ -5,9 +5,23 @@
 // Contact Listener includes.
 #include "Contacts/ContactEventListener.h"
 
+// AGX Dynamics for Unreal includes.
+#include "AGX_Check.h"
+
+// AGX Dynamics includes.
+#include "BeginAGXIncludes.h"
+#include <agx/ref_ptr.h>
+#include <agxSDK/Simulation.h>
+#include "EndAGXIncludes.h"
+
 // Unreal Engine includes.
 #include "Modules/ModuleManager.h"
 
+struct FContactEventListenerRef
+{
+	agx::ref_ptr<ContactEventListener> Native;
+};
+
 void CreateContactEventListener(
 	FSimulationBarrier& Simulation,
 	TFunction<EAGX_KeepContactPolicy(double TimeStamp, FShapeContactBarrier&)> ImpactCallback,
@@ -21,3 +35,58 @@ void CreateContactEventListener(
 	// Listener implementation in AGX Dynamics for Unreal would do something more here.
 	new ContactEventListener(Simulation, ImpactCallback, ContactCallback, SeparationCallback);
 }
+
+FContactEventListenerBarrier::FContactEventListenerBarrier()
+	: NativeRef {new FContactEventListenerRef}
+{
+}
+
+FContactEventListenerBarrier::~FContactEventListenerBarrier()
+{
+	// Must provide a destructor implementation in the .cpp file because the std::unique_ptr
+	// NativeRef's destructor must be able to see the definition, not just the forward declaration,
+	// of FContactEventListenerRef.
+}
+
+FContactEventListenerBarrier::FContactEventListenerBarrier(
+	FContactEventListenerBarrier&& Other) noexcept
+	: NativeRef {std::move(Other.NativeRef)}
+{
+	Other.NativeRef = std::make_unique<FContactEventListenerRef>();
+}
+
+FContactEventListenerBarrier& FContactEventListenerBarrier::operator=(
+	FContactEventListenerBarrier&& Other) noexcept
+{
+	NativeRef = std::move(Other.NativeRef);
+	Other.NativeRef = std::make_unique<FContactEventListenerRef>();
+	return *this;
+}
+
+bool FContactEventListenerBarrier::HasNative() const
+{
+	return NativeRef->Native != nullptr;
+}
+
+void FContactEventListenerBarrier::AllocateNative(
+	FSimulationBarrier& Simulation,
+	TFunction<EAGX_KeepContactPolicy(double TimeStamp, FShapeContactBarrier&)> ImpactCallback,
+	TFunction<EAGX_KeepContactPolicy(double TimeStamp, FShapeContactBarrier&)> ContactCallback,
+	TFunction<void(double TimeStamp, FAnyShapeBarrier&, FAnyShapeBarrier&)> SeparationCallback)
+{
+	AGX_CHECK(!HasNative());
+	NativeRef->Native =
+		new ContactEventListener(Simulation, ImpactCallback, ContactCallback, SeparationCallback);
+}
+
+void FContactEventListenerBarrier::ReleaseNative()
+{
+	if (!HasNative())
+		return;
+
+	// The Simulation is cleared when the listener is removed, which also happens when the
+	// Simulation itself is destroyed.
+	if (agxSDK::Simulation* SimulationAGX = NativeRef->Native->getSimulation())
+		SimulationAGX->remove(NativeRef->Native);
+	NativeRef->Native = nullptr;
+}
@@ -17,6 +17,7 @@
 #include "Shapes/BoxShapeBarrier.h"
 #include "Shapes/CapsuleShapeBarrier.h"
 #include "Shapes/SphereShapeBarrier.h"
+#include "Shapes/TrimeshShapeBarrier.h"
 #include "SimulationBarrier.h"
 #include "Terrain/TerrainWheelBarrier.h"
 #include "Utilities/OpenPLXUtilities.h"
@@ -70,7 +71,11 @@
 #include "EndAGXIncludes.h"
 
 // Unreal Engine inludes.
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Templates/Function.h"
 
 // Standard library includes.
 #include <memory>
@@ -622,8 +627,30 @@ namespace
 		}
 	}
 
+	int32 CountObjects(FSimulationObjectCollection& SimObjects)
+	{
+		return SimObjects.GetRigidBodies().Num() + SimObjects.GetSphereShapes().Num() +
+			   SimObjects.GetBoxShapes().Num() + SimObjects.GetCylinderShapes().Num() +
+			   SimObjects.GetCapsuleShapes().Num() + SimObjects.GetTrimeshShapes().Num() +
+			   SimObjects.GetHingeConstraints().Num() + SimObjects.GetPrismaticConstraints().Num() +
+			   SimObjects.GetBallConstraints().Num() +
+			   SimObjects.GetCylindricalConstraints().Num() +
+			   SimObjects.GetDistanceConstraints().Num() + SimObjects.GetLockConstraints().Num() +
+			   SimObjects.GetSingleControllerConstraint1DOFs().Num() +
+			   SimObjects.GetWheelJoints().Num() + SimObjects.GetContactMaterials().Num() +
+			   SimObjects.GetDisabledCollisionGroups().Num() +
+			   SimObjects.GetObserverFrames().Num() + SimObjects.GetShapeMaterials().Num() +
+			   SimObjects.GetSteerings().Num() + SimObjects.GetTwoBodyTires().Num() +
+			   SimObjects.GetWires().Num() + SimObjects.GetShovels().Num() +
+			   SimObjects.GetTerrainWheels().Num() + SimObjects.GetTracks().Num() +
+			   SimObjects.GetCables().Num();
+	}
+
 	void ReadAll(agxSDK::Simulation& Simulation, FSimulationObjectCollection& OutSimObjects)
 	{
+		const double StartTime = FPlatformTime::Seconds();
+		FScopedSlowTask ReadTask(3.f, FText::FromString("Reading simulation objects"));
+
 		// These contain objects that are not free-standing but owned by something else and will
 		// be created by that something else. Should not result in Actor Components in the imported
 		// Actor or Blueprint, or new Assets in the Content Browser.
@@ -633,6 +660,9 @@ namespace
 		TSet<const agx::Material*> NonFreeMaterials;
 		TSet<const agx::ContactMaterial*> NonFreeContactMaterials;
 
+		// The owners of non-free objects are read first, serially, since they populate the
+		// non-free sets.
+		ReadTask.EnterProgressFrame(1.f, FText::FromString("Reading owning objects"));
 		OutSimObjects.GetSimulation() = std::make_shared<FSimulationBarrier>(
 			AGXBarrierFactories::CreateSimulationBarrier(&Simulation));
 		ReadTireModels(Simulation, OutSimObjects, NonFreeConstraints);
@@ -640,16 +670,43 @@ namespace
 		ReadShovels(
 			Simulation, OutSimObjects, NonFreeBodies, NonFreeGeometries, NonFreeConstraints,
 			NonFreeMaterials, NonFreeContactMaterials);
-		ReadMaterials(Simulation, OutSimObjects, NonFreeMaterials, NonFreeContactMaterials);
-		ReadGeometries(Simulation, OutSimObjects, NonFreeGeometries);
-		ReadRigidBodies(Simulation, OutSimObjects, NonFreeBodies);
-		ReadTerrainWheels(Simulation, OutSimObjects);
 		ReadTracks(Simulation, OutSimObjects, NonFreeConstraints);
 		ReadCables(Simulation, OutSimObjects, NonFreeConstraints);
-		ReadConstraints(Simulation, OutSimObjects, NonFreeConstraints);
-		ReadCollisionGroups(Simulation, OutSimObjects);
-		ReadWires(Simulation, OutSimObjects);
-		ReadObserverFrames(Simulation, OutSimObjects);
+
+		// The remaining categories only read the non-free sets and each write to their own arrays
+		// in the collection, so they can be read in parallel. Each category is still read
+		// serially, so the order within each array is the same as before.
+		ReadTask.EnterProgressFrame(
+			1.f, FText::FromString(FString::Printf(
+					 TEXT("Reading %d Geometries, %d Rigid Bodies and %d Constraints"),
+					 static_cast<int32>(Simulation.getGeometries().size()),
+					 static_cast<int32>(Simulation.getRigidBodies().size()),
+					 static_cast<int32>(Simulation.getConstraints().size()))));
+		const TArray<TFunction<void()>> Readers {
+			[&]()
+			{ ReadMaterials(Simulation, OutSimObjects, NonFreeMaterials, NonFreeContactMaterials); },
+			[&]() { ReadGeometries(Simulation, OutSimObjects, NonFreeGeometries); },
+			[&]() { ReadRigidBodies(Simulation, OutSimObjects, NonFreeBodies); },
+			[&]() { ReadTerrainWheels(Simulation, OutSimObjects); },
+			[&]() { ReadConstraints(Simulation, OutSimObjects, NonFreeConstraints); },
+			[&]() { ReadCollisionGroups(Simulation, OutSimObjects); },
+			[&]() { ReadWires(Simulation, OutSimObjects); },
+			[&]() { ReadObserverFrames(Simulation, OutSimObjects); }};
+		ParallelFor(Readers.Num(), [&Readers](int32 I) { Readers[I](); });
+
+		// Converting the collision mesh of large Trimeshes is the most expensive part of reading,
+		// and the converted buffers are needed both when deduplicating and when creating meshes.
+		TArray<FTrimeshShapeBarrier>& Trimeshes = OutSimObjects.GetTrimeshShapes();
+		ReadTask.EnterProgressFrame(
+			1.f, FText::FromString(FString::Printf(
+					 TEXT("Converting collision data of %d Trimeshes"), Trimeshes.Num())));
+		FTrimeshShapeBarrier::ConvertCollisionData(Trimeshes);
+
+		const double Duration = FPlatformTime::Seconds() - StartTime;
+		const int32 NumObjects = CountObjects(OutSimObjects);
+		UE_LOG(
+			LogAGX, Log, TEXT("Read %d simulation objects in %.2f s (%.0f objects/s)."),
+			NumObjects, Duration, Duration > 0.0 ? NumObjects / Duration : 0.0);
 	}
 
 	void ReadOpenPLXMaterials(
@@ -13,6 +13,31 @@
 #include <agxROS2/Qos.h>
 #include "EndAGXIncludes.h"
 
+//
+// Byte arrays
+//
+
+// The data of image and point cloud messages may be many megabytes, so it is copied in bulk
+// instead of byte by byte.
+
+template <typename VectorType>
+inline void CopyBytes(const VectorType& InData, TArray<uint8>& OutData)
+{
+	static_assert(sizeof(InData[0]) == sizeof(uint8));
+	OutData.SetNumUninitialized(static_cast<int32>(InData.size()));
+	if (OutData.Num() > 0)
+		FMemory::Memcpy(OutData.GetData(), &InData[0], OutData.Num());
+}
+
+template <typename VectorType>
+inline void CopyBytes(const TArray<uint8>& InData, VectorType& OutData)
+{
+	static_assert(sizeof(OutData[0]) == sizeof(uint8));
+	OutData.resize(InData.Num());
+	if (InData.Num() > 0)
+		FMemory::Memcpy(&OutData[0], InData.GetData(), InData.Num());
+}
+
 //
 // Qos
 //
@@ -1408,9 +1433,7 @@ inline FAGX_SensorMsgsCompressedImage Convert(const agxROS2::sensorMsgs::Compres
 	Msg.Header = Convert(InMsg.header);
 	Msg.Format = FString(InMsg.format.c_str());
 
-	Msg.Data.SetNum(InMsg.data.size());
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-		Msg.Data[i] = InMsg.data[i];
+	CopyBytes(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -1443,9 +1466,7 @@ inline FAGX_SensorMsgsImage Convert(const agxROS2::sensorMsgs::Image& InMsg)
 	Msg.IsBigendian = static_cast<uint8>(InMsg.is_bigendian);
 	Msg.Step = static_cast<int64>(InMsg.step);
 
-	Msg.Data.SetNum(InMsg.data.size());
-	for (int32 i = 0; i < InMsg.data.size(); ++i)
-		Msg.Data[i] = InMsg.data[i];
+	CopyBytes(InMsg.data, Msg.Data);
 
 	return Msg;
 }
@@ -1731,11 +1752,7 @@ inline FAGX_SensorMsgsPointCloud2 Convert(const agxROS2::sensorMsgs::PointCloud2
 	Msg.PointStep = static_cast<int64>(InMsg.point_step);
 	Msg.RowStep = static_cast<int64>(InMsg.row_step);
 
-	Msg.Data.Reserve(InMsg.data.size());
-	for (const auto& Byte : InMsg.data)
-	{
-		Msg.Data.Add(Byte);
-	}
+	CopyBytes(InMsg.data, Msg.Data);
 
 	Msg.IsDense = InMsg.is_dense;
 
@@ -1885,11 +1902,7 @@ inline agxROS2::sensorMsgs::CompressedImage Convert(const FAGX_SensorMsgsCompres
 	Msg.header = Convert(InMsg.Header);
 	Msg.format = TCHAR_TO_UTF8(*InMsg.Format);
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	CopyBytes(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -1924,11 +1937,7 @@ inline agxROS2::sensorMsgs::Image Convert(const FAGX_SensorMsgsImage& InMsg)
 	Msg.is_bigendian = InMsg.IsBigendian;
 	Msg.step = static_cast<uint32_t>(InMsg.Step);
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	CopyBytes(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -2233,11 +2242,7 @@ inline agxROS2::sensorMsgs::PointCloud2 Convert(const FAGX_SensorMsgsPointCloud2
 	Msg.row_step = InMsg.RowStep;
 	Msg.is_dense = InMsg.IsDense;
 
-	Msg.data.reserve(InMsg.Data.Num());
-	for (uint8 Value : InMsg.Data)
-	{
-		Msg.data.push_back(Value);
-	}
+	CopyBytes(InMsg.Data, Msg.data);
 
 	return Msg;
 }
@@ -23,6 +23,16 @@
 			MsgTypeROS2 MsgAGX;                                                                 \
 			if (Sub->Native->receiveMessage(MsgAGX))                                            \
 			{                                                                                   \
+				if (bLatestOnly)                                                                \
+				{                                                                               \
+					/* Skip ahead to the newest message without converting the older ones. */   \
+					MsgTypeROS2 NextAGX;                                                        \
+					while (Sub->Native->receiveMessage(NextAGX))                                \
+					{                                                                           \
+						agxROS2::freeContainerMemory(MsgAGX);                                   \
+						MsgAGX = std::move(NextAGX);                                            \
+					}                                                                           \
+				}                                                                               \
 				*static_cast<MsgTypeUnreal*>(&OutMsg) = Convert(MsgAGX);                        \
 				agxROS2::freeContainerMemory(MsgAGX);                                           \
 				return true;                                                                    \
@@ -305,7 +315,7 @@ void FROS2SubscriberBarrier::ReleaseNative()
 	MessageType = EAGX_ROS2MessageType::Invalid;
 }
 
-bool FROS2SubscriberBarrier::ReceiveMessage(FAGX_ROS2Message& OutMsg) const
+bool FROS2SubscriberBarrier::ReceiveMessage(FAGX_ROS2Message& OutMsg, bool bLatestOnly) const
 {
 	using namespace agxROS2::agxMsgs;
 	using namespace agxROS2::builtinInterfaces;
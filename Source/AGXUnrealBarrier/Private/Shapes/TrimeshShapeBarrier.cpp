@@ -13,6 +13,7 @@
 #include "EndAGXIncludes.h"
 
 // Unreal Engine includes.
+#include "Async/ParallelFor.h"
 #include "Interfaces/Interface_CollisionDataProvider.h"
 #include "Misc/AssertionMacros.h"
 
@@ -90,44 +91,67 @@ namespace
 	}
 
 	/**
-	 * Convert an AGX Dynamics render buffer to the corresponding Unreal Engine render buffer.
+	 * Convert an AGX Dynamics collision buffer to the corresponding Unreal Engine buffer.
 	 *
 	 * @tparam AGXType The element type of the AGX Dynamics source buffer.
 	 * @tparam UnrealType The element type of the Unreal Engine target buffer.
-	 * @tparam FGetAGXBuffer Function fetching the AGX Dynamics buffer from a Render Data Barrier.
 	 * @tparam FConvert Function converting an AGX Dynamics element to the Unreal Engine type.
-	 * @param Barrier The Render Data Barrier to fetch the AGX Dynamics buffer from.
-	 * @param Operation The operation being performed. Only for error reporting.
+	 * @param DataAGX The AGX Dynamics buffer to convert.
 	 * @param DataName The name of the buffer being convert. Only for error reporting.
-	 * @param GetAGXBuffer Callback for getting the AGX Dynamics buffer from the Render Data.
 	 * @param Convert Callback for converting AGX Dynamics elements to the Unreal Engien type.
-	 * @return A TArray containing the render buffer in Unreal Engine format.
+	 * @return A TArray containing the collision buffer in Unreal Engine format.
 	 */
-	template <typename AGXType, typename UnrealType, typename FGetAGXBuffer, typename FConvert>
+	template <typename AGXType, typename UnrealType, typename FConvert>
 	TArray<UnrealType> ConvertCollisionBuffer(
-		const FTrimeshShapeBarrier* Barrier, const TCHAR* Operation, const TCHAR* DataName,
-		FGetAGXBuffer GetAGXBuffer, FConvert Convert)
+		const agx::VectorPOD<AGXType>& DataAGX, const TCHAR* DataName, FConvert Convert)
 	{
 		TArray<UnrealType> DataUnreal;
-		const agxCollide::Trimesh* Trimesh = NativeTrimesh(Barrier, Operation);
-		if (Trimesh == nullptr)
-		{
-			return DataUnreal;
-		}
-		const agx::VectorPOD<AGXType>& DataAGX = GetAGXBuffer(Trimesh->getMeshData());
 		if (!CheckSize(DataAGX.size(), DataName))
 		{
 			return DataUnreal;
 		}
-		DataUnreal.Reserve(static_cast<int32>(DataAGX.size()));
-		for (AGXType DatumAGX : DataAGX)
+		const int32 Num = static_cast<int32>(DataAGX.size());
+		DataUnreal.SetNumUninitialized(Num);
+		for (int32 I = 0; I < Num; ++I)
 		{
-			DataUnreal.Add(Convert(DatumAGX));
+			DataUnreal[I] = Convert(DataAGX[I]);
 		}
 		return DataUnreal;
 	}
+
+	TArray<FVector> ConvertCollisionPositions(const agxCollide::CollisionMeshData& Mesh)
+	{
+		return ConvertCollisionBuffer<agx::Vec3, FVector>(
+			Mesh.getVertices(), TEXT("positions"),
+			[](const agx::Vec3& Position) { return ConvertDisplacement(Position); });
+	}
+
+	TArray<uint32> ConvertCollisionIndices(const agxCollide::CollisionMeshData& Mesh)
+	{
+		return ConvertCollisionBuffer<agx::UInt32, uint32>(
+			Mesh.getIndices(), TEXT("vertex indices"),
+			[](const agx::UInt32 Index) { return static_cast<uint32>(Index); });
+	}
+
+	TArray<FVector> ConvertCollisionNormals(const agxCollide::CollisionMeshData& Mesh)
+	{
+		return ConvertCollisionBuffer<agx::Vec3, FVector>(
+			Mesh.getNormals(), TEXT("normals"),
+			[](const agx::Vec3& Normal) { return ConvertVector(Normal); });
+	}
 }
 
+struct FTrimeshShapeBarrier::FConvertedCollisionData
+{
+	/// Keeps the mesh data alive so that the address comparison in GetConvertedCollisionData
+	/// cannot match a new mesh data allocated at the same address.
+	agx::ref_ptr<const agxCollide::CollisionMeshData> MeshData;
+
+	TArray<FVector> Positions;
+	TArray<uint32> Indices;
+	TArray<FVector> Normals;
+};
+
 FTrimeshShapeBarrier::FTrimeshShapeBarrier()
 	: FShapeBarrier()
 {
@@ -201,26 +225,44 @@ int32 FTrimeshShapeBarrier::GetNumTriangles() const
 
 TArray<FVector> FTrimeshShapeBarrier::GetVertexPositions() const
 {
-	return ConvertCollisionBuffer<agx::Vec3, FVector>(
-		this, TEXT("fetch positions from"), TEXT("positions"),
-		[](const agxCollide::MeshData* Mesh) -> auto& { return Mesh->getVertices(); },
-		[](const agx::Vec3& Position) { return ConvertDisplacement(Position); });
+	if (const FConvertedCollisionData* Converted = GetConvertedCollisionData())
+	{
+		return Converted->Positions;
+	}
+	const agxCollide::Trimesh* Trimesh = NativeTrimesh(this, TEXT("fetch positions from"));
+	if (Trimesh == nullptr)
+	{
+		return TArray<FVector>();
+	}
+	return ConvertCollisionPositions(*Trimesh->getMeshData());
 }
 
 TArray<uint32> FTrimeshShapeBarrier::GetVertexIndices() const
 {
-	return ConvertCollisionBuffer<agx::UInt32, uint32>(
-		this, TEXT("fetch indices from"), TEXT("vertex indices"),
-		[](const agxCollide::MeshData* Mesh) -> auto& { return Mesh->getIndices(); },
-		[](const agx::UInt32 Index) { return static_cast<uint32>(Index); });
+	if (const FConvertedCollisionData* Converted = GetConvertedCollisionData())
+	{
+		return Converted->Indices;
+	}
+	const agxCollide::Trimesh* Trimesh = NativeTrimesh(this, TEXT("fetch indices from"));
+	if (Trimesh == nullptr)
+	{
+		return TArray<uint32>();
+	}
+	return ConvertCollisionIndices(*Trimesh->getMeshData());
 }
 
 TArray<FVector> FTrimeshShapeBarrier::GetTriangleNormals() const
 {
-	return ConvertCollisionBuffer<agx::Vec3, FVector>(
-		this, TEXT("fetch triangle normals from"), TEXT("normals"),
-		[](const agxCollide::CollisionMeshData* Mesh) -> auto& { return Mesh->getNormals(); },
-		[](const agx::Vec3& Normal) { return ConvertVector(Normal); });
+	if (const FConvertedCollisionData* Converted = GetConvertedCollisionData())
+	{
+		return Converted->Normals;
+	}
+	const agxCollide::Trimesh* Trimesh = NativeTrimesh(this, TEXT("fetch triangle normals from"));
+	if (Trimesh == nullptr)
+	{
+		return TArray<FVector>();
+	}
+	return ConvertCollisionNormals(*Trimesh->getMeshData());
 }
 
 FString FTrimeshShapeBarrier::GetSourceName() const
@@ -250,6 +292,75 @@ FGuid FTrimeshShapeBarrier::GetMeshDataGuid() const
 	return FGuid();
 }
 
+void FTrimeshShapeBarrier::ConvertCollisionData(TArrayView<FTrimeshShapeBarrier> Trimeshes)
+{
+	// Find the unique mesh data serially, so that the Barriers sharing mesh data can share the
+	// converted buffers as well.
+	TMap<const agxCollide::CollisionMeshData*, int32> MeshDataIndices;
+	TArray<const agxCollide::CollisionMeshData*> UniqueMeshData;
+	TArray<int32> TrimeshToMeshData;
+	TrimeshToMeshData.Init(INDEX_NONE, Trimeshes.Num());
+	for (int32 I = 0; I < Trimeshes.Num(); ++I)
+	{
+		const agxCollide::Trimesh* Trimesh =
+			NativeTrimesh(&Trimeshes[I], TEXT("convert collision data of"));
+		if (Trimesh == nullptr || Trimesh->getMeshData() == nullptr)
+		{
+			continue;
+		}
+		const agxCollide::CollisionMeshData* MeshData = Trimesh->getMeshData();
+		if (const int32* Index = MeshDataIndices.Find(MeshData))
+		{
+			TrimeshToMeshData[I] = *Index;
+		}
+		else
+		{
+			TrimeshToMeshData[I] = UniqueMeshData.Add(MeshData);
+			MeshDataIndices.Add(MeshData, TrimeshToMeshData[I]);
+		}
+	}
+
+	TArray<std::shared_ptr<const FConvertedCollisionData>> Converted;
+	Converted.SetNum(UniqueMeshData.Num());
+	ParallelFor(
+		UniqueMeshData.Num(),
+		[&](int32 I)
+		{
+			const agxCollide::CollisionMeshData& MeshData = *UniqueMeshData[I];
+			std::shared_ptr<FConvertedCollisionData> Data =
+				std::make_shared<FConvertedCollisionData>();
+			Data->MeshData = &MeshData;
+			Data->Positions = ConvertCollisionPositions(MeshData);
+			Data->Indices = ConvertCollisionIndices(MeshData);
+			Data->Normals = ConvertCollisionNormals(MeshData);
+			Converted[I] = std::move(Data);
+		});
+
+	for (int32 I = 0; I < Trimeshes.Num(); ++I)
+	{
+		if (TrimeshToMeshData[I] != INDEX_NONE)
+		{
+			Trimeshes[I].ConvertedCollisionData = Converted[TrimeshToMeshData[I]];
+		}
+	}
+}
+
+const FTrimeshShapeBarrier::FConvertedCollisionData*
+FTrimeshShapeBarrier::GetConvertedCollisionData() const
+{
+	if (ConvertedCollisionData == nullptr || !HasNative())
+	{
+		return nullptr;
+	}
+	const agxCollide::Trimesh* Trimesh = NativeTrimesh(this);
+	if (Trimesh == nullptr || Trimesh->getMeshData() != ConvertedCollisionData->MeshData.get())
+	{
+		// The native has been replaced since the conversion, e.g. by SetNativeAddress.
+		return nullptr;
+	}
+	return ConvertedCollisionData.get();
+}
+
 void FTrimeshShapeBarrier::AllocateNative(
 	const TArray<FVector>& Vertices, const TArray<FTriIndices>& TriIndices, bool bClockwise,
 	const FString& SourceName)
@@ -291,10 +402,12 @@ void FTrimeshShapeBarrier::AllocateNativeShape()
 
 	NativeRef->NativeShape = new agxCollide::Trimesh(
 		&NativeVertices, &NativeIndices, Convert(Params->SourceName).c_str(), OptionsMask);
+	ConvertedCollisionData = nullptr;
 }
 
 void FTrimeshShapeBarrier::ReleaseNativeShape()
 {
 	check(HasNative());
 	NativeRef->NativeShape = nullptr;
+	ConvertedCollisionData = nullptr;
 }
@@ -39,6 +39,7 @@
 #include "EndAGXIncludes.h"
 
 // Unreal Engine includes.
+#include "Async/ParallelFor.h"
 #include "Misc/AssertionMacros.h"
 
 FSimulationBarrier::FSimulationBarrier()
@@ -573,6 +574,125 @@ TArray<FShapeContactBarrier> FSimulationBarrier::GetShapeContacts() const
 	return ShapeContactBarriers;
 }
 
+namespace SimulationBarrier_helpers
+{
+	// Converting an agx::Uuid to an FGuid goes via strings, so each Geometry and Rigid Body is
+	// converted only once per snapshot. The cache is owned by the snapshot and cleared by its
+	// Reset, since native objects may be freed and their addresses reused between snapshots.
+	template <typename T>
+	FGuid GetGuidCached(const T* Object, TMap<const void*, FGuid>& Cache)
+	{
+		if (Object == nullptr)
+		{
+			return FGuid();
+		}
+
+		if (const FGuid* Guid = Cache.Find(Object))
+		{
+			return *Guid;
+		}
+
+		return Cache.Add(Object, Convert(Object->getUuid()));
+	}
+
+	bool InvolvesShape(const agxCollide::GeometryContact& Contact, const agx::Uuid& Uuid)
+	{
+		return Contact.geometry(0)->getUuid() == Uuid || Contact.geometry(1)->getUuid() == Uuid;
+	}
+
+	bool InvolvesBody(const agxCollide::GeometryContact& Contact, const agx::Uuid& Uuid)
+	{
+		const agx::RigidBody* Body1 = Contact.rigidBody(0);
+		const agx::RigidBody* Body2 = Contact.rigidBody(1);
+		return (Body1 != nullptr && Body1->getUuid() == Uuid) ||
+			   (Body2 != nullptr && Body2->getUuid() == Uuid);
+	}
+}
+
+void FSimulationBarrier::GetShapeContactSnapshot(
+	const FAGX_ShapeContactFilter& Filter, FAGX_ShapeContactSnapshot& OutSnapshot) const
+{
+	using namespace SimulationBarrier_helpers;
+	check(HasNative());
+
+	OutSnapshot.Reset();
+
+	const bool bFilterShape = Filter.ShapeGuid.IsValid();
+	const bool bFilterBody = Filter.BodyGuid.IsValid();
+	const bool bFilterGroup = !Filter.CollisionGroup.IsNone();
+	const agx::Uuid ShapeUuid = bFilterShape ? Convert(Filter.ShapeGuid) : agx::Uuid();
+	const agx::Uuid BodyUuid = bFilterBody ? Convert(Filter.BodyGuid) : agx::Uuid();
+	const uint32 Group =
+		bFilterGroup ? StringTo32BitFnvHash(Filter.CollisionGroup.ToString()) : 0;
+
+	const agxCollide::GeometryContactPtrVector& ContactsAGX =
+		NativeRef->Native->getSpace()->getGeometryContacts();
+
+	TMap<const void*, FGuid>& GuidCache = OutSnapshot.GuidCache;
+	for (const agxCollide::GeometryContact* ContactAGX : ContactsAGX)
+	{
+		if (ContactAGX == nullptr || !ContactAGX->isValid())
+			continue;
+
+		if (bFilterShape && !InvolvesShape(*ContactAGX, ShapeUuid))
+			continue;
+
+		if (bFilterBody && !InvolvesBody(*ContactAGX, BodyUuid))
+			continue;
+
+		if (bFilterGroup && !ContactAGX->geometry(0)->hasGroup(Group) &&
+			!ContactAGX->geometry(1)->hasGroup(Group))
+			continue;
+
+		const int32 ShapeContactIndex = OutSnapshot.FirstPoints.Add(OutSnapshot.Locations.Num());
+		OutSnapshot.FirstShapeGuids.Add(GetGuidCached(ContactAGX->geometry(0), GuidCache));
+		OutSnapshot.SecondShapeGuids.Add(GetGuidCached(ContactAGX->geometry(1), GuidCache));
+		OutSnapshot.FirstBodyGuids.Add(GetGuidCached(ContactAGX->rigidBody(0), GuidCache));
+		OutSnapshot.SecondBodyGuids.Add(GetGuidCached(ContactAGX->rigidBody(1), GuidCache));
+
+		for (const agxCollide::ContactPoint& PointAGX : ContactAGX->points())
+		{
+			OutSnapshot.Locations.Add(ConvertDisplacement(PointAGX.point()));
+			OutSnapshot.Normals.Add(ConvertFloatVector(PointAGX.normal()));
+			OutSnapshot.Depths.Add(ConvertDistanceToUnreal<double>(PointAGX.depth()));
+			OutSnapshot.Forces.Add(ConvertVector(PointAGX.getForce()));
+			OutSnapshot.ShapeContactIndices.Add(ShapeContactIndex);
+		}
+	}
+}
+
+void FSimulationBarrier::GetRigidBodyStates(
+	TArrayView<const FRigidBodyBarrier* const> Bodies, TArray<FVector>& OutPositions,
+	TArray<FQuat>& OutRotations, TArray<FVector>& OutVelocities,
+	TArray<FVector>& OutAngularVelocities) const
+{
+	check(HasNative());
+
+	const int32 NumBodies = Bodies.Num();
+	OutPositions.SetNumUninitialized(NumBodies, EAllowShrinking::No);
+	OutRotations.SetNumUninitialized(NumBodies, EAllowShrinking::No);
+	OutVelocities.SetNumUninitialized(NumBodies, EAllowShrinking::No);
+	OutAngularVelocities.SetNumUninitialized(NumBodies, EAllowShrinking::No);
+
+	// Below this many bodies the cost of waking worker threads is larger than the gain.
+	constexpr int32 MinBodiesPerTask = 256;
+
+	ParallelFor(
+		NumBodies,
+		[&](int32 I)
+		{
+			const FRigidBodyBarrier* Body = Bodies[I];
+			check(Body != nullptr && Body->HasNative());
+			const agx::RigidBody* BodyAGX = Body->GetNative()->Native;
+			OutPositions[I] = ConvertDisplacement(BodyAGX->getPosition());
+			OutRotations[I] = Convert(BodyAGX->getRotation());
+			OutVelocities[I] = ConvertDisplacement(BodyAGX->getVelocity());
+			OutAngularVelocities[I] = ConvertAngularVelocity(BodyAGX->getAngularVelocity());
+		},
+		NumBodies < MinBodiesPerTask ? EParallelForFlags::ForceSingleThread
+									 : EParallelForFlags::None);
+}
+
 void FSimulationBarrier::Step()
 {
 	check(HasNative());
@@ -433,6 +433,32 @@ void FTerrainBarrier::GetHeights(TArray<float>& Heights, bool bChangesOnly) cons
 		}
 	}
 }
+
+TArray<std::tuple<int32, int32>> FTerrainBarrier::GetModifiedHeights(TArray<float>& Heights) const
+{
+	check(HasNative());
+	const agxCollide::HeightField* HeightField = NativeRef->Native->getHeightField();
+	const int32 SizeX = static_cast<int32>(HeightField->getResolutionX());
+	const int32 SizeY = static_cast<int32>(HeightField->getResolutionY());
+
+	// See GetHeights for a description of the Y axis flip.
+	const auto& ModifiedVerticesAGX = NativeRef->Native->getModifiedVertices();
+	TArray<std::tuple<int32, int32>> ModifiedVertices;
+	ModifiedVertices.Reserve(ModifiedVerticesAGX.size());
+	for (const auto& Index2d : ModifiedVerticesAGX)
+	{
+		const int32 X = static_cast<int32>(Index2d.x());
+		const int32 Y = SizeY - 1 - static_cast<int32>(Index2d.y());
+		const int32 I = X + Y * SizeX;
+		AGX_CHECK(Heights.Num() > I);
+		Heights[I] =
+			ConvertDistanceToUnreal<float>(HeightField->getHeight(Index2d.x(), Index2d.y()));
+		ModifiedVertices.Add(std::make_tuple(X, Y));
+	}
+
+	return ModifiedVertices;
+}
+
 void FTerrainBarrier::GetMinimumHeights(TArray<float>& MinimumHeights) const
 {
 	check(HasNative());
@@ -558,6 +584,14 @@ FParticleDataById FTerrainBarrier::GetParticleDataById(EParticleDataFlags ToIncl
 	return ParticleData;
 }
 
+void FTerrainBarrier::GetParticleDataById(
+	EParticleDataFlags ToInclude, FParticleDataById& OutParticleData) const
+{
+	check(HasNative());
+	FTerrainUtilities::ResetExcludedParticleData(OutParticleData, ToInclude);
+	FTerrainUtilities::GetParticleDataById(*this, OutParticleData, ToInclude);
+}
+
 size_t FTerrainBarrier::GetNumParticles() const
 {
 	check(HasNative());
@@ -272,6 +272,29 @@ FParticleDataById FTerrainPagerBarrier::GetParticleDataById(EParticleDataFlags T
 	return ParticleData;
 }
 
+void FTerrainPagerBarrier::GetParticleDataById(
+	EParticleDataFlags ToInclude, FParticleDataById& OutParticleData) const
+{
+	using namespace TerrainPagerBarrier_helpers;
+	check(HasNative());
+
+	FTerrainUtilities::ResetExcludedParticleData(OutParticleData, ToInclude);
+	const agxTerrain::TerrainPager::TileAttachmentPtrVector ActiveTiles =
+		NativeRef->Native->getActiveTileAttachments();
+	agxTerrain::Terrain* Terrain = GetFirstValidTerrainFrom(ActiveTiles);
+	if (Terrain == nullptr)
+	{
+		// No active tile means no particles, so the requested fields must be emptied as well.
+		FTerrainUtilities::ResetExcludedParticleData(
+			OutParticleData, static_cast<EParticleDataFlags>(0));
+		OutParticleData.Exists.Reset();
+		return;
+	}
+
+	const FTerrainBarrier TerrainBarrier = AGXBarrierFactories::CreateTerrainBarrier(Terrain);
+	FTerrainUtilities::GetParticleDataById(TerrainBarrier, OutParticleData, ToInclude);
+}
+
 size_t FTerrainPagerBarrier::GetNumParticles() const
 {
 	check(HasNative());
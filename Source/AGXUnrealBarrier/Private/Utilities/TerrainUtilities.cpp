@@ -401,6 +401,21 @@ void FTerrainUtilities::GetParticleDataById(
 		GetMassesById(ParticlesWithIdToIndex, OutParticleData.Masses);
 }
 
+void FTerrainUtilities::ResetExcludedParticleData(
+	FParticleDataById& ParticleData, EParticleDataFlags ToInclude)
+{
+	if (!(ToInclude & EParticleDataFlags::Positions))
+		ParticleData.Positions.Reset();
+	if (!(ToInclude & EParticleDataFlags::Velocities))
+		ParticleData.Velocities.Reset();
+	if (!(ToInclude & EParticleDataFlags::Radii))
+		ParticleData.Radii.Reset();
+	if (!(ToInclude & EParticleDataFlags::Rotations))
+		ParticleData.Rotations.Reset();
+	if (!(ToInclude & EParticleDataFlags::Masses))
+		ParticleData.Masses.Reset();
+}
+
 size_t FTerrainUtilities::GetNumParticles(const FTerrainBarrier& Terrain)
 {
 	AGX_CHECK(Terrain.HasNative());
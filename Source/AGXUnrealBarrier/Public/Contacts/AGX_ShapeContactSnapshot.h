@@ -0,0 +1,131 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+#include "AGX_ShapeContactSnapshot.generated.h"
+
+/**
+ * A flat, structure-of-arrays, copy of the Shape Contacts and Contact Points in a Simulation. Filled
+ * in a single pass by FSimulationBarrier::GetShapeContactSnapshot, without any per-contact
+ * allocations. Intended for analytics over large numbers of contacts, where working with
+ * FAGX_ShapeContact and FAGX_ContactPoint would be too expensive.
+ *
+ * There are two groups of arrays. The Shape Contact arrays have one element per Shape Contact, i.e.
+ * pair of touching Shapes, and the Contact Point arrays have one element per Contact Point. The
+ * Contact Points of Shape Contact I are the range [FirstPoints[I], FirstPoints[I + 1]), where the
+ * end of the last range is the number of Contact Points.
+ *
+ * Keep the snapshot around between calls to reuse the allocated memory.
+ *
+ * The arrays are not Blueprint readable since reading one from Blueprint copies the whole array.
+ * Blueprints read the snapshot one element at a time through UAGX_ShapeContactSnapshot_FL.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREALBARRIER_API FAGX_ShapeContactSnapshot
+{
+	GENERATED_BODY()
+
+	/* Shape Contact arrays. */
+
+	/// GUID of the AGX Dynamics Geometry of the first Shape in each Shape Contact.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FGuid> FirstShapeGuids;
+
+	/// GUID of the AGX Dynamics Geometry of the second Shape in each Shape Contact.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FGuid> SecondShapeGuids;
+
+	/// GUID of the Rigid Body of the first Shape, invalid if the Shape has no Rigid Body.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FGuid> FirstBodyGuids;
+
+	/// GUID of the Rigid Body of the second Shape, invalid if the Shape has no Rigid Body.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FGuid> SecondBodyGuids;
+
+	/// Index of the first Contact Point of each Shape Contact.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<int32> FirstPoints;
+
+	/* Contact Point arrays. */
+
+	/// World location of each Contact Point [cm].
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FVector> Locations;
+
+	/// Contact normal of each Contact Point, pointing from the second Shape towards the first.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FVector> Normals;
+
+	/// Penetration depth of each Contact Point [cm].
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<double> Depths;
+
+	/// Contact force of each Contact Point, as given to the first Shape [N]. Zero until the solver
+	/// has run.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<FVector> Forces;
+
+	/// Index of the Shape Contact that each Contact Point belongs to.
+	UPROPERTY(VisibleAnywhere, Category = "AGX Shape Contact Snapshot")
+	TArray<int32> ShapeContactIndices;
+
+	int32 GetNumShapeContacts() const
+	{
+		return FirstPoints.Num();
+	}
+
+	int32 GetNumContactPoints() const
+	{
+		return Locations.Num();
+	}
+
+	/// The number of Contact Points in Shape Contact ShapeContactIndex.
+	int32 GetNumContactPoints(int32 ShapeContactIndex) const
+	{
+		const int32 End = ShapeContactIndex + 1 < FirstPoints.Num()
+							  ? FirstPoints[ShapeContactIndex + 1]
+							  : GetNumContactPoints();
+		return End - FirstPoints[ShapeContactIndex];
+	}
+
+	/// Empty all arrays while keeping the allocated memory.
+	void Reset();
+
+private:
+	friend class FSimulationBarrier;
+
+	/**
+	 * GUIDs of the AGX Dynamics Geometries and Rigid Bodies seen while filling the snapshot, keyed
+	 * on the native object. Converting an AGX Dynamics UUID is expensive, so each object is
+	 * converted only once per snapshot. Kept here so that the allocation is reused between calls.
+	 */
+	TMap<const void*, FGuid> GuidCache;
+};
+
+/**
+ * Selects the Shape Contacts that are included in a Shape Contact Snapshot. Each set member
+ * narrows the selection, an empty filter selects all Shape Contacts. The filtering is done while
+ * iterating the AGX Dynamics contacts, so excluded contacts are never copied.
+ */
+USTRUCT(BlueprintType)
+struct AGXUNREALBARRIER_API FAGX_ShapeContactFilter
+{
+	GENERATED_BODY()
+
+	/// Only include Shape Contacts involving the Geometry with this GUID, if valid.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Shape Contact Filter")
+	FGuid ShapeGuid;
+
+	/// Only include Shape Contacts involving the Rigid Body with this GUID, if valid.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Shape Contact Filter")
+	FGuid BodyGuid;
+
+	/// Only include Shape Contacts where at least one Shape is in this Collision Group, if not
+	/// None.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGX Shape Contact Filter")
+	FName CollisionGroup;
+};
@@ -9,15 +9,59 @@
 #include "CoreMinimal.h"
 #include "Templates/Function.h"
 
+// Standard library includes.
+#include <memory>
+
 class FSimulationBarrier;
 class FShapeContactBarrier;
 struct FAnyShapeBarrier;
+struct FContactEventListenerRef;
 
-// TODO Create A Contact Event Listener Barrier class, return that from Create Contact Event
-// Listener, and let AGX Simulation hold it.
-
+/**
+ * Create an AGX Dynamics Contact Event Listener that is owned by the given Simulation, for
+ * listeners that should live as long as the Simulation. Use FContactEventListenerBarrier for a
+ * listener that can be removed.
+ */
 void AGXUNREALBARRIER_API CreateContactEventListener(
 	FSimulationBarrier& Simulation,
 	TFunction<EAGX_KeepContactPolicy(double Time, FShapeContactBarrier&)> ImpactCallback,
 	TFunction<EAGX_KeepContactPolicy(double Time, FShapeContactBarrier&)> ContactCallback,
 	TFunction<void(double Time, FAnyShapeBarrier&, FAnyShapeBarrier&)> SeparationCallback);
+
+/**
+ * Owns an AGX Dynamics Contact Event Listener created for a Contact Event Listener Component, so
+ * that the listener can be removed from the Simulation when the Component ends play.
+ */
+class AGXUNREALBARRIER_API FContactEventListenerBarrier
+{
+public:
+	FContactEventListenerBarrier();
+	~FContactEventListenerBarrier();
+	FContactEventListenerBarrier(FContactEventListenerBarrier&& Other) noexcept;
+	FContactEventListenerBarrier& operator=(FContactEventListenerBarrier&& Other) noexcept;
+
+	bool HasNative() const;
+
+	/**
+	 * Create an AGX Dynamics Contact Event Listener and add it to the given Simulation. The
+	 * callbacks are called from within the Simulation step.
+	 */
+	void AllocateNative(
+		FSimulationBarrier& Simulation,
+		TFunction<EAGX_KeepContactPolicy(double Time, FShapeContactBarrier&)> ImpactCallback,
+		TFunction<EAGX_KeepContactPolicy(double Time, FShapeContactBarrier&)> ContactCallback,
+		TFunction<void(double Time, FAnyShapeBarrier&, FAnyShapeBarrier&)> SeparationCallback);
+
+	/**
+	 * Remove the listener from the Simulation it was added to, if any. The callbacks are not
+	 * called after this.
+	 */
+	void ReleaseNative();
+
+private:
+	FContactEventListenerBarrier(const FContactEventListenerBarrier&) = delete;
+	void operator=(const FContactEventListenerBarrier&) = delete;
+
+private:
+	std::unique_ptr<FContactEventListenerRef> NativeRef;
+};
@@ -31,7 +31,11 @@ public:
 
 	void ReleaseNative();
 
-	bool ReceiveMessage(FAGX_ROS2Message& OutMsg) const;
+	/**
+	 * Receive the oldest queued message, or the newest one if bLatestOnly is set. With bLatestOnly
+	 * all older queued messages are discarded without being converted.
+	 */
+	bool ReceiveMessage(FAGX_ROS2Message& OutMsg, bool bLatestOnly = false) const;
 
 	EAGX_ROS2MessageType GetMessageType() const;
 
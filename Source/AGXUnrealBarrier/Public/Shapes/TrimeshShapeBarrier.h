@@ -7,8 +7,12 @@
 
 // Unreal Engine includes.
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Math/Vector.h"
 
+// Standard library includes.
+#include <memory>
+
 #include "TrimeshShapeBarrier.generated.h"
 
 struct FTriIndices;
@@ -36,6 +40,9 @@ struct FTriIndices;
  * The mesh data is stored in a hidden Mesh Data class that can be shared between Trimeshes. Use
  * GetMeshDataGuid to determine if this is the case.
  *
+ * Converting the collision mesh to Unreal Engine types is done on every call to the buffer getters
+ * unless ConvertCollisionData has been called, in which case the converted buffers are kept.
+ *
  * As with any shape, a trimesh may contain render data. The render mesh, if any, is separate from
  * the collision mesh and uses a different storage format.
  */
@@ -88,6 +95,17 @@ struct AGXUNREALBARRIER_API FTrimeshShapeBarrier : public FShapeBarrier
 	 */
 	FGuid GetMeshDataGuid() const;
 
+	/**
+	 * Convert the collision mesh data of all the given Trimeshes to Unreal Engine types, in
+	 * parallel, and keep the result in the Barriers. Later calls to GetVertexPositions,
+	 * GetVertexIndices and GetTriangleNormals return copies of the converted buffers instead of
+	 * converting again. Mesh data shared between Trimeshes is only converted once.
+	 *
+	 * The converted buffers are dropped if the native is released or replaced, but not if the
+	 * native mesh data is modified in place.
+	 */
+	static void ConvertCollisionData(TArrayView<FTrimeshShapeBarrier> Trimeshes);
+
 	void AllocateNative(
 		const TArray<FVector>& Vertices, const TArray<FTriIndices>& TriIndices, bool bClockwise,
 		const FString& SourceName);
@@ -111,4 +129,11 @@ private:
 	};
 
 	std::weak_ptr<AllocationParameters> TemporaryAllocationParameters;
+
+	/// Collision mesh buffers converted by ConvertCollisionData. Defined in the .cpp file.
+	struct FConvertedCollisionData;
+	std::shared_ptr<const FConvertedCollisionData> ConvertedCollisionData;
+
+	/// @return The converted buffers, if any, and only if they belong to the current native.
+	const FConvertedCollisionData* GetConvertedCollisionData() const;
 };
@@ -7,10 +7,14 @@
 #include "AMOR/ShapeContactMergeSplitThresholdsBarrier.h"
 #include "AMOR/WireMergeSplitThresholdsBarrier.h"
 #include "Utilities/AGX_Statistics.h"
+#include "Contacts/AGX_ShapeContactSnapshot.h"
 #include "Contacts/ShapeContactBarrier.h"
 
 // Unreal Engine includes.
+#include "Containers/ArrayView.h"
 #include "Containers/UnrealString.h"
+#include "Math/Quat.h"
+#include "Math/Vector.h"
 
 // Standard library includes.
 #include <memory>
@@ -127,6 +131,26 @@ public:
 	 */
 	TArray<FShapeContactBarrier> GetShapeContacts() const;
 
+	/**
+	 * Copy the Shape Contacts selected by the filter into the structure-of-arrays snapshot. The
+	 * snapshot is reset first but keeps its allocated memory, so reusing the same snapshot
+	 * between calls avoids any allocations once it has grown large enough.
+	 */
+	void GetShapeContactSnapshot(
+		const FAGX_ShapeContactFilter& Filter, FAGX_ShapeContactSnapshot& OutSnapshot) const;
+
+	/**
+	 * Read the position, rotation, velocity and angular velocity of many Rigid Bodies in one call.
+	 *
+	 * The output arrays are resized to the number of Rigid Bodies and element I in each of them
+	 * holds the state of Bodies[I]. All Rigid Bodies must have a native. Large batches are read
+	 * in parallel, so this must not be called while the Simulation is being stepped.
+	 */
+	void GetRigidBodyStates(
+		TArrayView<const FRigidBodyBarrier* const> Bodies, TArray<FVector>& OutPositions,
+		TArray<FQuat>& OutRotations, TArray<FVector>& OutVelocities,
+		TArray<FVector>& OutAngularVelocities) const;
+
 	/**
 	 * Perform one simulation step, moving the time stamp forward by one time step duration.
 	 */
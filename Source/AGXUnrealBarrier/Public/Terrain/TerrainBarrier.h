@@ -122,6 +122,14 @@ public:
 	 * optimization.
 	 */
 	void GetHeights(TArray<float>& OutHeights, bool bChangesOnly) const;
+
+	/**
+	 * Write the heights that were modified during the last AGX Dynamics Step Forward to
+	 * OutHeights and return the modified vertices. Same as GetHeights with ChangesOnly followed by
+	 * GetModifiedVertices, but iterates the modified vertices only once. OutHeights must already
+	 * hold all heights, in the layout described for GetHeights.
+	 */
+	TArray<std::tuple<int32, int32>> GetModifiedHeights(TArray<float>& OutHeights) const;
 	void GetMinimumHeights(TArray<float>& OutHeights) const;
 	FHeightFieldShapeBarrier GetHeightField() const;
 
@@ -159,6 +167,12 @@ public:
 	 */
 	FParticleDataById GetParticleDataById(EParticleDataFlags ToInclude) const;
 
+	/**
+	 * Same as above, but writes to an existing Particle Data By Id so that its memory can be reused
+	 * between calls. Arrays not indicated by ToInclude are emptied.
+	 */
+	void GetParticleDataById(EParticleDataFlags ToInclude, FParticleDataById& OutParticleData) const;
+
 	/**
 	 * Returns the number of spawned Terrain particles known by the Terrain Native.
 	 */
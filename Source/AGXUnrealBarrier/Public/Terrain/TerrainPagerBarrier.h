@@ -53,6 +53,12 @@ public:
 	 */
 	FParticleDataById GetParticleDataById(EParticleDataFlags ToInclude) const;
 
+	/**
+	 * Same as above, but writes to an existing Particle Data By Id so that its memory can be reused
+	 * between calls. Arrays not indicated by ToInclude are emptied.
+	 */
+	void GetParticleDataById(EParticleDataFlags ToInclude, FParticleDataById& OutParticleData) const;
+
 	/**
 	 * Returns the total number of spawned Terrain particles.
 	 */
@@ -78,6 +78,13 @@ public:
 		const FTerrainBarrier& Terrain, FParticleDataById& OutParticleData,
 		EParticleDataFlags ToInclude);
 
+	/**
+	 * Empty, while keeping the allocated memory, the arrays in ParticleData that are not indicated
+	 * by the ToInclude bit set flags.
+	 */
+	static void ResetExcludedParticleData(
+		FParticleDataById& ParticleData, EParticleDataFlags ToInclude);
+
 	/**
 	 * Returns the number of particles known to the passed Terrain.
 	 */
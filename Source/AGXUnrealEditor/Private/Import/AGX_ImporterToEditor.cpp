@@ -1460,6 +1460,8 @@ T* FAGX_ImporterToEditor::UpdateOrCreateAsset(T& Source, const FAGX_ImportContex
 		{
 			bool Result = AGX_MeshUtilities::CopyStaticMesh(&Source, Asset);
 			AGX_CHECK(Result);
+			AGX_MeshUtilities::SetMeshContentHash(
+				*Asset, AGX_MeshUtilities::GetMeshContentHash(Source));
 			Result = CopyProperties(Source, *Asset, TransientToAsset, DefaultOverwriteRule);
 			FixupRenderMaterial(TransientToAsset, *Asset); // CopyProperties does not handle arrays.
 			AGX_CHECK(Result);
@@ -0,0 +1,219 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains unit tests for asynchronous stepping in AGX Simulation.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_RigidBodyComponent.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "Shapes/AGX_BoxShapeComponent.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+///
+/// Asynchronous stepping determinism test starts here.
+///
+/// The same box stack scene is simulated twice, in two separate Play In Editor sessions. Once with
+/// synchronous stepping and once with asynchronous stepping. The final body states must be
+/// bit-identical.
+///
+
+namespace AGX_AsyncSteppingTest_helpers
+{
+	constexpr int32 NumBoxes = 6;
+}
+
+struct FAsyncSteppingResult
+{
+	double TimeStamp {-1.0};
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Velocities;
+	TArray<FVector> AngularVelocities;
+};
+
+// State owned by the test and carried between latent command invocations.
+struct FAsyncSteppingState
+{
+	AActor* Actor {nullptr};
+	TArray<UAGX_RigidBodyComponent*> Bodies;
+	double EndTimeStamp {-1.0};
+	FAsyncSteppingResult Results[2];
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FBuildBoxStackCommand, TSharedPtr<FAsyncSteppingState>, State, bool, bAsync);
+
+bool FBuildBoxStackCommand::Update()
+{
+	using namespace AGX_AsyncSteppingTest_helpers;
+	check(State != nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+
+	// Configure the simulation. Drop Immediately takes at most one step per frame, so both runs
+	// stop at exactly the same step.
+	Simulation->StepMode = SmDropImmediately;
+	Simulation->SetEnableAsyncStepping(bAsync);
+	State->EndTimeStamp = Simulation->GetTimeStamp() + 2.0;
+	State->Bodies.Reset();
+
+	// Spawn the Actor.
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = FName(TEXT("Async Stepping Actor"));
+	State->Actor = World->SpawnActor<AActor>(SpawnParameters);
+	USceneComponent* RootComponent = NewObject<USceneComponent>(
+		State->Actor, USceneComponent::GetDefaultSceneRootVariableName());
+	State->Actor->SetRootComponent(RootComponent);
+	State->Actor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	// Create the ground, a Shape without a Rigid Body.
+	UAGX_BoxShapeComponent* Ground =
+		NewObject<UAGX_BoxShapeComponent>(State->Actor, TEXT("Ground"));
+	Ground->SetHalfExtent(FVector(500.0, 500.0, 10.0));
+	Ground->SetupAttachment(RootComponent);
+	State->Actor->AddInstanceComponent(Ground);
+	Ground->RegisterComponent();
+
+	// Create a slightly skewed stack of boxes that will topple.
+	for (int32 I = 0; I < NumBoxes; ++I)
+	{
+		const FString BodyName = FString::Printf(TEXT("Body %d"), I);
+		UAGX_RigidBodyComponent* Body =
+			NewObject<UAGX_RigidBodyComponent>(State->Actor, FName(*BodyName));
+		Body->Mobility = EComponentMobility::Movable;
+		Body->SetupAttachment(RootComponent);
+		Body->SetRelativeLocation(FVector(I * 7.0, I * 3.0, 60.0 + I * 101.0));
+		Body->SetRelativeRotation(FRotator(0.0, I * 11.0, 0.0));
+		State->Actor->AddInstanceComponent(Body);
+		Body->RegisterComponent();
+
+		const FString ShapeName = FString::Printf(TEXT("Box %d"), I);
+		UAGX_BoxShapeComponent* Box =
+			NewObject<UAGX_BoxShapeComponent>(State->Actor, FName(*ShapeName));
+		Box->SetHalfExtent(FVector(50.0, 50.0, 50.0));
+		Box->SetupAttachment(Body);
+		State->Actor->AddInstanceComponent(Box);
+		Box->RegisterComponent();
+
+		State->Bodies.Add(Body);
+	}
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FRecordBoxStackCommand, TSharedPtr<FAsyncSteppingState>, State, int32, ResultIndex);
+
+bool FRecordBoxStackCommand::Update()
+{
+	check(State != nullptr);
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	Simulation->WaitForStepForward();
+
+	FAsyncSteppingResult& Result = State->Results[ResultIndex];
+	Result.TimeStamp = Simulation->GetTimeStamp();
+	for (const UAGX_RigidBodyComponent* Body : State->Bodies)
+	{
+		Result.Positions.Add(Body->GetPosition());
+		Result.Rotations.Add(Body->GetRotation());
+		Result.Velocities.Add(Body->GetVelocity());
+		Result.AngularVelocities.Add(Body->GetAngularVelocity());
+	}
+
+	// Restore the default so that other tests are not affected.
+	Simulation->SetEnableAsyncStepping(false);
+	State->Actor = nullptr;
+	State->Bodies.Reset();
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCompareBoxStackCommand, TSharedPtr<FAsyncSteppingState>, State, FAutomationTestBase&,
+	Test);
+
+bool FCompareBoxStackCommand::Update()
+{
+	using namespace AGX_AsyncSteppingTest_helpers;
+	const FAsyncSteppingResult& Sync = State->Results[0];
+	const FAsyncSteppingResult& Async = State->Results[1];
+
+	Test.TestEqual(TEXT("Time stamp"), Async.TimeStamp, Sync.TimeStamp);
+	if (!Test.TestEqual(TEXT("Number of synchronous bodies"), Sync.Positions.Num(), NumBoxes) ||
+		!Test.TestEqual(TEXT("Number of asynchronous bodies"), Async.Positions.Num(), NumBoxes))
+	{
+		return true;
+	}
+
+	// The bodies should have moved, otherwise the comparison is meaningless.
+	const double InitialTopZ = 60.0 + (NumBoxes - 1) * 101.0;
+	Test.TestTrue(TEXT("Top box has moved"), Sync.Positions.Last().Z < InitialTopZ);
+
+	// Exact comparisons, i.e. bit-identical results.
+	for (int32 I = 0; I < NumBoxes; ++I)
+	{
+		Test.TestTrue(
+			*FString::Printf(TEXT("Position %d bit-identical"), I),
+			Async.Positions[I] == Sync.Positions[I]);
+		Test.TestTrue(
+			*FString::Printf(TEXT("Rotation %d bit-identical"), I),
+			Async.Rotations[I] == Sync.Rotations[I]);
+		Test.TestTrue(
+			*FString::Printf(TEXT("Velocity %d bit-identical"), I),
+			Async.Velocities[I] == Sync.Velocities[I]);
+		Test.TestTrue(
+			*FString::Printf(TEXT("Angular velocity %d bit-identical"), I),
+			Async.AngularVelocities[I] == Sync.AngularVelocities[I]);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAsyncSteppingDeterminismTest, "AGXUnreal.Game.AGX_Simulation.AsyncSteppingDeterminism",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAsyncSteppingDeterminismTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FAsyncSteppingState> State = MakeShared<FAsyncSteppingState>();
+
+	for (int32 Run = 0; Run < 2; ++Run)
+	{
+		const bool bAsync = Run == 1;
+		ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+		ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+		ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+		ADD_LATENT_AUTOMATION_COMMAND(FBuildBoxStackCommand(State, bAsync))
+		ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+		ADD_LATENT_AUTOMATION_COMMAND(FRecordBoxStackCommand(State, Run));
+		ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+		ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEDownCommand);
+	}
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCompareBoxStackCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
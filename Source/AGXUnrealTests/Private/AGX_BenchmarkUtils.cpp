@@ -0,0 +1,228 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#include "AGX_BenchmarkUtils.h"
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+#include "Utilities/AGX_Statistics.h"
+
+// Unreal Engine includes.
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UnrealType.h"
+
+namespace AGX_BenchmarkUtils_helpers
+{
+	constexpr double DefaultTolerance = 0.1;
+
+	// Timings shorter than this, in milliseconds, are too noisy to compare relative to the
+	// baseline, so this much slack is always allowed.
+	constexpr double AbsoluteSlack = 0.05;
+
+	FString GetDirectoryFromCommandLine(const TCHAR* Key, const FString& Default)
+	{
+		FString Directory;
+		if (!FParse::Value(FCommandLine::Get(), Key, Directory))
+			return Default;
+		return Directory;
+	}
+
+	bool WriteResult(
+		const FString& Path, const FString& SceneName, int32 NumSteps,
+		const TMap<FString, int32>& Sizes, const TMap<FString, double>& Timings)
+	{
+		TSharedRef<FJsonObject> SizesJson = MakeShared<FJsonObject>();
+		for (const TPair<FString, int32>& Size : Sizes)
+		{
+			SizesJson->SetNumberField(Size.Key, Size.Value);
+		}
+
+		TSharedRef<FJsonObject> TimingsJson = MakeShared<FJsonObject>();
+		for (const TPair<FString, double>& Timing : Timings)
+		{
+			TimingsJson->SetNumberField(Timing.Key, Timing.Value);
+		}
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Scene"), SceneName);
+		Root->SetNumberField(TEXT("NumSteps"), NumSteps);
+		Root->SetObjectField(TEXT("Sizes"), SizesJson);
+		Root->SetObjectField(TEXT("Timings"), TimingsJson);
+
+		FString Text;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Text);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+			return false;
+		return FFileHelper::SaveStringToFile(Text, *Path);
+	}
+
+	/**
+	 * Read the scene sizes and timings from a benchmark result file. Files written before the
+	 * sizes were recorded have no sizes, those are assumed to match the defaults.
+	 */
+	bool ReadResult(
+		const FString& Path, TMap<FString, int32>& OutSizes, TMap<FString, double>& OutTimings)
+	{
+		FString Text;
+		if (!FFileHelper::LoadFileToString(Text, *Path))
+			return false;
+
+		TSharedPtr<FJsonObject> Root;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+		if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+			return false;
+
+		const TSharedPtr<FJsonObject>* SizesJson;
+		if (Root->TryGetObjectField(TEXT("Sizes"), SizesJson))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Size : (*SizesJson)->Values)
+			{
+				int32 Value;
+				if (Size.Value.IsValid() && Size.Value->TryGetNumber(Value))
+					OutSizes.Add(Size.Key, Value);
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* TimingsJson;
+		if (!Root->TryGetObjectField(TEXT("Timings"), TimingsJson))
+			return false;
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Timing : (*TimingsJson)->Values)
+		{
+			double Value;
+			if (Timing.Value.IsValid() && Timing.Value->TryGetNumber(Value))
+				OutTimings.Add(Timing.Key, Value);
+		}
+		return true;
+	}
+}
+
+int32 AGX_BenchmarkUtils::GetNumSteps()
+{
+	int32 NumSteps = DefaultNumSteps;
+	FParse::Value(FCommandLine::Get(), TEXT("AGXBenchmarkSteps="), NumSteps);
+	return FMath::Max(NumSteps, 1);
+}
+
+int32 AGX_BenchmarkUtils::GetSize(TMap<FString, int32>& Sizes, const TCHAR* Name, int32 Default)
+{
+	int32 Size = Default;
+	FParse::Value(FCommandLine::Get(), *FString::Printf(TEXT("AGXBenchmark%s="), Name), Size);
+	Size = FMath::Max(Size, 1);
+	Sizes.Add(Name, Size);
+	return Size;
+}
+
+void AGX_BenchmarkUtils::FTimingAccumulator::Add(const FString& Key, double Milliseconds)
+{
+	Sums.FindOrAdd(Key) += Milliseconds;
+	Counts.FindOrAdd(Key) += 1;
+}
+
+void AGX_BenchmarkUtils::FTimingAccumulator::AddStatistics(const FAGX_Statistics& Statistics)
+{
+	for (TFieldIterator<FFloatProperty> It(FAGX_Statistics::StaticStruct()); It; ++It)
+	{
+		const float Value = It->GetPropertyValue_InContainer(&Statistics);
+		if (Value < 0.0f)
+			continue; // Not reported by AGX Dynamics.
+		Add(It->GetName(), Value);
+	}
+}
+
+TMap<FString, double> AGX_BenchmarkUtils::FTimingAccumulator::GetMeans() const
+{
+	TMap<FString, double> Means;
+	for (const TPair<FString, double>& Sum : Sums)
+	{
+		Means.Add(Sum.Key, Sum.Value / static_cast<double>(Counts[Sum.Key]));
+	}
+	return Means;
+}
+
+void AGX_BenchmarkUtils::ReportResult(
+	FAutomationTestBase& Test, const FString& SceneName, int32 NumSteps,
+	const TMap<FString, int32>& Sizes, TMap<FString, double> Timings)
+{
+	using namespace AGX_BenchmarkUtils_helpers;
+
+	double Tolerance = DefaultTolerance;
+	FParse::Value(FCommandLine::Get(), TEXT("AGXBenchmarkTolerance="), Tolerance);
+
+	for (const TPair<FString, int32>& Size : Sizes)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s: %d"), *Size.Key, Size.Value));
+	}
+
+	Timings.KeySort(TLess<FString>());
+	for (const TPair<FString, double>& Timing : Timings)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s: %f ms"), *Timing.Key, Timing.Value));
+	}
+
+	// Write the result.
+	const FString DefaultOutputDir =
+		FPaths::Combine(FPaths::AutomationDir(), TEXT("AGXBenchmarks"));
+	const FString OutputDir =
+		GetDirectoryFromCommandLine(TEXT("AGXBenchmarkOutput="), DefaultOutputDir);
+	const FString OutputPath =
+		FPaths::Combine(OutputDir, FString::Printf(TEXT("%s.json"), *SceneName));
+	if (!WriteResult(OutputPath, SceneName, NumSteps, Sizes, Timings))
+	{
+		Test.AddError(
+			FString::Printf(TEXT("Could not write benchmark result to '%s'."), *OutputPath));
+	}
+	UE_LOG(LogAGX, Log, TEXT("Wrote benchmark result to '%s'."), *OutputPath);
+
+	// Compare against the baseline, if there is one.
+	const FString BaselineDir =
+		GetDirectoryFromCommandLine(TEXT("AGXBenchmarkBaseline="), FString());
+	if (BaselineDir.IsEmpty())
+		return;
+
+	const FString BaselinePath =
+		FPaths::Combine(BaselineDir, FString::Printf(TEXT("%s.json"), *SceneName));
+	TMap<FString, int32> BaselineSizes;
+	TMap<FString, double> Baseline;
+	if (!ReadResult(BaselinePath, BaselineSizes, Baseline))
+	{
+		Test.AddError(
+			FString::Printf(TEXT("Could not read benchmark baseline '%s'."), *BaselinePath));
+		return;
+	}
+
+	// Timings from scenes of different sizes are not comparable.
+	for (const TPair<FString, int32>& BaselineSize : BaselineSizes)
+	{
+		const int32* Size = Sizes.Find(BaselineSize.Key);
+		if (Size == nullptr || *Size != BaselineSize.Value)
+		{
+			Test.AddWarning(FString::Printf(
+				TEXT("Baseline '%s' was built with %s=%d, not comparing against it."),
+				*BaselinePath, *BaselineSize.Key, BaselineSize.Value));
+			return;
+		}
+	}
+
+	for (const TPair<FString, double>& Timing : Timings)
+	{
+		const double* BaselineValue = Baseline.Find(Timing.Key);
+		if (BaselineValue == nullptr)
+			continue;
+
+		const double Limit = *BaselineValue * (1.0 + Tolerance) + AbsoluteSlack;
+		if (Timing.Value > Limit)
+		{
+			Test.AddError(FString::Printf(
+				TEXT("%s regressed: %f ms, baseline %f ms, tolerance %.0f%%."), *Timing.Key,
+				Timing.Value, *BaselineValue, Tolerance * 100.0));
+		}
+	}
+}
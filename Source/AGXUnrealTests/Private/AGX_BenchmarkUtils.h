@@ -0,0 +1,55 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+#pragma once
+
+// Unreal Engine includes.
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+struct FAGX_Statistics;
+
+/**
+ * Helpers shared by the benchmarks, see AGX_StepBenchmark.cpp for the command line parameters and
+ * the result file format.
+ */
+namespace AGX_BenchmarkUtils
+{
+	constexpr int32 DefaultNumSteps = 500;
+	constexpr int32 NumWarmupSteps = 20;
+
+	/**
+	 * The number of steps to measure, given with -AGXBenchmarkSteps=<NumSteps> or DefaultNumSteps.
+	 */
+	int32 GetNumSteps();
+
+	/**
+	 * Read the scene size parameter -AGXBenchmark<Name>=<Value> from the command line, or use the
+	 * default if not given. The value used is recorded in Sizes.
+	 */
+	int32 GetSize(TMap<FString, int32>& Sizes, const TCHAR* Name, int32 Default);
+
+	/**
+	 * Sums per-step timings, in milliseconds, by name.
+	 */
+	struct FTimingAccumulator
+	{
+		void Add(const FString& Key, double Milliseconds);
+
+		/// Add each timing in FAGX_Statistics that AGX Dynamics reported.
+		void AddStatistics(const FAGX_Statistics& Statistics);
+
+		/// Mean time per added sample for each timing.
+		TMap<FString, double> GetMeans() const;
+
+		TMap<FString, double> Sums;
+		TMap<FString, int32> Counts;
+	};
+
+	/**
+	 * Log the sizes and timings, write them as JSON to the benchmark output directory and compare
+	 * the timings against the baseline, if one was given. Problems are reported on Test.
+	 */
+	void ReportResult(
+		FAutomationTestBase& Test, const FString& SceneName, int32 NumSteps,
+		const TMap<FString, int32>& Sizes, TMap<FString, double> Timings);
+}
@@ -0,0 +1,160 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains tests for reading Landscape heights when creating Height Fields.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_PlayInEditorUtils.h"
+#include "AgxAutomationCommon.h"
+#include "Terrain/AGX_Terrain.h"
+#include "Utilities/AGX_HeightFieldUtilities.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Landscape.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationEditorCommon.h"
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FCheckLandscapeHeightsCommand, FAutomationTestBase&, Test);
+
+bool FCheckLandscapeHeightsCommand::Update()
+{
+	check(GEditor != nullptr);
+	FWorldContext* WorldContext = GEditor->GetPIEWorldContext();
+	check(WorldContext != nullptr);
+	UWorld* World = WorldContext->World();
+	check(World != nullptr);
+
+	TArray<AActor*> AllTerrains;
+	UGameplayStatics::GetAllActorsOfClass(World, AAGX_Terrain::StaticClass(), AllTerrains);
+	if (!Test.TestEqual(TEXT("Number of terrains"), AllTerrains.Num(), 1))
+		return true;
+	AAGX_Terrain* Terrain = Cast<AAGX_Terrain>(AllTerrains[0]);
+	if (!Test.TestNotNull(TEXT("Terrain"), Terrain) ||
+		!Test.TestNotNull(TEXT("Source Landscape"), Terrain->SourceLandscape))
+		return true;
+	ALandscape& Landscape = *Terrain->SourceLandscape;
+
+	const std::tuple<double, double> Size = AGX_HeightFieldUtilities::GetLandscapeSizeXY(Landscape);
+	const FVector StartPos = Landscape.GetActorLocation();
+	const double LengthX = std::get<0>(Size);
+	const double LengthY = std::get<1>(Size);
+
+	// The parallel read must produce exactly the same heights as the serial read.
+	const TArray<float> Serial = AGX_HeightFieldUtilities::GetLandscapeHeights(
+		Landscape, StartPos, LengthX, LengthY, /*bParallel*/ false);
+	const TArray<float> Parallel = AGX_HeightFieldUtilities::GetLandscapeHeights(
+		Landscape, StartPos, LengthX, LengthY, /*bParallel*/ true);
+	Test.TestTrue(TEXT("Read some heights"), Serial.Num() > 0);
+	Test.TestTrue(TEXT("Parallel heights equal serial heights"), Serial == Parallel);
+
+	// The cache key must be stable for an unchanged Landscape and depend on the area read.
+	FString Key;
+	FString SameKey;
+	FString OtherKey;
+	if (!Test.TestTrue(
+			TEXT("Compute cache key"), AGX_HeightFieldUtilities::GetHeightCacheKey(
+										   Landscape, StartPos, LengthX, LengthY, Key)))
+		return true;
+	AGX_HeightFieldUtilities::GetHeightCacheKey(Landscape, StartPos, LengthX, LengthY, SameKey);
+	AGX_HeightFieldUtilities::GetHeightCacheKey(
+		Landscape, StartPos, LengthX / 2.0, LengthY, OtherKey);
+	Test.TestEqual(TEXT("Cache key is stable"), SameKey, Key);
+	Test.TestNotEqual(TEXT("Cache key depends on the area"), OtherKey, Key);
+
+	// Use a key of our own for the round trip so that the test does not disturb a real cache
+	// entry.
+	const FString TestKey = FString::Printf(TEXT("Test_%s"), *Key);
+	TArray<float> Cached;
+	Test.TestTrue(
+		TEXT("Save cached heights"), AGX_HeightFieldUtilities::SaveCachedHeights(TestKey, Serial));
+	Test.TestTrue(
+		TEXT("Load cached heights"),
+		AGX_HeightFieldUtilities::LoadCachedHeights(TestKey, Serial.Num(), Cached));
+	Test.TestTrue(TEXT("Cached heights equal serial heights"), Cached == Serial);
+	Test.TestFalse(
+		TEXT("Cached heights with the wrong size are rejected"),
+		AGX_HeightFieldUtilities::LoadCachedHeights(TestKey, Serial.Num() + 1, Cached));
+
+	IFileManager::Get().Delete(
+		*FPaths::Combine(AGX_HeightFieldUtilities::GetHeightCacheDir(), TestKey + TEXT(".bin")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLandscapeHeightsTest, "AGXUnreal.Game.AGX_HeightFieldUtilities.LandscapeHeights",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLandscapeHeightsTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	AddExpectedError(
+		TEXT("Could not allocate resource for Landscape Displacement Map for AGX Terrain"),
+		EAutomationExpectedErrorFlags::Contains, 0);
+
+	// The Shovel test map has a Terrain with a Source Landscape.
+	const FString MapPath {"/Game/Tests/Test_ShovelComponent"};
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(MapPath));
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLandscapeHeightsCommand(*this));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FPruneHeightCacheTest, "AGXUnreal.Editor.AGX_HeightFieldUtilities.PruneHeightCache",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPruneHeightCacheTest::RunTest(const FString& Parameters)
+{
+	// Use a directory of our own so that the test does not disturb the real height cache.
+	const FString Directory =
+		FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("AGXUnrealTests"), TEXT("Prune"));
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.DeleteDirectory(*Directory, false, true);
+
+	// Three entries of 1000 bytes each, and a file that isn't a cache entry, with the oldest
+	// entry first.
+	const FString Paths[] = {
+		FPaths::Combine(Directory, TEXT("Oldest.bin")),
+		FPaths::Combine(Directory, TEXT("Middle.bin")),
+		FPaths::Combine(Directory, TEXT("Newest.bin"))};
+	const FString OtherPath = FPaths::Combine(Directory, TEXT("Other.txt"));
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(1000);
+	const FDateTime Now = FDateTime::UtcNow();
+	for (int32 I = 0; I < UE_ARRAY_COUNT(Paths); ++I)
+	{
+		TestTrue(TEXT("Write entry"), FFileHelper::SaveArrayToFile(Bytes, *Paths[I]));
+		FileManager.SetTimeStamp(*Paths[I], Now - FTimespan::FromHours(3 - I));
+	}
+	FFileHelper::SaveArrayToFile(Bytes, *OtherPath);
+
+	AGX_HeightFieldUtilities::PruneHeightCache(3000, Directory);
+	TestTrue(TEXT("Nothing removed when within the limit"), FileManager.FileExists(*Paths[0]));
+
+	AGX_HeightFieldUtilities::PruneHeightCache(2500, Directory);
+	TestFalse(TEXT("Oldest entry removed"), FileManager.FileExists(*Paths[0]));
+	TestTrue(TEXT("Middle entry kept"), FileManager.FileExists(*Paths[1]));
+	TestTrue(TEXT("Newest entry kept"), FileManager.FileExists(*Paths[2]));
+	TestTrue(TEXT("Other files kept"), FileManager.FileExists(*OtherPath));
+
+	AGX_HeightFieldUtilities::PruneHeightCache(0, Directory);
+	TestFalse(TEXT("Middle entry removed"), FileManager.FileExists(*Paths[1]));
+	TestFalse(TEXT("Newest entry removed"), FileManager.FileExists(*Paths[2]));
+
+	FileManager.DeleteDirectory(*Directory, false, true);
+	return true;
+}
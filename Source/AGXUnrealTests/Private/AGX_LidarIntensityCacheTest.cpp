@@ -0,0 +1,42 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Sensors/AGX_LidarIntensityCache.h"
+#include "Sensors/AGX_LidarLambertianOpaqueMaterial.h"
+#include "Sensors/AGX_SurfaceMaterialAssetUserData.h"
+
+// Unreal Engine includes.
+#include "Components/StaticMeshComponent.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_LidarIntensityCacheTest, "AGXUnreal.Editor.AGX_LidarIntensityCache",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_LidarIntensityCacheTest::RunTest(const FString& Parameters)
+{
+	UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>();
+	FAGX_LidarIntensityCache Cache;
+	Cache.Init();
+
+	// Without a material or Surface Material override the surface reflects everything.
+	TestEqual(TEXT("Reflectivity without material"), Cache.GetReflectivity(*Component), 1.0);
+
+	// An override assigned during play is picked up at the next scan.
+	UAGX_LidarLambertianOpaqueMaterial* SurfaceMaterial =
+		NewObject<UAGX_LidarLambertianOpaqueMaterial>();
+	SurfaceMaterial->Reflectivity = 0.25f;
+	UAGX_SurfaceMaterialAssetUserData* Data =
+		NewObject<UAGX_SurfaceMaterialAssetUserData>(Component);
+	Data->LidarSurfaceMaterial = SurfaceMaterial;
+	Component->AddAssetUserData(Data);
+	TestEqual(
+		TEXT("Reflectivity is cached within a scan"), Cache.GetReflectivity(*Component), 1.0);
+	Cache.BeginScan();
+	TestEqual(
+		TEXT("Reflectivity from Surface Material"), Cache.GetReflectivity(*Component), 0.25);
+
+	Cache.Reset();
+	return true;
+}
@@ -0,0 +1,73 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Sensors/AGX_LidarPointCloudBuffer.h"
+
+// Unreal Engine includes.
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_LidarPointCloudBufferPoolTest, "AGXUnreal.Editor.AGX_LidarPointCloudBuffer.Pool",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_LidarPointCloudBufferPoolTest::RunTest(const FString& Parameters)
+{
+	auto Pool = MakeShared<FAGX_LidarScanPointBufferPool, ESPMode::ThreadSafe>();
+	Pool->Configure(1000);
+
+	const FAGX_LidarScanPointBuffer* First = nullptr;
+	{
+		TRefCountPtr<FAGX_LidarScanPointBuffer> Buffer = Pool->Acquire(600);
+		TestTrue(TEXT("Capacity of the size class"), Buffer->Data.Max() >= 600);
+		Buffer->Data.Add(FAGX_LidarScanPoint(true));
+		First = Buffer.GetReference();
+
+		// A consumer keeping a reference keeps the buffer out of the pool.
+		TRefCountPtr<const FAGX_LidarScanPointBuffer> Kept(Buffer.GetReference());
+		Buffer.SafeRelease();
+		TRefCountPtr<FAGX_LidarScanPointBuffer> Other = Pool->Acquire(600);
+		TestTrue(TEXT("Kept buffer is not reused"), Other.GetReference() != First);
+		TestEqual(TEXT("Kept buffer is unchanged"), Kept->Data.Num(), 1);
+	}
+
+	// Both buffers are back in the pool, the next ones of the same size class are reused.
+	const int32 NumCreated = Pool->GetNumBuffersCreated();
+	for (int32 I = 0; I < 10; ++I)
+	{
+		TRefCountPtr<FAGX_LidarScanPointBuffer> Buffer = Pool->Acquire(700);
+		TestEqual(TEXT("Reused buffer is empty"), Buffer->Data.Num(), 0);
+	}
+	TestEqual(TEXT("No new buffers in steady state"), Pool->GetNumBuffersCreated(), NumCreated);
+
+	// Buffers may outlive the pool.
+	TRefCountPtr<FAGX_LidarScanPointBuffer> Orphan = Pool->Acquire(10);
+	Pool.Reset();
+	Orphan.SafeRelease();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_LidarPointCloudBufferPackTest, "AGXUnreal.Editor.AGX_LidarPointCloudBuffer.Pack",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_LidarPointCloudBufferPackTest::RunTest(const FString& Parameters)
+{
+	TArray<FAGX_LidarScanPoint> Points;
+	Points.Add(FAGX_LidarScanPoint(FVector(1.0, 2.0, 3.0), 0.5, 0.25, true));
+	Points.Add(FAGX_LidarScanPoint(false));
+	Points.Add(FAGX_LidarScanPoint(FVector(4.0, 5.0, 6.0), 0.5, 0.75, true));
+
+	TArray<FAGX_LidarPackedPointXYZ> XYZ;
+	FAGX_LidarPointCloudUtilities::Pack(Points, XYZ);
+	TestEqual(TEXT("Invalid points are skipped"), XYZ.Num(), 2);
+	TestEqual(TEXT("Second point X"), XYZ[1].X, 4.0f);
+	TestEqual(TEXT("Second point Z"), XYZ[1].Z, 6.0f);
+
+	TArray<FAGX_LidarPackedPointXYZI> XYZI;
+	FAGX_LidarPointCloudUtilities::Pack(Points, XYZI);
+	TestEqual(TEXT("Invalid points are skipped"), XYZI.Num(), 2);
+	TestEqual(TEXT("First point Y"), XYZI[0].Y, 2.0f);
+	TestEqual(TEXT("First point intensity"), XYZI[0].Intensity, 0.25f);
+	return true;
+}
@@ -0,0 +1,424 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains unit tests for the Lidar Sensor Line Trace Component.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "Sensors/AGX_LidarSensorLineTraceComponent.h"
+
+// Unreal Engine includes.
+#include "Components/StaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+namespace AGX_LidarSensorLineTraceTest_helpers
+{
+	// High above the origin, away from anything else in the level.
+	const FVector LidarLocation(0.0, 0.0, 5000.0);
+
+	constexpr double LidarRange = 2000.0;
+
+	// The FOV divided by the Resolution, see CreateLidar.
+	constexpr int32 NumRaysCycle = 40 * 10;
+
+	// Engine cubes are 100 cm on each side.
+	constexpr double CubeSize = 100.0;
+
+	AActor* SpawnActorWithRoot(UWorld& World, const TCHAR* Name)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = FName(Name);
+		AActor* Actor = World.SpawnActor<AActor>(SpawnParameters);
+		USceneComponent* RootComponent = NewObject<USceneComponent>(
+			Actor, USceneComponent::GetDefaultSceneRootVariableName());
+		Actor->SetRootComponent(RootComponent);
+		Actor->AddInstanceComponent(RootComponent);
+		RootComponent->RegisterComponent();
+		return Actor;
+	}
+
+	/**
+	 * Create a static cube that blocks line traces. Location is relative to the Lidar, Extent is
+	 * the full size of the box along each axis.
+	 */
+	UStaticMeshComponent* CreateBox(
+		AActor& Actor, const TCHAR* Name, const FVector& Location, const FVector& Extent)
+	{
+		UStaticMesh* Cube =
+			LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		if (Cube == nullptr)
+			return nullptr;
+
+		UStaticMeshComponent* Box = NewObject<UStaticMeshComponent>(&Actor, FName(Name));
+		Box->SetStaticMesh(Cube);
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Box->SetupAttachment(Actor.GetRootComponent());
+		Box->SetWorldLocation(LidarLocation + Location);
+		Box->SetWorldScale3D(Extent / CubeSize);
+		Actor.AddInstanceComponent(Box);
+		Box->RegisterComponent();
+		return Box;
+	}
+
+	/**
+	 * Create a Lidar Sensor Line Trace Component with a small scan pattern looking along the X
+	 * axis. Configure is called before the Lidar begins play.
+	 */
+	template <typename FConfigureFunc>
+	UAGX_LidarSensorLineTraceComponent* CreateLidar(
+		AActor& Actor, const TCHAR* Name, FConfigureFunc Configure)
+	{
+		UAGX_LidarSensorLineTraceComponent* Lidar =
+			NewObject<UAGX_LidarSensorLineTraceComponent>(&Actor, FName(Name));
+		Lidar->FOV = {40.0, 10.0};
+		Lidar->Resolution = {1.0, 1.0};
+		Lidar->Range = LidarRange;
+		Lidar->bDebugRenderPoints = false;
+		Configure(*Lidar);
+		Lidar->SetupAttachment(Actor.GetRootComponent());
+		Lidar->SetWorldLocation(LidarLocation);
+		Actor.AddInstanceComponent(Lidar);
+		Lidar->RegisterComponent();
+		return Lidar;
+	}
+
+	void CollectPoints(
+		UAGX_LidarSensorLineTraceComponent& Lidar, TSharedPtr<TArray<FAGX_LidarScanPoint>> Points)
+	{
+		Lidar.PointCloudBufferOutput.AddLambda(
+			[Points](const TRefCountPtr<const FAGX_LidarScanPointBuffer>& Buffer)
+			{ Points->Append(Buffer->Data); });
+	}
+
+	/**
+	 * Test that two point clouds contain the same points in the same order, for the first Num
+	 * points. Returns the number of valid points compared.
+	 */
+	int32 TestSamePoints(
+		FAutomationTestBase& Test, const TArray<FAGX_LidarScanPoint>& Expected,
+		const TArray<FAGX_LidarScanPoint>& Actual, int32 Num)
+	{
+		int32 NumValid = 0;
+		for (int32 I = 0; I < Num; ++I)
+		{
+			const FAGX_LidarScanPoint& E = Expected[I];
+			const FAGX_LidarScanPoint& A = Actual[I];
+			if (E.bIsValid != A.bIsValid)
+			{
+				Test.AddError(FString::Printf(TEXT("Point %d differs in hit or miss."), I));
+				return NumValid;
+			}
+
+			if (!E.bIsValid)
+				continue;
+
+			++NumValid;
+			if (!A.Position.Equals(E.Position, KINDA_SMALL_NUMBER) || A.TimeStamp != E.TimeStamp ||
+				!FMath::IsNearlyEqual(A.Intensity, E.Intensity))
+			{
+				Test.AddError(FString::Printf(
+					TEXT("Point %d differs: expected %s at %f, got %s at %f."), I,
+					*E.Position.ToString(), E.TimeStamp, *A.Position.ToString(), A.TimeStamp));
+				return NumValid;
+			}
+		}
+		return NumValid;
+	}
+
+	int32 GetNumPointsInside(
+		const TArray<FAGX_LidarScanPoint>& Points, const UStaticMeshComponent& Box)
+	{
+		// The points are given relative to the Lidar, which is not rotated.
+		const FBox HitBox = Box.Bounds.GetBox().ExpandBy(1.0);
+		int32 NumInside = 0;
+		for (const FAGX_LidarScanPoint& Point : Points)
+		{
+			if (Point.bIsValid && HitBox.IsInside(LidarLocation + Point.Position))
+				++NumInside;
+		}
+		return NumInside;
+	}
+}
+
+///
+/// Lidar Line Trace Query Mode test starts here.
+///
+/// Two Lidars at the same location, one with synchronous and one with asynchronous line traces,
+/// scan the same static scene. The asynchronous point cloud lags behind but must otherwise contain
+/// the same points as the synchronous one.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FLidarQueryModeState
+{
+	UAGX_LidarSensorLineTraceComponent* SyncLidar {nullptr};
+	UAGX_LidarSensorLineTraceComponent* AsyncLidar {nullptr};
+	TSharedPtr<TArray<FAGX_LidarScanPoint>> SyncPoints {MakeShared<TArray<FAGX_LidarScanPoint>>()};
+	TSharedPtr<TArray<FAGX_LidarScanPoint>> AsyncPoints {
+		MakeShared<TArray<FAGX_LidarScanPoint>>()};
+	double EndTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FBuildLidarQueryModeCommand, TSharedPtr<FLidarQueryModeState>, State, FAutomationTestBase&,
+	Test);
+
+bool FBuildLidarQueryModeCommand::Update()
+{
+	using namespace AGX_LidarSensorLineTraceTest_helpers;
+	check(State != nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	State->EndTimeStamp = Simulation->GetTimeStamp() + 1.0;
+
+	AActor* Actor = SpawnActorWithRoot(*World, TEXT("Lidar Query Mode Actor"));
+
+	// A wall covering the left half of the field of view and a smaller box to the right, so that
+	// the scan has both hits and misses.
+	UStaticMeshComponent* Wall =
+		CreateBox(*Actor, TEXT("Wall"), FVector(500.0, -100.0, 0.0), FVector(100.0, 200.0, 200.0));
+	UStaticMeshComponent* Box =
+		CreateBox(*Actor, TEXT("Box"), FVector(800.0, 200.0, 0.0), FVector(100.0, 100.0, 50.0));
+	if (!Test.TestNotNull(TEXT("Wall"), Wall) || !Test.TestNotNull(TEXT("Box"), Box))
+		return true;
+
+	State->SyncLidar = CreateLidar(
+		*Actor, TEXT("Sync Lidar"), [](UAGX_LidarSensorLineTraceComponent& Lidar)
+		{ Lidar.QueryMode = EAGX_LidarLineTraceQueryMode::Synchronous; });
+	State->AsyncLidar = CreateLidar(
+		*Actor, TEXT("Async Lidar"), [](UAGX_LidarSensorLineTraceComponent& Lidar)
+		{ Lidar.QueryMode = EAGX_LidarLineTraceQueryMode::Asynchronous; });
+	CollectPoints(*State->SyncLidar, State->SyncPoints);
+	CollectPoints(*State->AsyncLidar, State->AsyncPoints);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckLidarQueryModeCommand, TSharedPtr<FLidarQueryModeState>, State, FAutomationTestBase&,
+	Test);
+
+bool FCheckLidarQueryModeCommand::Update()
+{
+	using namespace AGX_LidarSensorLineTraceTest_helpers;
+	if (State->SyncLidar == nullptr || State->AsyncLidar == nullptr)
+		return true;
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation::GetFrom(World)->WaitForStepForward();
+
+	// Both Lidars scan the same rays at the same time stamps, so the point clouds are equal up to
+	// the points the asynchronous Lidar is still waiting for.
+	const TArray<FAGX_LidarScanPoint>& SyncPoints = *State->SyncPoints;
+	const TArray<FAGX_LidarScanPoint>& AsyncPoints = *State->AsyncPoints;
+	const int32 Num = FMath::Min(SyncPoints.Num(), AsyncPoints.Num());
+	if (!Test.TestTrue(TEXT("At least one scan cycle of output"), Num >= NumRaysCycle))
+		return true;
+
+	const int32 NumValid = TestSamePoints(Test, SyncPoints, AsyncPoints, Num);
+	Test.TestTrue(TEXT("Lidars hit something"), NumValid > 0);
+	Test.TestTrue(TEXT("Lidars miss something"), NumValid < Num);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLidarLineTraceQueryModeTest, "AGXUnreal.Game.AGX_LidarSensorLineTrace.QueryMode",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLidarLineTraceQueryModeTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FLidarQueryModeState> State = MakeShared<FLidarQueryModeState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FBuildLidarQueryModeCommand(State, *this))
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLidarQueryModeCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
+
+///
+/// Lidar Line Trace range culling test starts here.
+///
+/// Two Lidars at the same location, one culling rays against the objects within range and one
+/// tracing every ray, scan a scene with one box within range, one box reaching out of range and
+/// one box entirely out of range. Culling must not remove any hit within range, and neither Lidar
+/// may see anything out of range.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FLidarRangeCullState
+{
+	UAGX_LidarSensorLineTraceComponent* CullLidar {nullptr};
+	UAGX_LidarSensorLineTraceComponent* NoCullLidar {nullptr};
+	UStaticMeshComponent* NearBox {nullptr};
+	UStaticMeshComponent* StraddlingBox {nullptr};
+	UStaticMeshComponent* FarBox {nullptr};
+	TSharedPtr<TArray<FAGX_LidarScanPoint>> CullPoints {MakeShared<TArray<FAGX_LidarScanPoint>>()};
+	TSharedPtr<TArray<FAGX_LidarScanPoint>> NoCullPoints {
+		MakeShared<TArray<FAGX_LidarScanPoint>>()};
+	double ScanTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FBuildLidarRangeCullCommand, TSharedPtr<FLidarRangeCullState>, State, FAutomationTestBase&,
+	Test);
+
+bool FBuildLidarRangeCullCommand::Update()
+{
+	using namespace AGX_LidarSensorLineTraceTest_helpers;
+	check(State != nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+
+	// Give the new boxes a few frames to reach the scene query structures.
+	State->ScanTimeStamp = Simulation->GetTimeStamp() + 0.1;
+
+	AActor* Actor = SpawnActorWithRoot(*World, TEXT("Lidar Range Cull Actor"));
+
+	// Left of the center, well within range.
+	State->NearBox = CreateBox(
+		*Actor, TEXT("Near Box"), FVector(500.0, -100.0, 0.0), FVector(100.0, 200.0, 200.0));
+
+	// Right of the center, with the near face within range and the bounding sphere center out of
+	// range.
+	State->StraddlingBox = CreateBox(
+		*Actor, TEXT("Straddling Box"), FVector(LidarRange, 400.0, 0.0),
+		FVector(1000.0, 200.0, 200.0));
+
+	// Straight ahead, just out of range.
+	State->FarBox = CreateBox(
+		*Actor, TEXT("Far Box"), FVector(LidarRange + 100.0, 0.0, 0.0),
+		FVector(100.0, 200.0, 200.0));
+
+	if (!Test.TestNotNull(TEXT("Near Box"), State->NearBox) ||
+		!Test.TestNotNull(TEXT("Straddling Box"), State->StraddlingBox) ||
+		!Test.TestNotNull(TEXT("Far Box"), State->FarBox))
+		return true;
+
+	auto ConfigureLidar = [](bool bCull)
+	{
+		return [bCull](UAGX_LidarSensorLineTraceComponent& Lidar)
+		{
+			Lidar.ExecutionMode = EAGX_LidarLineTraceExecutonMode::Manual;
+			Lidar.bCullAgainstRangeSphere = bCull;
+		};
+	};
+	State->CullLidar = CreateLidar(*Actor, TEXT("Cull Lidar"), ConfigureLidar(true));
+	State->NoCullLidar = CreateLidar(*Actor, TEXT("No Cull Lidar"), ConfigureLidar(false));
+	CollectPoints(*State->CullLidar, State->CullPoints);
+	CollectPoints(*State->NoCullLidar, State->NoCullPoints);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FScanLidarRangeCullCommand, TSharedPtr<FLidarRangeCullState>, State);
+
+bool FScanLidarRangeCullCommand::Update()
+{
+	if (State->CullLidar == nullptr || State->NoCullLidar == nullptr)
+		return true;
+
+	// Manual scans are synchronous and output the whole scan cycle right away.
+	State->CullLidar->RequestManualScan(0.0, 1.0, FVector2D::ZeroVector, FVector2D::ZeroVector);
+	State->NoCullLidar->RequestManualScan(0.0, 1.0, FVector2D::ZeroVector, FVector2D::ZeroVector);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckLidarRangeCullCommand, TSharedPtr<FLidarRangeCullState>, State, FAutomationTestBase&,
+	Test);
+
+bool FCheckLidarRangeCullCommand::Update()
+{
+	using namespace AGX_LidarSensorLineTraceTest_helpers;
+	if (State->CullLidar == nullptr || State->NoCullLidar == nullptr)
+		return true;
+
+	const TArray<FAGX_LidarScanPoint>& CullPoints = *State->CullPoints;
+	const TArray<FAGX_LidarScanPoint>& NoCullPoints = *State->NoCullPoints;
+	if (!Test.TestEqual(TEXT("Num culled points"), CullPoints.Num(), NumRaysCycle) ||
+		!Test.TestEqual(TEXT("Num not culled points"), NoCullPoints.Num(), NumRaysCycle))
+		return true;
+
+	// Culling only skips rays that cannot hit anything, so every hit must remain.
+	TestSamePoints(Test, NoCullPoints, CullPoints, NumRaysCycle);
+
+	Test.TestTrue(
+		TEXT("Near box is hit"), GetNumPointsInside(CullPoints, *State->NearBox) > 0);
+	Test.TestTrue(
+		TEXT("Straddling box is hit"), GetNumPointsInside(CullPoints, *State->StraddlingBox) > 0);
+	Test.TestEqual(
+		TEXT("Far box is not hit"), GetNumPointsInside(CullPoints, *State->FarBox), 0);
+
+	for (const FAGX_LidarScanPoint& Point : CullPoints)
+	{
+		if (Point.bIsValid && Point.Position.Size() > LidarRange + 1.0)
+		{
+			Test.AddError(FString::Printf(
+				TEXT("Point %s is out of range."), *Point.Position.ToString()));
+			break;
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLidarLineTraceRangeCullTest, "AGXUnreal.Game.AGX_LidarSensorLineTrace.RangeCull",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLidarLineTraceRangeCullTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FLidarRangeCullState> State = MakeShared<FLidarRangeCullState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FBuildLidarRangeCullCommand(State, *this))
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->ScanTimeStamp));
+	ADD_LATENT_AUTOMATION_COMMAND(FScanLidarRangeCullCommand(State));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLidarRangeCullCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
@@ -6,6 +6,7 @@
 #include "Utilities/AGX_MeshUtilities.h"
 
 // Unreal Engine includes.
+#include "Engine/StaticMesh.h"
 #include "Tests/AutomationCommon.h"
 #include "Misc/AutomationTest.h"
 
@@ -158,3 +159,142 @@ bool FAGX_MeshUtilitiesTest::RunTest(const FString&)
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_MeshUtilitiesCollisionDataTest, "AGXUnreal.Editor.AGX_MeshUtilities.CollisionData",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_MeshUtilitiesCollisionDataTest::RunTest(const FString&)
+{
+	const UStaticMesh* Cube =
+		LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Cube mesh"), Cube))
+		return false;
+
+	AGX_MeshUtilities::ClearStaticMeshCollisionDataCache();
+	const AGX_MeshUtilities::FCollisionMeshDataPtr First =
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Cube, 0);
+	const AGX_MeshUtilities::FCollisionMeshDataPtr Second =
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Cube, 0);
+	if (!TestTrue(TEXT("Collision data created"), First.IsValid()))
+		return false;
+	TestTrue(TEXT("Collision data is shared"), First == Second);
+
+	// The render mesh of the cube has split vertices at the corners, the collision mesh has not.
+	TestEqual(TEXT("Number of merged vertices"), First->Vertices.Num(), 8);
+	TestEqual(TEXT("Number of triangles"), First->Indices.Num(), 12);
+
+	// The transformed variant must apply the transform, including scale, on top of the shared
+	// data.
+	const FTransform Transform(
+		FQuat(FVector::UpVector, 0.5), FVector(100.0, 200.0, 300.0), FVector(2.0, 3.0, 4.0));
+	TArray<FVector> Vertices;
+	TArray<FTriIndices> Indices;
+	TestTrue(
+		TEXT("Transformed collision data"),
+		AGX_MeshUtilities::GetStaticMeshCollisionData(
+			FAGX_MeshWithTransform(Cube, Transform), FTransform::Identity, Vertices, Indices));
+	if (TestEqual(TEXT("Number of transformed vertices"), Vertices.Num(), First->Vertices.Num()))
+	{
+		for (int32 I = 0; I < Vertices.Num(); ++I)
+		{
+			TestEqual(
+				TEXT("Transformed vertex"), Vertices[I],
+				Transform.TransformPosition(FVector(First->Vertices[I])));
+		}
+	}
+	TestEqual(TEXT("Number of transformed triangles"), Indices.Num(), First->Indices.Num());
+
+	// Clearing the cache must not invalidate data already handed out.
+	AGX_MeshUtilities::ClearStaticMeshCollisionDataCache();
+	const AGX_MeshUtilities::FCollisionMeshDataPtr Third =
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Cube, 0);
+	TestTrue(TEXT("Cleared cache creates new data"), Third.IsValid() && Third != First);
+	TestEqual(TEXT("Old data still valid"), First->Vertices.Num(), 8);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_MeshUtilitiesCollisionDataRebuildTest,
+	"AGXUnreal.Editor.AGX_MeshUtilities.CollisionDataRebuild",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_MeshUtilitiesCollisionDataRebuildTest::RunTest(const FString&)
+{
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	UStaticMesh* Plane = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
+	if (!TestNotNull(TEXT("Cube mesh"), Cube) || !TestNotNull(TEXT("Plane mesh"), Plane))
+		return false;
+
+	// A Static Mesh that is rebuilt with other content must not get the cached collision data of
+	// its previous content, even if the new render data happens to be at the same address.
+	UStaticMesh* Mesh = NewObject<UStaticMesh>(GetTransientPackage());
+	AGX_MeshUtilities::CopyStaticMesh(Cube, Mesh);
+	const AGX_MeshUtilities::FCollisionMeshDataPtr CubeData =
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Mesh, 0);
+	if (!TestTrue(TEXT("Cube collision data created"), CubeData.IsValid()))
+		return false;
+	TestEqual(TEXT("Number of cube vertices"), CubeData->Vertices.Num(), 8);
+
+	AGX_MeshUtilities::CopyStaticMesh(Plane, Mesh);
+	const AGX_MeshUtilities::FCollisionMeshDataPtr PlaneData =
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Mesh, 0);
+	if (!TestTrue(TEXT("Plane collision data created"), PlaneData.IsValid()))
+		return false;
+	TestTrue(TEXT("Rebuilt mesh creates new data"), PlaneData != CubeData);
+	TestEqual(TEXT("Number of plane vertices"), PlaneData->Vertices.Num(), 4);
+	TestEqual(TEXT("Number of plane triangles"), PlaneData->Indices.Num(), 2);
+	TestTrue(
+		TEXT("Rebuilt mesh data is shared"),
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Mesh, 0) == PlaneData);
+
+	// Invalidating a mesh whose content is unchanged keeps the data.
+	AGX_MeshUtilities::InvalidateStaticMeshCollisionData(*Mesh);
+	TestTrue(
+		TEXT("Invalidated mesh with unchanged content keeps data"),
+		AGX_MeshUtilities::GetStaticMeshCollisionData(*Mesh, 0) == PlaneData);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_MeshUtilitiesContentHashTest, "AGXUnreal.Editor.AGX_MeshUtilities.ContentHash",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_MeshUtilitiesContentHashTest::RunTest(const FString&)
+{
+	const TArray<FVector> Positions {
+		FVector(0.0, 0.0, 0.0), FVector(100.0, 0.0, 0.0), FVector(0.0, 100.0, 0.0)};
+	const TArray<uint32> Indices {0, 1, 2};
+	const TArray<FVector> Normals {FVector::UpVector};
+	const TArray<FVector2D> UVs {FVector2D(0.0, 0.0), FVector2D(1.0, 0.0), FVector2D(0.0, 1.0)};
+
+	const FString Hash =
+		AGX_MeshUtilities::ComputeMeshContentHash(Positions, Indices, Normals, UVs);
+	TestFalse(TEXT("Hash is not empty"), Hash.IsEmpty());
+
+	// Floating-point noise must not change the hash.
+	TArray<FVector> NoisyPositions = Positions;
+	NoisyPositions[1].X += 1e-6;
+	NoisyPositions[2].Y -= 1e-6;
+	TestEqual(
+		TEXT("Noise does not change the hash"),
+		AGX_MeshUtilities::ComputeMeshContentHash(NoisyPositions, Indices, Normals, UVs), Hash);
+
+	// A real difference in any of the arrays must change the hash.
+	TArray<FVector> MovedPositions = Positions;
+	MovedPositions[1].X += 1.0;
+	TestNotEqual(
+		TEXT("Moved vertex changes the hash"),
+		AGX_MeshUtilities::ComputeMeshContentHash(MovedPositions, Indices, Normals, UVs), Hash);
+	const TArray<uint32> FlippedIndices {0, 2, 1};
+	TestNotEqual(
+		TEXT("Flipped triangle changes the hash"),
+		AGX_MeshUtilities::ComputeMeshContentHash(Positions, FlippedIndices, Normals, UVs), Hash);
+	TestNotEqual(
+		TEXT("Missing UVs changes the hash"),
+		AGX_MeshUtilities::ComputeMeshContentHash(Positions, Indices, Normals, {}), Hash);
+
+	return true;
+}
@@ -0,0 +1,149 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Terrain/AGX_ParticleDataSubscriptions.h"
+
+// Unreal Engine includes.
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+	FAGX_ParticleDataSubscriptionsSpec, "AGXUnreal.Spec.ParticleDataSubscriptions",
+	AgxAutomationCommon::DefaultTestFlags)
+END_DEFINE_SPEC(FAGX_ParticleDataSubscriptionsSpec)
+
+void FAGX_ParticleDataSubscriptionsSpec::Define()
+{
+	// Records the calls made to a subscription callback.
+	struct FCallbackRecord
+	{
+		int32 NumCalls {0};
+		int32 NumPositions {0};
+	};
+
+	auto MakeCallback = [](TSharedRef<FCallbackRecord> Record)
+	{
+		return FAGX_ParticleDataCallback::CreateLambda(
+			[Record](const FParticleDataById& ParticleData)
+			{
+				++Record->NumCalls;
+				Record->NumPositions = ParticleData.Positions.Num();
+			});
+	};
+
+	Describe(
+		"When subscriptions are due",
+		[this, MakeCallback]()
+		{
+			It("should fetch only the union of the fields of the due subscriptions",
+			   [this, MakeCallback]()
+			   {
+				   FAGX_ParticleDataSubscriptions Subscriptions;
+				   TSharedRef<FCallbackRecord> Record = MakeShared<FCallbackRecord>();
+				   Subscriptions.Add(EParticleDataFlags::Positions, 0.0, MakeCallback(Record));
+				   Subscriptions.Add(
+					   EParticleDataFlags::Velocities | EParticleDataFlags::Masses, 0.0,
+					   MakeCallback(Record));
+				   // Due at time 0 only, so not part of the second update.
+				   Subscriptions.Add(EParticleDataFlags::Radii, 10.0, MakeCallback(Record));
+
+				   EParticleDataFlags Fetched = static_cast<EParticleDataFlags>(0);
+				   auto Fetch = [&Fetched](EParticleDataFlags Fields, FParticleDataById&)
+				   { Fetched = Fields; };
+
+				   Subscriptions.Update(0.0, Fetch);
+				   TestEqual(
+					   TEXT("Fields at time 0"), static_cast<int32>(Fetched),
+					   static_cast<int32>(
+						   EParticleDataFlags::Positions | EParticleDataFlags::Velocities |
+						   EParticleDataFlags::Masses | EParticleDataFlags::Radii));
+
+				   Subscriptions.Update(1.0, Fetch);
+				   TestEqual(
+					   TEXT("Fields at time 1"), static_cast<int32>(Fetched),
+					   static_cast<int32>(
+						   EParticleDataFlags::Positions | EParticleDataFlags::Velocities |
+						   EParticleDataFlags::Masses));
+			   });
+
+			It("should call the callbacks with the fetched particle data",
+			   [this, MakeCallback]()
+			   {
+				   FAGX_ParticleDataSubscriptions Subscriptions;
+				   TSharedRef<FCallbackRecord> Record = MakeShared<FCallbackRecord>();
+				   Subscriptions.Add(EParticleDataFlags::Positions, 0.0, MakeCallback(Record));
+
+				   int32 NumFetches = 0;
+				   Subscriptions.Update(
+					   0.0,
+					   [&NumFetches](EParticleDataFlags, FParticleDataById& ParticleData)
+					   {
+						   ++NumFetches;
+						   ParticleData.Positions.Init(FVector::ZeroVector, 3);
+						   ParticleData.Exists.Init(true, 3);
+					   });
+
+				   TestEqual(TEXT("Number of fetches"), NumFetches, 1);
+				   TestEqual(TEXT("Number of calls"), Record->NumCalls, 1);
+				   TestEqual(TEXT("Number of positions"), Record->NumPositions, 3);
+			   });
+		});
+
+	Describe(
+		"When no subscription is due",
+		[this, MakeCallback]()
+		{
+			It("should neither fetch nor call any callback",
+			   [this, MakeCallback]()
+			   {
+				   FAGX_ParticleDataSubscriptions Subscriptions;
+				   TSharedRef<FCallbackRecord> Record = MakeShared<FCallbackRecord>();
+				   Subscriptions.Add(EParticleDataFlags::Positions, 1.0, MakeCallback(Record));
+
+				   int32 NumFetches = 0;
+				   auto Fetch = [&NumFetches](EParticleDataFlags, FParticleDataById&)
+				   { ++NumFetches; };
+				   Subscriptions.Update(0.0, Fetch);
+				   Subscriptions.Update(0.5, Fetch);
+
+				   TestEqual(TEXT("Number of fetches"), NumFetches, 1);
+				   TestEqual(TEXT("Number of calls"), Record->NumCalls, 1);
+
+				   Subscriptions.Update(1.0, Fetch);
+				   TestEqual(TEXT("Number of calls once due again"), Record->NumCalls, 2);
+			   });
+		});
+
+	Describe(
+		"When a subscription is removed",
+		[this, MakeCallback]()
+		{
+			It("should no longer call its callback",
+			   [this, MakeCallback]()
+			   {
+				   FAGX_ParticleDataSubscriptions Subscriptions;
+				   TSharedRef<FCallbackRecord> Removed = MakeShared<FCallbackRecord>();
+				   TSharedRef<FCallbackRecord> Kept = MakeShared<FCallbackRecord>();
+				   const int32 RemovedId = Subscriptions.Add(
+					   EParticleDataFlags::Positions, 0.0, MakeCallback(Removed));
+				   const int32 KeptId =
+					   Subscriptions.Add(EParticleDataFlags::Masses, 0.0, MakeCallback(Kept));
+
+				   EParticleDataFlags Fetched = static_cast<EParticleDataFlags>(0);
+				   auto Fetch = [&Fetched](EParticleDataFlags Fields, FParticleDataById&)
+				   { Fetched = Fields; };
+
+				   Subscriptions.Remove(RemovedId);
+				   Subscriptions.Update(0.0, Fetch);
+				   TestEqual(TEXT("Removed calls"), Removed->NumCalls, 0);
+				   TestEqual(TEXT("Kept calls"), Kept->NumCalls, 1);
+				   TestEqual(
+					   TEXT("Removed fields not fetched"), static_cast<int32>(Fetched),
+					   static_cast<int32>(EParticleDataFlags::Masses));
+				   TestFalse(TEXT("Not empty"), Subscriptions.IsEmpty());
+
+				   Subscriptions.Remove(KeptId);
+				   TestTrue(TEXT("Empty"), Subscriptions.IsEmpty());
+			   });
+		});
+}
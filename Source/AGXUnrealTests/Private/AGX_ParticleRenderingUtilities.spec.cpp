@@ -0,0 +1,135 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Terrain/ParticleRendering/AGX_ParticleRenderingUtilities.h"
+#include "Terrain/ParticleRendering/AGX_UpsamplingParticleRendererComponent.h"
+#include "Terrain/ParticleRendering/ParticleUpsamplingDataHandler.h"
+
+// Unreal Engine includes.
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+	FAGX_ParticleRenderingUtilitiesSpec, "AGXUnreal.Spec.ParticleRenderingUtilities",
+	AgxAutomationCommon::DefaultTestFlags)
+END_DEFINE_SPEC(FAGX_ParticleRenderingUtilitiesSpec)
+
+namespace AGX_ParticleRenderingUtilitiesSpec_helpers
+{
+	/**
+	 * The serial voxel activation that Get Active Voxels replaced, used as the reference
+	 * implementation.
+	 */
+	void AppendIfActiveVoxel(
+		TSet<FIntVector>& ActiveVoxelIndices, FVector Position, float Radius, float SizeOfVoxel)
+	{
+		float AABBRadius = VOLUME_MOD * Radius / 2;
+		FVector VSPosition = Position / SizeOfVoxel;
+
+		FVector OffsetPosition(
+			FMath::Sign(VSPosition.X), FMath::Sign(VSPosition.Y), FMath::Sign(VSPosition.Z));
+
+		OffsetPosition *= 0.5;
+		OffsetPosition += VSPosition;
+
+		FVector VSParticleVoxelPos(
+			(double) (int) OffsetPosition.X, (double) (int) OffsetPosition.Y,
+			(double) (int) OffsetPosition.Z);
+
+		int n = (int) (AABBRadius / SizeOfVoxel + 1);
+		for (int x = -n; x <= n; x++)
+		{
+			for (int y = -n; y <= n; y++)
+			{
+				for (int z = -n; z <= n; z++)
+				{
+					FVector VSVoxelPos = VSParticleVoxelPos + FVector(x, y, z);
+					FVector VSVoxelToParticle = VSPosition - VSVoxelPos;
+
+					FVector VSToEdge = FVector::Max(VSVoxelToParticle, -VSVoxelToParticle) -
+									   AABBRadius / SizeOfVoxel;
+					FVector VSVoxelSize2(0.5);
+					if (FVector::Max(VSToEdge, VSVoxelSize2) == VSVoxelSize2)
+					{
+						VSVoxelPos += FVector(
+										  FMath::Sign(VSVoxelPos.X), FMath::Sign(VSVoxelPos.Y),
+										  FMath::Sign(VSVoxelPos.Z)) *
+									  0.5;
+						ActiveVoxelIndices.Add(FIntVector(VSVoxelPos));
+					}
+				}
+			}
+		}
+	}
+
+	TArray<FCoarseParticle> CreateParticles(int32 NumParticles, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FCoarseParticle> Particles;
+		Particles.SetNum(NumParticles);
+		for (FCoarseParticle& Particle : Particles)
+		{
+			// A pile of particles straddling the origin, so that all sign cases are covered.
+			const FVector Position = Random.GetUnitVector() * Random.FRandRange(0.0f, 500.0f);
+			const float Radius = Random.FRandRange(1.0f, 15.0f);
+			Particle.PositionAndRadius = FVector4f(FVector3f(Position), Radius);
+			Particle.VelocityAndMass = FVector4f(0.0f, 0.0f, 0.0f, 1.0f);
+		}
+		return Particles;
+	}
+}
+
+void FAGX_ParticleRenderingUtilitiesSpec::Define()
+{
+	using namespace AGX_ParticleRenderingUtilitiesSpec_helpers;
+
+	Describe(
+		"When getting the active voxels of coarse particles",
+		[this]()
+		{
+			It("should produce the same voxels as the serial implementation",
+			   [this]()
+			   {
+				   const float VoxelSize = 10.0f;
+				   const TArray<FCoarseParticle> Particles = CreateParticles(10000, 42);
+
+				   TSet<FIntVector> Expected;
+				   for (const FCoarseParticle& Particle : Particles)
+				   {
+					   AppendIfActiveVoxel(
+						   Expected, FVector(Particle.PositionAndRadius),
+						   Particle.PositionAndRadius.W, VoxelSize);
+				   }
+
+				   FAGX_ActiveVoxelsBuffers Buffers;
+				   TArray<FIntVector4> Actual;
+				   AGX_ParticleRenderingUtilities::GetActiveVoxels(
+					   Particles, VoxelSize, Buffers, Actual);
+
+				   TestEqual(TEXT("Number of active voxels"), Actual.Num(), Expected.Num());
+				   TSet<FIntVector> ActualSet;
+				   for (const FIntVector4& Voxel : Actual)
+				   {
+					   const FIntVector Index(Voxel.X, Voxel.Y, Voxel.Z);
+					   TestFalse(TEXT("Voxel is unique"), ActualSet.Contains(Index));
+					   TestTrue(TEXT("Voxel is expected"), Expected.Contains(Index));
+					   ActualSet.Add(Index);
+				   }
+			   });
+
+			It("should not keep voxels from a previous call when reusing buffers",
+			   [this]()
+			   {
+				   const TArray<FCoarseParticle> Particles = CreateParticles(5000, 1);
+				   const TArray<FCoarseParticle> NoParticles;
+				   FAGX_ActiveVoxelsBuffers Buffers;
+				   TArray<FIntVector4> Voxels;
+				   AGX_ParticleRenderingUtilities::GetActiveVoxels(
+					   Particles, 10.0f, Buffers, Voxels);
+				   AGX_ParticleRenderingUtilities::GetActiveVoxels(
+					   NoParticles, 10.0f, Buffers, Voxels);
+				   TestEqual(TEXT("Number of active voxels"), Voxels.Num(), 0);
+			   });
+		});
+}
@@ -0,0 +1,294 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains the Play In Editor stepping performance benchmarks.
+ *
+ * Unlike the benchmarks in AGX_StepBenchmark.cpp, which step Barriers directly, these build the
+ * scene from Components in a Play In Editor world and let the AGX Simulation step it from the game
+ * loop. The measured time therefore includes the Component synchronization before and after each
+ * step, and everything else the engine does during a frame. They are run with
+ *
+ *   UnrealEditor-Cmd <project> -ExecCmds="Automation RunTests AGXUnreal.Benchmark.PlayInEditor;
+ *     Quit" -Unattended
+ *
+ * and take the same -AGXBenchmark* command line parameters, and write and compare their JSON
+ * results the same way, as the benchmarks in AGX_StepBenchmark.cpp. The result files are named
+ * PlayInEditor<Scene>.json.
+ *
+ * The AGX Dynamics per-phase timings are read from the statistics history of the AGX Simulation,
+ * so they are only reported if Enable Statistics is set in Project Settings > Plugins > AGX
+ * Dynamics.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_BenchmarkUtils.h"
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_RigidBodyComponent.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "Shapes/AGX_BoxShapeComponent.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+// State owned by the benchmark and carried between latent command invocations.
+struct FPlayInEditorBenchmarkState
+{
+	AActor* Actor {nullptr};
+	TMap<FString, int32> Sizes;
+	int32 NumSteps {0};
+	double WarmupEndTimeStamp {-1.0};
+	double EndTimeStamp {-1.0};
+	double StartTime {0.0};
+	uint64 StartFrame {0};
+
+	// Simulation settings changed by the benchmark, restored when done.
+	TEnumAsByte<EAGX_StepMode> OriginalStepMode {SmDropImmediately};
+	bool bOriginalStatisticsHistory {false};
+	int32 OriginalStatisticsHistorySize {0};
+	int32 OriginalStatisticsSamplingPeriod {0};
+};
+
+namespace AGX_PlayInEditorBenchmark_helpers
+{
+	const TCHAR* WallClockKey = TEXT("WallClockFrameTime");
+
+	UAGX_RigidBodyComponent& CreateBox(
+		FPlayInEditorBenchmarkState& State, USceneComponent& Parent, const FVector& Location,
+		const FVector& HalfExtent)
+	{
+		UAGX_RigidBodyComponent* Body = NewObject<UAGX_RigidBodyComponent>(State.Actor);
+		Body->Mobility = EComponentMobility::Movable;
+		Body->SetupAttachment(&Parent);
+		Body->SetRelativeLocation(Location);
+		State.Actor->AddInstanceComponent(Body);
+		Body->RegisterComponent();
+
+		UAGX_BoxShapeComponent* Box = NewObject<UAGX_BoxShapeComponent>(State.Actor);
+		Box->SetHalfExtent(HalfExtent);
+		Box->SetupAttachment(Body);
+		State.Actor->AddInstanceComponent(Box);
+		Box->RegisterComponent();
+		return *Body;
+	}
+
+	// The ground is a Shape without a Rigid Body.
+	void CreateGround(FPlayInEditorBenchmarkState& State, USceneComponent& Parent, double HalfSize)
+	{
+		UAGX_BoxShapeComponent* Ground = NewObject<UAGX_BoxShapeComponent>(State.Actor);
+		Ground->SetHalfExtent(FVector(HalfSize, HalfSize, 10.0));
+		Ground->SetupAttachment(&Parent);
+		Ground->SetRelativeLocation(FVector(0.0, 0.0, -10.0));
+		State.Actor->AddInstanceComponent(Ground);
+		Ground->RegisterComponent();
+	}
+
+	// The same scene as the Bodies step benchmark. Size parameters: BodiesSide.
+	void BuildBodies(FPlayInEditorBenchmarkState& State, USceneComponent& Root)
+	{
+		const int32 Side = AGX_BenchmarkUtils::GetSize(State.Sizes, TEXT("BodiesSide"), 32);
+		constexpr double Spacing = 150.0;
+		CreateGround(State, Root, Side * Spacing);
+		for (int32 X = 0; X < Side; ++X)
+		{
+			for (int32 Y = 0; Y < Side; ++Y)
+			{
+				const FVector Location(
+					(X - Side / 2) * Spacing, (Y - Side / 2) * Spacing, 100.0 + (X + Y) % 7 * 20.0);
+				CreateBox(State, Root, Location, FVector(25.0));
+			}
+		}
+	}
+
+	// The same scene as the BoxStack step benchmark. Size parameters: NumStacks, StackHeight.
+	void BuildBoxStack(FPlayInEditorBenchmarkState& State, USceneComponent& Root)
+	{
+		const int32 NumStacks = AGX_BenchmarkUtils::GetSize(State.Sizes, TEXT("NumStacks"), 10);
+		const int32 StackHeight =
+			AGX_BenchmarkUtils::GetSize(State.Sizes, TEXT("StackHeight"), 10);
+		CreateGround(State, Root, FMath::Max(2000.0, (NumStacks / 5 + 1) * 200.0));
+		for (int32 Stack = 0; Stack < NumStacks; ++Stack)
+		{
+			for (int32 Level = 0; Level < StackHeight; ++Level)
+			{
+				const FVector Location(
+					(Stack % 5) * 200.0, (Stack / 5) * 200.0, 50.0 + Level * 100.0);
+				CreateBox(State, Root, Location, FVector(50.0));
+			}
+		}
+	}
+
+	using FBuildFunction = void (*)(FPlayInEditorBenchmarkState&, USceneComponent&);
+
+	struct FBenchmarkDefinition
+	{
+		const TCHAR* Name;
+		FBuildFunction Build;
+	};
+
+	const FBenchmarkDefinition Benchmarks[] = {
+		{TEXT("Bodies"), &BuildBodies}, {TEXT("BoxStack"), &BuildBoxStack}};
+
+	UAGX_Simulation* GetPIESimulation()
+	{
+		check(GEditor != nullptr);
+		check(GEditor->GetPIEWorldContext() != nullptr);
+		check(GEditor->GetPIEWorldContext()->World() != nullptr);
+		return UAGX_Simulation::GetFrom(GEditor->GetPIEWorldContext()->World());
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FBuildBenchmarkSceneCommand, TSharedPtr<FPlayInEditorBenchmarkState>, State,
+	AGX_PlayInEditorBenchmark_helpers::FBuildFunction, Build);
+
+bool FBuildBenchmarkSceneCommand::Update()
+{
+	using namespace AGX_PlayInEditorBenchmark_helpers;
+	check(State != nullptr);
+	check(State->Actor == nullptr);
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = GetPIESimulation();
+
+	// Drop Immediately takes at most one step per frame, so the frame time is the time per step.
+	// Every step is recorded in the statistics history.
+	State->OriginalStepMode = Simulation->StepMode;
+	State->bOriginalStatisticsHistory = Simulation->bEnableStatisticsHistory;
+	State->OriginalStatisticsHistorySize = Simulation->StatisticsHistorySize;
+	State->OriginalStatisticsSamplingPeriod = Simulation->StatisticsSamplingPeriod;
+	Simulation->StepMode = SmDropImmediately;
+	Simulation->bEnableStatisticsHistory = true;
+	Simulation->StatisticsHistorySize = State->NumSteps;
+	Simulation->StatisticsSamplingPeriod = 1;
+
+	// Spawn the Actor.
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = FName(TEXT("Benchmark Actor"));
+	State->Actor = World->SpawnActor<AActor>(SpawnParameters);
+	USceneComponent* RootComponent = NewObject<USceneComponent>(
+		State->Actor, USceneComponent::GetDefaultSceneRootVariableName());
+	State->Actor->SetRootComponent(RootComponent);
+	State->Actor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	Build(*State, *RootComponent);
+
+	State->WarmupEndTimeStamp = Simulation->GetTimeStamp() +
+								AGX_BenchmarkUtils::NumWarmupSteps * Simulation->TimeStep;
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FStartMeasurementCommand, TSharedPtr<FPlayInEditorBenchmarkState>, State);
+
+bool FStartMeasurementCommand::Update()
+{
+	using namespace AGX_PlayInEditorBenchmark_helpers;
+	UAGX_Simulation* Simulation = GetPIESimulation();
+	Simulation->WaitForStepForward();
+	Simulation->ClearStatisticsHistory();
+
+	// Half a step short of the last step so that rounding in the time stamp doesn't matter.
+	State->EndTimeStamp =
+		Simulation->GetTimeStamp() + (State->NumSteps - 0.5) * Simulation->TimeStep;
+	State->StartFrame = GFrameCounter;
+	State->StartTime = FPlatformTime::Seconds();
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(
+	FReportBenchmarkCommand, TSharedPtr<FPlayInEditorBenchmarkState>, State, FString, SceneName,
+	FAutomationTestBase&, Test);
+
+bool FReportBenchmarkCommand::Update()
+{
+	using namespace AGX_PlayInEditorBenchmark_helpers;
+	UAGX_Simulation* Simulation = GetPIESimulation();
+	Simulation->WaitForStepForward();
+	const double EndTime = FPlatformTime::Seconds();
+	const uint64 NumFrames = FMath::Max<uint64>(GFrameCounter - State->StartFrame, 1);
+
+	AGX_BenchmarkUtils::FTimingAccumulator Accumulator;
+	Accumulator.Add(WallClockKey, (EndTime - State->StartTime) * 1000.0 / NumFrames);
+	for (const FAGX_StatisticsSample& Sample : Simulation->GetStatisticsHistory())
+	{
+		Accumulator.AddStatistics(Sample.Statistics);
+	}
+	if (!Simulation->bEnableStatistics)
+	{
+		Test.AddWarning(TEXT("Statistics are disabled, only the wall clock time is measured."));
+	}
+
+	AGX_BenchmarkUtils::ReportResult(
+		Test, SceneName, State->NumSteps, State->Sizes, Accumulator.GetMeans());
+
+	// Restore the original settings so that other tests are not affected.
+	Simulation->StepMode = State->OriginalStepMode;
+	Simulation->bEnableStatisticsHistory = State->bOriginalStatisticsHistory;
+	Simulation->StatisticsHistorySize = State->OriginalStatisticsHistorySize;
+	Simulation->StatisticsSamplingPeriod = State->OriginalStatisticsSamplingPeriod;
+	Simulation->ClearStatisticsHistory();
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FPlayInEditorBenchmark, "AGXUnreal.Benchmark.PlayInEditor",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FPlayInEditorBenchmark::GetTests(
+	TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	using namespace AGX_PlayInEditorBenchmark_helpers;
+	for (const FBenchmarkDefinition& Benchmark : Benchmarks)
+	{
+		OutBeautifiedNames.Add(Benchmark.Name);
+		OutTestCommands.Add(Benchmark.Name);
+	}
+}
+
+bool FPlayInEditorBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorBenchmark_helpers;
+	using namespace AGX_PlayInEditorUtils;
+
+	const FBenchmarkDefinition* Benchmark = nullptr;
+	for (const FBenchmarkDefinition& Candidate : Benchmarks)
+	{
+		if (Parameters == Candidate.Name)
+			Benchmark = &Candidate;
+	}
+	if (Benchmark == nullptr)
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark scene '%s'."), *Parameters));
+		return false;
+	}
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FPlayInEditorBenchmarkState> State = MakeShared<FPlayInEditorBenchmarkState>();
+	State->NumSteps = AGX_BenchmarkUtils::GetNumSteps();
+	const FString SceneName = FString::Printf(TEXT("PlayInEditor%s"), Benchmark->Name);
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FBuildBenchmarkSceneCommand(State, Benchmark->Build));
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->WarmupEndTimeStamp));
+
+	// Measure.
+	ADD_LATENT_AUTOMATION_COMMAND(FStartMeasurementCommand(State));
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+	ADD_LATENT_AUTOMATION_COMMAND(FReportBenchmarkCommand(State, SceneName, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
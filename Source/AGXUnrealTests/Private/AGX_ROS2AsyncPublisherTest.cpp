@@ -0,0 +1,110 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "ROS2/AGX_ROS2AsyncPublisher.h"
+
+// Unreal Engine includes.
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+
+/*
+ * These tests use plain functions instead of ROS2 Publisher Barriers, so that the queueing can be
+ * tested without any ROS2 communication.
+ */
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_ROS2AsyncPublisherOrderTest, "AGXUnreal.Editor.AGX_ROS2AsyncPublisher.Order",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_ROS2AsyncPublisherOrderTest::RunTest(const FString& Parameters)
+{
+	FCriticalSection Lock;
+	TArray<int32> PublishedA;
+	TArray<int32> PublishedB;
+
+	FAGX_ROS2AsyncPublisher Publisher(4, EAGX_ROS2QueueFullPolicy::Block);
+	for (int32 I = 0; I < 100; ++I)
+	{
+		Publisher.Enqueue(
+			0, TEXT("a"),
+			[&, I]()
+			{
+				FScopeLock ScopeLock(&Lock);
+				PublishedA.Add(I);
+				return true;
+			});
+		Publisher.Enqueue(
+			1, TEXT("b"),
+			[&, I]()
+			{
+				FScopeLock ScopeLock(&Lock);
+				PublishedB.Add(I);
+				return true;
+			});
+	}
+	Publisher.Flush();
+
+	FScopeLock ScopeLock(&Lock);
+	TestEqual(TEXT("All messages on topic a published"), PublishedA.Num(), 100);
+	TestEqual(TEXT("All messages on topic b published"), PublishedB.Num(), 100);
+	bool bInOrder = true;
+	for (int32 I = 0; I < FMath::Min(PublishedA.Num(), PublishedB.Num()); ++I)
+		bInOrder &= PublishedA[I] == I && PublishedB[I] == I;
+	TestTrue(TEXT("Messages published in order"), bInOrder);
+
+	const FAGX_ROS2PublisherStatistics Statistics = Publisher.GetStatistics(TEXT("a"));
+	TestEqual(TEXT("Published statistic"), Statistics.NumPublished, static_cast<int64>(100));
+	TestEqual(TEXT("Dropped statistic"), Statistics.NumDropped, static_cast<int64>(0));
+	TestEqual(TEXT("Queued statistic"), Statistics.NumQueued, 0);
+	TestTrue(TEXT("Max latency"), Statistics.MaxLatency >= Statistics.AverageLatency);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_ROS2AsyncPublisherDropOldestTest, "AGXUnreal.Editor.AGX_ROS2AsyncPublisher.DropOldest",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_ROS2AsyncPublisherDropOldestTest::RunTest(const FString& Parameters)
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+		return true;
+
+	FEvent* Started = FPlatformProcess::GetSynchEventFromPool(true);
+	FEvent* Release = FPlatformProcess::GetSynchEventFromPool(true);
+	const int32 Capacity = 4;
+	{
+		FAGX_ROS2AsyncPublisher Publisher(Capacity, EAGX_ROS2QueueFullPolicy::DropOldest);
+
+		// Keep the thread busy with the first message so that the following ones pile up.
+		Publisher.Enqueue(
+			0, TEXT("t"),
+			[Started, Release]()
+			{
+				Started->Trigger();
+				Release->Wait();
+				return true;
+			});
+		Started->Wait();
+
+		for (int32 I = 0; I < Capacity + 3; ++I)
+			Publisher.Enqueue(0, TEXT("t"), []() { return true; });
+
+		FAGX_ROS2PublisherStatistics Statistics = Publisher.GetStatistics(TEXT("t"));
+		TestEqual(TEXT("Oldest messages dropped"), Statistics.NumDropped, static_cast<int64>(3));
+		TestEqual(TEXT("Queue is full"), Statistics.NumQueued, Capacity);
+
+		Release->Trigger();
+		Publisher.Flush();
+		Statistics = Publisher.GetStatistics(TEXT("t"));
+		TestEqual(
+			TEXT("Kept messages published"), Statistics.NumPublished,
+			static_cast<int64>(Capacity + 1));
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(Started);
+	FPlatformProcess::ReturnSynchEventToPool(Release);
+	return true;
+}
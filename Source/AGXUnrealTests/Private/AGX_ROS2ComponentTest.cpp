@@ -0,0 +1,529 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains tests for the ROS2 Publisher and Subscriber Components. Messages are sent
+ * from a Publisher Component to a Subscriber Component in the same process, on the same Domain ID,
+ * so no external ROS2 node is needed.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "ROS2/AGX_ROS2Messages.h"
+#include "ROS2/AGX_ROS2PublisherComponent.h"
+#include "ROS2/AGX_ROS2SubscriberComponent.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+namespace AGX_ROS2ComponentTest_helpers
+{
+	// Not the default Domain ID, to stay clear of any other ROS2 nodes on the computer.
+	constexpr uint8 DomainID = 42;
+
+	// Reliable and Transient Local so that no message is lost while the Publisher and the
+	// Subscriber discover each other.
+	FAGX_ROS2Qos MakeLoopbackQos(int32 HistoryDepth)
+	{
+		FAGX_ROS2Qos Qos;
+		Qos.Reliability = EAGX_ROS2QosReliability::Reliable;
+		Qos.Durability = EAGX_ROS2QosDurability::TransientLocal;
+		Qos.History = EAGX_ROS2QosHistory::KeepLastHistoryQos;
+		Qos.HistoryDepth = HistoryDepth;
+		return Qos;
+	}
+
+	AActor* SpawnLoopbackActor(UWorld& World, const TCHAR* Name)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = FName(Name);
+		AActor* Actor = World.SpawnActor<AActor>(SpawnParameters);
+		USceneComponent* Root =
+			NewObject<USceneComponent>(Actor, USceneComponent::GetDefaultSceneRootVariableName());
+		Actor->SetRootComponent(Root);
+		Actor->AddInstanceComponent(Root);
+		Root->RegisterComponent();
+		return Actor;
+	}
+
+	template <typename ComponentType>
+	ComponentType* AddLoopbackComponent(AActor& Actor, const FName& Name, int32 HistoryDepth)
+	{
+		ComponentType* Component = NewObject<ComponentType>(&Actor, Name);
+		Component->Qos = MakeLoopbackQos(HistoryDepth);
+		Component->DomainID = DomainID;
+		Component->SetupAttachment(Actor.GetRootComponent());
+		Actor.AddInstanceComponent(Component);
+		Component->RegisterComponent();
+		return Component;
+	}
+}
+
+///
+/// Async loopback test starts here.
+///
+/// A Publisher Component with Publish Async sends a sequence of messages that are received by a
+/// Subscriber Component. The Actor is then destroyed while messages are still queued, to check that
+/// End Play stops the background thread before the Native Barriers it publishes through are
+/// destroyed.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FROS2AsyncLoopbackState
+{
+	static constexpr int32 NumMessages = 20;
+	const FString Topic {TEXT("agx_unreal_test_async_loopback")};
+
+	AActor* Actor {nullptr};
+	UAGX_ROS2PublisherComponent* Publisher {nullptr};
+	UAGX_ROS2SubscriberComponent* Subscriber {nullptr};
+	TArray<int32> Received;
+	double SendTimeStamp {-1.0};
+	double EndTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FSetupROS2AsyncLoopbackCommand, TSharedPtr<FROS2AsyncLoopbackState>, State,
+	FAutomationTestBase&, Test);
+
+bool FSetupROS2AsyncLoopbackCommand::Update()
+{
+	using namespace AGX_ROS2ComponentTest_helpers;
+	check(State != nullptr);
+	check(State->Actor == nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	State->SendTimeStamp = Simulation->GetTimeStamp() + 0.2;
+	State->EndTimeStamp = State->SendTimeStamp + 2.0;
+
+	const int32 HistoryDepth = FROS2AsyncLoopbackState::NumMessages;
+	State->Actor = SpawnLoopbackActor(*World, TEXT("ROS2 Async Loopback Actor"));
+	State->Publisher = AddLoopbackComponent<UAGX_ROS2PublisherComponent>(
+		*State->Actor, TEXT("Publisher"), HistoryDepth);
+	State->Publisher->bPublishAsync = true;
+	State->Publisher->AsyncQueueCapacity = HistoryDepth;
+	State->Publisher->QueueFullPolicy = EAGX_ROS2QueueFullPolicy::Block;
+	State->Subscriber = AddLoopbackComponent<UAGX_ROS2SubscriberComponent>(
+		*State->Actor, TEXT("Subscriber"), HistoryDepth);
+
+	// Create the Subscriber Barrier up front so that discovery can start before the first send.
+	FAGX_StdMsgsInt32 Message;
+	Test.TestFalse(
+		TEXT("Nothing received before the first send"),
+		State->Subscriber->ReceiveStdMsgsInt32(Message, State->Topic));
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FSendROS2AsyncLoopbackCommand, TSharedPtr<FROS2AsyncLoopbackState>, State,
+	FAutomationTestBase&, Test);
+
+bool FSendROS2AsyncLoopbackCommand::Update()
+{
+	if (State->Publisher == nullptr)
+		return true;
+
+	const int32 NumMessages = FROS2AsyncLoopbackState::NumMessages;
+	bool bAllSent = true;
+	for (int32 I = 0; I < NumMessages; ++I)
+	{
+		FAGX_StdMsgsInt32 Message;
+		Message.Data = I;
+		// Every other message is moved into the queue through the rvalue overload.
+		if (I % 2 == 0)
+			bAllSent &= State->Publisher->SendStdMsgsInt32(Message, State->Topic);
+		else
+			bAllSent &= State->Publisher->SendStdMsgsInt32(MoveTemp(Message), State->Topic);
+	}
+	Test.TestTrue(TEXT("All messages queued"), bAllSent);
+
+	State->Publisher->FlushAsyncQueue();
+	const FAGX_ROS2PublisherStatistics Statistics =
+		State->Publisher->GetTopicStatistics(State->Topic);
+	Test.TestEqual(
+		TEXT("Published statistic"), Statistics.NumPublished, static_cast<int64>(NumMessages));
+	Test.TestEqual(TEXT("Dropped statistic"), Statistics.NumDropped, static_cast<int64>(0));
+	Test.TestEqual(TEXT("Queued statistic"), Statistics.NumQueued, 0);
+	return true;
+}
+
+/**
+ * Receive messages every tick until all have been received or the end time stamp is reached.
+ */
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FReceiveROS2AsyncLoopbackCommand, TSharedPtr<FROS2AsyncLoopbackState>, State);
+
+bool FReceiveROS2AsyncLoopbackCommand::Update()
+{
+	if (State->Subscriber == nullptr)
+		return true;
+
+	FAGX_StdMsgsInt32 Message;
+	while (State->Subscriber->ReceiveStdMsgsInt32(Message, State->Topic))
+		State->Received.Add(Message.Data);
+
+	if (State->Received.Num() >= FROS2AsyncLoopbackState::NumMessages)
+		return true;
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	return UAGX_Simulation::GetFrom(World)->GetTimeStamp() >= State->EndTimeStamp;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckROS2AsyncLoopbackCommand, TSharedPtr<FROS2AsyncLoopbackState>, State,
+	FAutomationTestBase&, Test);
+
+bool FCheckROS2AsyncLoopbackCommand::Update()
+{
+	if (State->Actor == nullptr)
+		return true;
+
+	const int32 NumMessages = FROS2AsyncLoopbackState::NumMessages;
+	Test.TestEqual(TEXT("All messages received"), State->Received.Num(), NumMessages);
+	bool bInOrder = true;
+	for (int32 I = 0; I < State->Received.Num(); ++I)
+		bInOrder &= State->Received[I] == I;
+	Test.TestTrue(TEXT("Messages received in order"), bInOrder);
+
+	// Leave messages in the queue and destroy the Actor. End Play must stop the background thread
+	// before the Components, and the Native Barriers the queued messages refer to, are destroyed.
+	for (int32 I = 0; I < NumMessages; ++I)
+	{
+		FAGX_StdMsgsInt32 Message;
+		Message.Data = NumMessages + I;
+		State->Publisher->SendStdMsgsInt32(Message, State->Topic);
+	}
+	State->Actor->Destroy();
+
+	const FAGX_ROS2PublisherStatistics Statistics =
+		State->Publisher->GetTopicStatistics(State->Topic);
+	Test.TestEqual(
+		TEXT("No statistics after End Play"), Statistics.NumPublished, static_cast<int64>(0));
+
+	State->Actor = nullptr;
+	State->Publisher = nullptr;
+	State->Subscriber = nullptr;
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FROS2AsyncLoopbackTest, "AGXUnreal.Game.AGX_ROS2Component.AsyncLoopback",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FROS2AsyncLoopbackTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FROS2AsyncLoopbackState> State = MakeShared<FROS2AsyncLoopbackState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupROS2AsyncLoopbackCommand(State, *this))
+
+	// Give the Publisher and the Subscriber some time to discover each other.
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->SendTimeStamp));
+	ADD_LATENT_AUTOMATION_COMMAND(FSendROS2AsyncLoopbackCommand(State, *this));
+	ADD_LATENT_AUTOMATION_COMMAND(FReceiveROS2AsyncLoopbackCommand(State));
+
+	// Run the checks and shut down.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckROS2AsyncLoopbackCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
+
+///
+/// Topic Handle test starts here.
+///
+/// A Topic Handle is resolved on first use, reused while nothing changes, and resolved again when
+/// it is used with another Component, with another message type, or after its Topic is changed.
+///
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FCheckROS2TopicHandleCommand, FAutomationTestBase&, Test);
+
+bool FCheckROS2TopicHandleCommand::Update()
+{
+	using namespace AGX_ROS2ComponentTest_helpers;
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	AActor* Actor = SpawnLoopbackActor(*World, TEXT("ROS2 Topic Handle Actor"));
+	UAGX_ROS2PublisherComponent* PublisherA =
+		AddLoopbackComponent<UAGX_ROS2PublisherComponent>(*Actor, TEXT("PublisherA"), 1);
+	UAGX_ROS2PublisherComponent* PublisherB =
+		AddLoopbackComponent<UAGX_ROS2PublisherComponent>(*Actor, TEXT("PublisherB"), 1);
+	UAGX_ROS2SubscriberComponent* Subscriber =
+		AddLoopbackComponent<UAGX_ROS2SubscriberComponent>(*Actor, TEXT("Subscriber"), 1);
+
+	const FString TopicInt32 {TEXT("agx_unreal_test_handle_int32")};
+	const FString TopicOther {TEXT("agx_unreal_test_handle_other")};
+	FAGX_StdMsgsInt32 Int32Msg;
+	FAGX_StdMsgsFloat64 Float64Msg;
+	FAGX_ROS2TopicHandle Handle(TopicInt32);
+	Test.TestFalse(TEXT("Unresolved before first use"), Handle.IsResolved());
+
+	// Resolve.
+	Test.TestTrue(TEXT("Send resolves"), PublisherA->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestTrue(TEXT("Resolved after first use"), Handle.IsResolved());
+	Test.TestTrue(TEXT("Owner"), Handle.Owner.Get() == PublisherA);
+	Test.TestTrue(
+		TEXT("Message type"), Handle.MessageType == EAGX_ROS2MessageType::StdMsgsInt32);
+	Test.TestEqual(TEXT("Topic"), Handle.GetTopic(), TopicInt32);
+	const int32 IndexInt32 = Handle.Index;
+
+	// Reuse.
+	Test.TestTrue(TEXT("Send reuses"), PublisherA->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestEqual(TEXT("Reused index"), Handle.Index, IndexInt32);
+
+	// Re-resolve after the Topic has changed.
+	Handle.SetTopic(TopicOther);
+	Test.TestFalse(TEXT("Unresolved after Topic change"), Handle.IsResolved());
+	Test.TestTrue(
+		TEXT("Send after Topic change"), PublisherA->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestTrue(TEXT("Re-resolved"), Handle.IsResolved());
+	Test.TestNotEqual(TEXT("New topic gets a new index"), Handle.Index, IndexInt32);
+	const FAGX_ROS2TopicHandle Named = PublisherA->GetTopicHandle(
+		EAGX_ROS2MessageType::StdMsgsInt32, TopicOther);
+	Test.TestEqual(TEXT("Same index as by name"), Handle.Index, Named.Index);
+
+	// Re-resolve on another Component.
+	Handle.SetTopic(TopicInt32);
+	Test.TestTrue(
+		TEXT("Send on other Publisher"), PublisherB->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestTrue(TEXT("Owner is other Publisher"), Handle.Owner.Get() == PublisherB);
+	// Whether a message is received depends on discovery, only the resolve is checked here.
+	Subscriber->ReceiveStdMsgsInt32ByHandle(Int32Msg, Handle);
+	Test.TestTrue(TEXT("Resolved on Subscriber"), Handle.IsResolved());
+	Test.TestTrue(TEXT("Owner is Subscriber"), Handle.Owner.Get() == Subscriber);
+
+	// Re-resolve with another message type, on a topic that is free for that type.
+	Handle.SetTopic(TopicOther);
+	Test.TestTrue(
+		TEXT("Send other type"), PublisherB->SendStdMsgsFloat64ByHandle(Float64Msg, Handle));
+	Test.TestTrue(
+		TEXT("Other message type"), Handle.MessageType == EAGX_ROS2MessageType::StdMsgsFloat64);
+
+	// Using a topic with the wrong message type fails and leaves the handle unresolved.
+	Test.AddExpectedError(TEXT("Existing Native ROS2 Publisher with different message type"));
+	Handle.SetTopic(TopicInt32);
+	Test.TestFalse(
+		TEXT("Send with wrong type"), PublisherB->SendStdMsgsFloat64ByHandle(Float64Msg, Handle));
+	Test.TestFalse(TEXT("Unresolved after type mismatch"), Handle.IsResolved());
+	Test.TestTrue(
+		TEXT("Correct type still works"), PublisherB->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestTrue(TEXT("Resolved again"), Handle.IsResolved());
+
+	// Handles resolved before a Component released its topics are resolved again.
+	const uint32 Generation = Handle.Generation;
+	PublisherB->EndPlay(EEndPlayReason::RemovedFromWorld);
+	Test.TestTrue(
+		TEXT("Send after EndPlay"), PublisherB->SendStdMsgsInt32ByHandle(Int32Msg, Handle));
+	Test.TestNotEqual(TEXT("Generation after EndPlay"), Handle.Generation, Generation);
+
+	Actor->Destroy();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FROS2TopicHandleTest, "AGXUnreal.Game.AGX_ROS2Component.TopicHandle",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FROS2TopicHandleTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckROS2TopicHandleCommand(*this));
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
+
+///
+/// Batch receive test starts here.
+///
+/// More messages than fit in one batch are sent on two topics. On the first topic they are
+/// received in batches, which must preserve the order and respect Max Messages. On the second topic
+/// they are received with Latest Only, which must give only the newest message and consume the
+/// older ones.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FROS2ReceiveBatchState
+{
+	static constexpr int32 NumMessages = 12;
+	static constexpr int32 MaxMessages = 5;
+	const FString TopicAll {TEXT("agx_unreal_test_batch_all")};
+	const FString TopicLatest {TEXT("agx_unreal_test_batch_latest")};
+
+	AActor* Actor {nullptr};
+	UAGX_ROS2PublisherComponent* Publisher {nullptr};
+	UAGX_ROS2SubscriberComponent* Subscriber {nullptr};
+	double SendTimeStamp {-1.0};
+	double ReceiveTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FSetupROS2ReceiveBatchCommand, TSharedPtr<FROS2ReceiveBatchState>, State,
+	FAutomationTestBase&, Test);
+
+bool FSetupROS2ReceiveBatchCommand::Update()
+{
+	using namespace AGX_ROS2ComponentTest_helpers;
+	check(State != nullptr);
+	check(State->Actor == nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	State->SendTimeStamp = Simulation->GetTimeStamp() + 0.2;
+	State->ReceiveTimeStamp = State->SendTimeStamp + 0.5;
+
+	const int32 HistoryDepth = FROS2ReceiveBatchState::NumMessages;
+	State->Actor = SpawnLoopbackActor(*World, TEXT("ROS2 Receive Batch Actor"));
+	State->Publisher = AddLoopbackComponent<UAGX_ROS2PublisherComponent>(
+		*State->Actor, TEXT("Publisher"), HistoryDepth);
+	State->Subscriber = AddLoopbackComponent<UAGX_ROS2SubscriberComponent>(
+		*State->Actor, TEXT("Subscriber"), HistoryDepth);
+
+	// Create the Subscriber Barriers up front so that discovery can start before the first send.
+	TArray<FAGX_StdMsgsInt32> Messages;
+	Test.TestEqual(
+		TEXT("Nothing received before the first send"),
+		State->Subscriber->ReceiveStdMsgsInt32Batch(Messages, State->TopicAll) +
+			State->Subscriber->ReceiveStdMsgsInt32Batch(Messages, State->TopicLatest),
+		0);
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FSendROS2ReceiveBatchCommand, TSharedPtr<FROS2ReceiveBatchState>, State,
+	FAutomationTestBase&, Test);
+
+bool FSendROS2ReceiveBatchCommand::Update()
+{
+	if (State->Publisher == nullptr)
+		return true;
+
+	bool bAllSent = true;
+	for (int32 I = 0; I < FROS2ReceiveBatchState::NumMessages; ++I)
+	{
+		FAGX_StdMsgsInt32 Message;
+		Message.Data = I;
+		bAllSent &= State->Publisher->SendStdMsgsInt32(Message, State->TopicAll);
+		bAllSent &= State->Publisher->SendStdMsgsInt32(Message, State->TopicLatest);
+	}
+	Test.TestTrue(TEXT("All messages sent"), bAllSent);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckROS2ReceiveBatchCommand, TSharedPtr<FROS2ReceiveBatchState>, State,
+	FAutomationTestBase&, Test);
+
+bool FCheckROS2ReceiveBatchCommand::Update()
+{
+	if (State->Subscriber == nullptr)
+		return true;
+
+	const int32 NumMessages = FROS2ReceiveBatchState::NumMessages;
+	const int32 MaxMessages = FROS2ReceiveBatchState::MaxMessages;
+
+	// Receive all messages, at most Max Messages at a time.
+	TArray<FAGX_StdMsgsInt32> Messages;
+	TArray<int32> Received;
+	int32 NumBatches = 0;
+	bool bBatchesWithinMax = true;
+	while (State->Subscriber->ReceiveStdMsgsInt32Batch(Messages, State->TopicAll, MaxMessages) > 0)
+	{
+		bBatchesWithinMax &= Messages.Num() <= MaxMessages;
+		for (const FAGX_StdMsgsInt32& Message : Messages)
+			Received.Add(Message.Data);
+		++NumBatches;
+	}
+	Test.TestTrue(TEXT("Batches within Max Messages"), bBatchesWithinMax);
+	Test.TestEqual(TEXT("All messages received"), Received.Num(), NumMessages);
+	Test.TestEqual(
+		TEXT("Number of batches"), NumBatches, FMath::DivideAndRoundUp(NumMessages, MaxMessages));
+	bool bInOrder = true;
+	for (int32 I = 0; I < Received.Num(); ++I)
+		bInOrder &= Received[I] == I;
+	Test.TestTrue(TEXT("Messages received in order"), bInOrder);
+
+	// Latest Only gives the newest message and consumes all older ones.
+	const int32 NumLatest = State->Subscriber->ReceiveStdMsgsInt32Batch(
+		Messages, State->TopicLatest, MaxMessages, /*bLatestOnly*/ true);
+	Test.TestEqual(TEXT("Latest Only gives one message"), NumLatest, 1);
+	if (Messages.Num() == 1)
+		Test.TestEqual(TEXT("Latest Only gives the newest"), Messages[0].Data, NumMessages - 1);
+	Test.TestEqual(
+		TEXT("Latest Only consumes older messages"),
+		State->Subscriber->ReceiveStdMsgsInt32Batch(Messages, State->TopicLatest, MaxMessages),
+		0);
+
+	State->Actor->Destroy();
+	State->Actor = nullptr;
+	State->Publisher = nullptr;
+	State->Subscriber = nullptr;
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FROS2ReceiveBatchTest, "AGXUnreal.Game.AGX_ROS2Component.ReceiveBatch",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FROS2ReceiveBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FROS2ReceiveBatchState> State = MakeShared<FROS2ReceiveBatchState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupROS2ReceiveBatchCommand(State, *this))
+
+	// Give the Publisher and the Subscriber some time to discover each other, and the messages
+	// some time to arrive, before receiving.
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->SendTimeStamp));
+	ADD_LATENT_AUTOMATION_COMMAND(FSendROS2ReceiveBatchCommand(State, *this));
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->ReceiveTimeStamp));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckROS2ReceiveBatchCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
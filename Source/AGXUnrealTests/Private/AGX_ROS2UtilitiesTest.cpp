@@ -0,0 +1,265 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "ROS2/AGX_ROS2Messages.h"
+#include "Sensors/AGX_LidarOutputTypes.h"
+#include "Sensors/AGX_LidarScanPoint.h"
+#include "Utilities/AGX_ROS2Utilities.h"
+
+// Unreal Engine includes.
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+// Standard library includes.
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+/*
+ * The ROS2 conversions write their data with bulk memory copies. These tests compare the result
+ * byte for byte with reference implementations that write every byte explicitly in little endian
+ * order, which is what the conversions did before.
+ */
+namespace AGX_ROS2UtilitiesTest_helpers
+{
+	template <typename UintType, typename ValueType>
+	void AppendBytes(ValueType Val, TArray<uint8>& OutData)
+	{
+		UintType Bits;
+		static_assert(sizeof(Bits) == sizeof(Val));
+		std::memcpy(&Bits, &Val, sizeof(Bits));
+		for (int i = 0; i < sizeof(Val); i++)
+		{
+			OutData.Add(static_cast<uint8>(Bits & 0xFF));
+			Bits >>= 8;
+		}
+	}
+
+	TArray<uint8> ReferenceXYZ(
+		const TArray<FAGX_LidarScanPoint>& Points, bool DoublePrecision, bool ROSCoordinates)
+	{
+		TArray<uint8> Data;
+		for (const FAGX_LidarScanPoint& P : Points)
+		{
+			if (!P.bIsValid)
+				continue;
+
+			const FVector Pos =
+				ROSCoordinates ? UAGX_ROS2Utilities::ConvertPositionToROS(P.Position) : P.Position;
+			for (const double V : {Pos.X, Pos.Y, Pos.Z, static_cast<double>(P.Intensity)})
+			{
+				if (DoublePrecision)
+					AppendBytes<uint64>(V, Data);
+				else
+					AppendBytes<uint32>(static_cast<float>(V), Data);
+			}
+		}
+		return Data;
+	}
+
+	TArray<uint8> ReferenceAnglesTOF(const TArray<FAGX_LidarScanPoint>& Points)
+	{
+		static constexpr double K = 2.0 * 1.0e12 / 299792458.0;
+		TArray<uint8> Data;
+		for (const FAGX_LidarScanPoint& P : Points)
+		{
+			if (!P.bIsValid)
+				continue;
+
+			const double AngleX = FMath::Atan2(P.Position.Y, P.Position.X);
+			const double AngleY = FMath::Atan2(
+				P.Position.Z,
+				FMath::Sqrt(FMath::Pow(P.Position.X, 2) + FMath::Pow(P.Position.Y, 2)));
+			const double TimePikoSecondsd = 0.01 * P.Position.Length() * K;
+			const uint32 TimePikoSeconds =
+				TimePikoSecondsd > std::numeric_limits<uint32>::max()
+					? std::numeric_limits<uint32>::max()
+					: static_cast<uint32>(TimePikoSecondsd);
+			AppendBytes<uint64>(AngleX, Data);
+			AppendBytes<uint64>(AngleY, Data);
+			AppendBytes<uint32>(TimePikoSeconds, Data);
+			AppendBytes<uint64>(static_cast<double>(P.Intensity), Data);
+		}
+		return Data;
+	}
+
+	template <typename DataType>
+	TArray<uint8> ReferencePositions(const TArray<DataType>& Points)
+	{
+		TArray<uint8> Data;
+		for (const DataType& D : Points)
+		{
+			FVector3f Pos = 0.01f * D.Position;
+			Pos.Y = -Pos.Y;
+			AppendBytes<uint32>(Pos.X, Data);
+			AppendBytes<uint32>(Pos.Y, Data);
+			AppendBytes<uint32>(Pos.Z, Data);
+			if constexpr (std::is_same_v<DataType, FAGX_LidarOutputPositionIntensityData>)
+				AppendBytes<uint32>(D.Intensity, Data);
+		}
+		return Data;
+	}
+
+	TArray<uint8> ReferenceImage(const TArray<FColor>& Image, bool Grayscale)
+	{
+		TArray<uint8> Data;
+		for (const FColor& C : Image)
+		{
+			if (Grayscale)
+			{
+				Data.Add(static_cast<uint8>(
+					(static_cast<uint16>(C.R) + static_cast<uint16>(C.G) +
+					 static_cast<uint16>(C.B)) /
+					3));
+			}
+			else
+			{
+				Data.Add(C.R);
+				Data.Add(C.G);
+				Data.Add(C.B);
+			}
+		}
+		return Data;
+	}
+
+	TArray<uint8> ReferenceImage(const TArray<FFloat16Color>& Image, bool Grayscale)
+	{
+		static constexpr float MaxUint16f = static_cast<float>(std::numeric_limits<uint16>::max());
+		TArray<uint8> Data;
+		for (const FFloat16Color& Color : Image)
+		{
+			const FLinearColor C = Color.GetFloats();
+			if (Grayscale)
+			{
+				AppendBytes<uint16>(
+					static_cast<uint16>(
+						FMath::Clamp((C.R + C.G + C.B) / 3.f, 0.f, 1.f) * MaxUint16f),
+					Data);
+			}
+			else
+			{
+				for (const float V : {C.R, C.G, C.B})
+					AppendBytes<uint16>(
+						static_cast<uint16>(FMath::Clamp(V, 0.f, 1.f) * MaxUint16f), Data);
+			}
+		}
+		return Data;
+	}
+
+	TArray<FAGX_LidarScanPoint> MakeScanPoints(FRandomStream& Random, int32 Num)
+	{
+		TArray<FAGX_LidarScanPoint> Points;
+		for (int32 I = 0; I < Num; ++I)
+		{
+			// Every fifth point is a miss, including the first, which must be skipped.
+			if (I % 5 == 0)
+			{
+				Points.Add(FAGX_LidarScanPoint(false));
+				continue;
+			}
+
+			const FVector Position(
+				Random.FRandRange(-5000.0, 5000.0), Random.FRandRange(-5000.0, 5000.0),
+				Random.FRandRange(-500.0, 500.0));
+			Points.Add(FAGX_LidarScanPoint(Position, 1.25, Random.FRand(), true));
+		}
+		return Points;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_ROS2UtilitiesPointCloudTest, "AGXUnreal.Editor.AGX_ROS2Utilities.PointCloudBytes",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_ROS2UtilitiesPointCloudTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_ROS2UtilitiesTest_helpers;
+	FRandomStream Random(1234);
+	const TArray<FAGX_LidarScanPoint> Points = MakeScanPoints(Random, 1000);
+
+	for (const bool DoublePrecision : {false, true})
+	{
+		for (const bool ROSCoordinates : {false, true})
+		{
+			const FAGX_SensorMsgsPointCloud2 Msg =
+				UAGX_ROS2Utilities::ConvertXYZ(Points, DoublePrecision, ROSCoordinates);
+			TestTrue(
+				TEXT("ConvertXYZ data"),
+				Msg.Data == ReferenceXYZ(Points, DoublePrecision, ROSCoordinates));
+			TestEqual(TEXT("ConvertXYZ width"), Msg.Width, static_cast<int64>(800));
+			TestEqual(TEXT("ConvertXYZ row step"), Msg.RowStep, Msg.Width * Msg.PointStep);
+		}
+	}
+
+	const FAGX_SensorMsgsPointCloud2 AnglesTOF = UAGX_ROS2Utilities::ConvertAnglesTOF(Points);
+	TestTrue(TEXT("ConvertAnglesTOF data"), AnglesTOF.Data == ReferenceAnglesTOF(Points));
+	TestEqual(TEXT("ConvertAnglesTOF width"), AnglesTOF.Width, static_cast<int64>(800));
+
+	TArray<FAGX_LidarOutputPositionData> PositionData;
+	TArray<FAGX_LidarOutputPositionIntensityData> PositionIntensityData;
+	for (const FAGX_LidarScanPoint& P : Points)
+	{
+		const FVector3f Position(P.Position);
+		PositionData.AddDefaulted_GetRef().Position = Position;
+		FAGX_LidarOutputPositionIntensityData& D = PositionIntensityData.AddDefaulted_GetRef();
+		D.Position = Position;
+		D.Intensity = static_cast<float>(P.Intensity);
+	}
+
+	TestTrue(
+		TEXT("ConvertPositionData data"),
+		UAGX_ROS2Utilities::ConvertPositionData(PositionData, 1.0).Data ==
+			ReferencePositions(PositionData));
+	TestTrue(
+		TEXT("ConvertPositionIntensityData data"),
+		UAGX_ROS2Utilities::ConvertPositionIntensityData(PositionIntensityData, 1.0).Data ==
+			ReferencePositions(PositionIntensityData));
+
+	// No valid points gives an empty message.
+	TArray<FAGX_LidarScanPoint> Misses;
+	Misses.Init(FAGX_LidarScanPoint(false), 10);
+	TestEqual(
+		TEXT("No valid points"), UAGX_ROS2Utilities::ConvertXYZ(Misses).Data.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FAGX_ROS2UtilitiesImageTest, "AGXUnreal.Editor.AGX_ROS2Utilities.ImageBytes",
+	EAutomationTestFlags::ProductFilter | AgxAutomationCommon::ETF_ApplicationContextMask)
+
+bool FAGX_ROS2UtilitiesImageTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_ROS2UtilitiesTest_helpers;
+	FRandomStream Random(4321);
+	const FIntPoint Resolution(32, 16);
+
+	TArray<FColor> Image8;
+	TArray<FFloat16Color> Image16;
+	for (int32 I = 0; I < Resolution.X * Resolution.Y; ++I)
+	{
+		const FColor Color(
+			static_cast<uint8>(Random.RandHelper(256)), static_cast<uint8>(Random.RandHelper(256)),
+			static_cast<uint8>(Random.RandHelper(256)), 255);
+		Image8.Add(Color);
+
+		// Values outside [0..1] are clamped.
+		Image16.Add(FFloat16Color(FLinearColor(
+			Random.FRandRange(-0.1f, 1.1f), Random.FRandRange(-0.1f, 1.1f),
+			Random.FRandRange(-0.1f, 1.1f))));
+	}
+
+	for (const bool Grayscale : {false, true})
+	{
+		TestTrue(
+			TEXT("8 bit image data"),
+			FAGX_ROS2Utilities::Convert(Image8, 0.5, Resolution, Grayscale).Data ==
+				ReferenceImage(Image8, Grayscale));
+		TestTrue(
+			TEXT("16 bit image data"),
+			FAGX_ROS2Utilities::Convert(Image16, 0.5, Resolution, Grayscale).Data ==
+				ReferenceImage(Image16, Grayscale));
+	}
+
+	return true;
+}
@@ -0,0 +1,165 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains unit tests for batched Rigid Body synchronization.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_RigidBodyComponent.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+///
+/// Rigid Body Batched Sync test starts here.
+///
+/// A number of Rigid Bodies with different Transform Targets are given an initial velocity in a
+/// simulation without gravity. With batched synchronization the Rigid Body Components must not
+/// tick, but must still follow the AGX Dynamics Rigid Bodies.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FBatchedSyncState
+{
+	AActor* Actor {nullptr};
+	TArray<UAGX_RigidBodyComponent*> Bodies;
+	TArray<FVector> InitialLocations;
+	double EndTimeStamp {-1.0};
+	bool bOriginalBatchedSync {false};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FBuildBatchedSyncCommand, TSharedPtr<FBatchedSyncState>, State);
+
+bool FBuildBatchedSyncCommand::Update()
+{
+	check(State != nullptr);
+	check(State->Actor == nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+
+	// Configure the simulation. Must be done before the Rigid Bodies begin play.
+	State->bOriginalBatchedSync = Simulation->bEnableBatchedRigidBodySync;
+	Simulation->bEnableBatchedRigidBodySync = true;
+	Simulation->SetUniformGravity(FVector(ForceInitToZero));
+	State->EndTimeStamp = Simulation->GetTimeStamp() + 1.0;
+
+	// Spawn the Actor.
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = FName(TEXT("Batched Sync Actor"));
+	State->Actor = World->SpawnActor<AActor>(SpawnParameters);
+	USceneComponent* RootComponent = NewObject<USceneComponent>(
+		State->Actor, USceneComponent::GetDefaultSceneRootVariableName());
+	State->Actor->SetRootComponent(RootComponent);
+	State->Actor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	// Create the bodies, one with each Transform Target that doesn't move the root.
+	const EAGX_TransformTarget Targets[] = {TT_SELF, TT_SELF, TT_PARENT};
+	USceneComponent* Parent = RootComponent;
+	for (int32 I = 0; I < UE_ARRAY_COUNT(Targets); ++I)
+	{
+		if (Targets[I] == TT_PARENT)
+		{
+			// Give the body a parent of its own so that the whole Actor isn't moved.
+			USceneComponent* Holder = NewObject<USceneComponent>(State->Actor, TEXT("Holder"));
+			Holder->SetMobility(EComponentMobility::Movable);
+			Holder->SetupAttachment(RootComponent);
+			State->Actor->AddInstanceComponent(Holder);
+			Holder->RegisterComponent();
+			Parent = Holder;
+		}
+
+		const FString BodyName = FString::Printf(TEXT("Body %d"), I);
+		UAGX_RigidBodyComponent* Body =
+			NewObject<UAGX_RigidBodyComponent>(State->Actor, FName(*BodyName));
+		Body->Mobility = EComponentMobility::Movable;
+		Body->TransformTarget = Targets[I];
+		Body->SetupAttachment(Parent);
+		Body->SetRelativeLocation(FVector(0.0, I * 200.0, 0.0));
+		Body->SetVelocity(FVector(100.0 * (I + 1), 0.0, 0.0));
+		State->Actor->AddInstanceComponent(Body);
+		Body->RegisterComponent();
+
+		State->Bodies.Add(Body);
+		State->InitialLocations.Add(Body->GetComponentLocation());
+	}
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckBatchedSyncCommand, TSharedPtr<FBatchedSyncState>, State, FAutomationTestBase&, Test);
+
+bool FCheckBatchedSyncCommand::Update()
+{
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+
+	for (int32 I = 0; I < State->Bodies.Num(); ++I)
+	{
+		const UAGX_RigidBodyComponent* Body = State->Bodies[I];
+		Test.TestFalse(
+			*FString::Printf(TEXT("Body %d Tick Component enabled"), I),
+			Body->IsComponentTickEnabled());
+
+		// The Scene Component should have been moved to where the AGX Dynamics Rigid Body is.
+		// The state is read in Post Physics and the simulation isn't stepped again until the next
+		// Pre Physics, so there should be no difference at all.
+		const FVector Location = Body->GetComponentLocation();
+		Test.TestEqual(
+			*FString::Printf(TEXT("Body %d location"), I), Location, Body->GetPosition());
+		Test.TestTrue(
+			*FString::Printf(TEXT("Body %d has moved"), I),
+			Location.X > State->InitialLocations[I].X + 50.0 * (I + 1));
+		Test.TestEqual(
+			*FString::Printf(TEXT("Body %d velocity"), I), Body->GetVelocity(),
+			FVector(100.0 * (I + 1), 0.0, 0.0));
+	}
+
+	// Restore the original setting so that other tests are not affected.
+	Simulation->bEnableBatchedRigidBodySync = State->bOriginalBatchedSync;
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBatchedSyncTest, "AGXUnreal.Game.AGX_RigidBody.BatchedSync",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FBatchedSyncTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FBatchedSyncState> State = MakeShared<FBatchedSyncState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FBuildBatchedSyncCommand(State))
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckBatchedSyncCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
@@ -0,0 +1,185 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains unit tests for the Sensor Environment.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_LogCategory.h"
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "Sensors/AGX_LidarOutputPosition.h"
+#include "Sensors/AGX_LidarSensorComponent.h"
+#include "Sensors/AGX_SensorEnvironment.h"
+#include "Sensors/SensorEnvironmentBarrier.h"
+
+// Unreal Engine includes.
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+///
+/// Lidar Instanced Static Mesh test starts here.
+///
+/// An instance is added during Play to an Instanced Static Mesh Component that has no instances,
+/// within range of a Lidar in a Sensor Environment with Auto Add Objects. Adding an instance
+/// generates no overlap events, but the Lidar must still see the new instance.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FLidarAddedInstanceState
+{
+	UAGX_LidarSensorComponent* Lidar {nullptr};
+	UInstancedStaticMeshComponent* Mesh {nullptr};
+	FAGX_LidarOutputPosition Output;
+	FBox InstanceBox {ForceInit};
+	double AddInstanceTimeStamp {-1.0};
+	double EndTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FSetupLidarAddedInstanceCommand, TSharedPtr<FLidarAddedInstanceState>, State,
+	FAutomationTestBase&, Test);
+
+bool FSetupLidarAddedInstanceCommand::Update()
+{
+	check(State != nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	State->AddInstanceTimeStamp = Simulation->GetTimeStamp() + 0.1;
+	State->EndTimeStamp = State->AddInstanceTimeStamp + 0.5;
+
+	// Find the Lidar in the test map.
+	TActorIterator<AAGX_SensorEnvironment> EnvironmentIt(World);
+	if (!Test.TestTrue(TEXT("Sensor Environment found"), static_cast<bool>(EnvironmentIt)))
+		return true;
+	AAGX_SensorEnvironment* Environment = *EnvironmentIt;
+	if (!Test.TestTrue(TEXT("Auto Add Objects"), Environment->bAutoAddObjects) ||
+		!Test.TestTrue(TEXT("Lidar registered"), Environment->LidarSensors.Num() > 0))
+		return true;
+	State->Lidar = Environment->LidarSensors[0].GetLidarComponent();
+	if (!Test.TestNotNull(TEXT("Lidar"), State->Lidar))
+		return true;
+	Test.TestTrue(TEXT("Add Lidar output"), State->Output.AddTo(State->Lidar));
+
+	// Spawn an Instanced Static Mesh Component without any instances.
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!Test.TestNotNull(TEXT("Cube mesh"), Cube))
+		return true;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = FName(TEXT("Lidar Added Instance Actor"));
+	AActor* Actor = World->SpawnActor<AActor>(SpawnParameters);
+	State->Mesh = NewObject<UInstancedStaticMeshComponent>(
+		Actor, USceneComponent::GetDefaultSceneRootVariableName());
+	State->Mesh->SetMobility(EComponentMobility::Movable);
+	State->Mesh->SetStaticMesh(Cube);
+	State->Mesh->SetGenerateOverlapEvents(true);
+	Actor->SetRootComponent(State->Mesh);
+	Actor->AddInstanceComponent(State->Mesh);
+	State->Mesh->RegisterComponent();
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FAddLidarInstanceCommand, TSharedPtr<FLidarAddedInstanceState>, State);
+
+bool FAddLidarInstanceCommand::Update()
+{
+	if (State->Lidar == nullptr || State->Mesh == nullptr)
+		return true;
+
+	// Place the instance straight ahead of the Lidar, well within range.
+	const FTransform& LidarTransform = State->Lidar->GetComponentTransform();
+	const FVector Location =
+		LidarTransform.GetLocation() + LidarTransform.GetUnitAxis(EAxis::X) * 300.0;
+	const FTransform InstanceTransform(Location);
+	State->Mesh->AddInstance(InstanceTransform, /*bWorldSpace*/ true);
+	State->InstanceBox = State->Mesh->GetStaticMesh()->GetBoundingBox().TransformBy(
+		InstanceTransform);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckLidarAddedInstanceCommand, TSharedPtr<FLidarAddedInstanceState>, State,
+	FAutomationTestBase&, Test);
+
+bool FCheckLidarAddedInstanceCommand::Update()
+{
+	if (State->Lidar == nullptr || State->Mesh == nullptr)
+		return true;
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation::GetFrom(World)->WaitForStepForward();
+
+	TArray<FAGX_LidarOutputPositionData> Points;
+	State->Output.GetData(Points);
+	Test.TestTrue(TEXT("Lidar has output"), Points.Num() > 0);
+
+	// The points are given relative to the Lidar.
+	const FTransform& LidarTransform = State->Lidar->GetComponentTransform();
+	const FBox HitBox = State->InstanceBox.ExpandBy(1.0);
+	int32 NumHits = 0;
+	for (const FAGX_LidarOutputPositionData& Point : Points)
+	{
+		if (HitBox.IsInside(LidarTransform.TransformPositionNoScale(FVector(Point.Position))))
+			++NumHits;
+	}
+	Test.TestTrue(TEXT("Lidar hits the added instance"), NumHits > 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLidarAddedInstanceTest, "AGXUnreal.Game.AGX_SensorEnvironment.LidarAddedInstance",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FLidarAddedInstanceTest::RunTest(const FString& Parameters)
+{
+	if (!FSensorEnvironmentBarrier::IsRaytraceSupported())
+	{
+		UE_LOG(
+			LogAGX, Warning,
+			TEXT("Skipping AGX_SensorEnvironment.LidarAddedInstance test because Raytracing is "
+				 "not supported on this computer."));
+		return true;
+	}
+
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FLidarAddedInstanceState> State = MakeShared<FLidarAddedInstanceState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(TEXT("/Game/Tests/Test_Lidar")))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupLidarAddedInstanceCommand(State, *this))
+
+	// Let the empty Instanced Static Mesh Component exist for a while before adding the instance,
+	// so that the instance is added during Play and not as part of the spawn.
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->AddInstanceTimeStamp));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLidarInstanceCommand(State));
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLidarAddedInstanceCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
@@ -0,0 +1,312 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains unit tests for the Shape Contact Snapshot.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_PlayInEditorUtils.h"
+#include "AGX_RigidBodyComponent.h"
+#include "AGX_Simulation.h"
+#include "AgxAutomationCommon.h"
+#include "Contacts/AGX_ShapeContact.h"
+#include "Contacts/AGX_ShapeContactSnapshot.h"
+#include "Contacts/AGX_ShapeContactSnapshotFunctionLibrary.h"
+#include "Shapes/AGX_BoxShapeComponent.h"
+#include "Shapes/AGX_SphereShapeComponent.h"
+
+// Unreal Engine includes.
+#include "Editor.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+///
+/// Shape Contact Snapshot test starts here.
+///
+/// Two spheres, each in its own Rigid Body, rest on a ground box without a Rigid Body. The contents
+/// of Shape Contact Snapshots, with and without filters, are compared against the per-contact
+/// Shape Contact API.
+///
+
+// State owned by the test and carried between latent command invocations.
+struct FShapeContactSnapshotState
+{
+	AActor* Actor {nullptr};
+	UAGX_BoxShapeComponent* Ground {nullptr};
+	TArray<UAGX_RigidBodyComponent*> Bodies;
+	TArray<UAGX_SphereShapeComponent*> Spheres;
+	double EndTimeStamp {-1.0};
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+	FBuildShapeContactSnapshotCommand, TSharedPtr<FShapeContactSnapshotState>, State);
+
+bool FBuildShapeContactSnapshotCommand::Update()
+{
+	check(State != nullptr);
+	check(State->Actor == nullptr);
+	check(GEditor != nullptr);
+	check(GEditor->GetPIEWorldContext() != nullptr);
+	check(GEditor->GetPIEWorldContext()->World() != nullptr);
+
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	State->EndTimeStamp = Simulation->GetTimeStamp() + 0.1;
+
+	// Spawn the Actor.
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Name = FName(TEXT("Shape Contact Snapshot Actor"));
+	State->Actor = World->SpawnActor<AActor>(SpawnParameters);
+	USceneComponent* RootComponent = NewObject<USceneComponent>(
+		State->Actor, USceneComponent::GetDefaultSceneRootVariableName());
+	State->Actor->SetRootComponent(RootComponent);
+	State->Actor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	// Create the ground, a Shape without a Rigid Body.
+	State->Ground = NewObject<UAGX_BoxShapeComponent>(State->Actor, TEXT("Ground"));
+	State->Ground->SetHalfExtent(FVector(500.0, 500.0, 10.0));
+	State->Ground->SetupAttachment(RootComponent);
+	State->Actor->AddInstanceComponent(State->Ground);
+	State->Ground->RegisterComponent();
+
+	// Create two spheres that start slightly penetrating the ground, far from each other.
+	for (int32 I = 0; I < 2; ++I)
+	{
+		const FString BodyName = FString::Printf(TEXT("Body %d"), I);
+		UAGX_RigidBodyComponent* Body =
+			NewObject<UAGX_RigidBodyComponent>(State->Actor, FName(*BodyName));
+		Body->Mobility = EComponentMobility::Movable;
+		Body->SetupAttachment(RootComponent);
+		Body->SetRelativeLocation(FVector(-200.0 + I * 400.0, 0.0, 59.0));
+		State->Actor->AddInstanceComponent(Body);
+		Body->RegisterComponent();
+
+		const FString ShapeName = FString::Printf(TEXT("Sphere %d"), I);
+		UAGX_SphereShapeComponent* Sphere =
+			NewObject<UAGX_SphereShapeComponent>(State->Actor, FName(*ShapeName));
+		Sphere->SetRadius(50.0f);
+		Sphere->SetupAttachment(Body);
+		State->Actor->AddInstanceComponent(Sphere);
+		Sphere->RegisterComponent();
+
+		State->Bodies.Add(Body);
+		State->Spheres.Add(Sphere);
+	}
+
+	return true;
+}
+
+namespace AGX_ShapeContactSnapshotTest_helpers
+{
+	FGuid GetBodyGuid(const FRigidBodyBarrier& Body)
+	{
+		return Body.HasNative() ? Body.GetGuid() : FGuid();
+	}
+
+	bool Involves(const FAGX_ShapeContact& Contact, const FAGX_ShapeContactFilter& Filter)
+	{
+		const FShapeBarrier Shape1 = Contact.GetShape1();
+		const FShapeBarrier Shape2 = Contact.GetShape2();
+		const FGuid Body1 = GetBodyGuid(Contact.GetBody1());
+		const FGuid Body2 = GetBodyGuid(Contact.GetBody2());
+		if (Filter.ShapeGuid.IsValid() && Shape1.GetGeometryGuid() != Filter.ShapeGuid &&
+			Shape2.GetGeometryGuid() != Filter.ShapeGuid)
+		{
+			return false;
+		}
+		if (Filter.BodyGuid.IsValid() && Body1 != Filter.BodyGuid && Body2 != Filter.BodyGuid)
+		{
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Compare the snapshot against the per-contact API. Both read the AGX Dynamics Geometry
+	 * Contacts in the same order, so the Shape Contacts that pass the filter must match one to one.
+	 */
+	void TestSnapshot(
+		FAutomationTestBase& Test, const FString& What, const FAGX_ShapeContactSnapshot& Snapshot,
+		const TArray<FAGX_ShapeContact>& AllContacts, const FAGX_ShapeContactFilter& Filter,
+		int32 ExpectedNum)
+	{
+		TArray<const FAGX_ShapeContact*> Contacts;
+		for (const FAGX_ShapeContact& Contact : AllContacts)
+		{
+			if (Involves(Contact, Filter))
+				Contacts.Add(&Contact);
+		}
+
+		Test.TestEqual(*(What + TEXT(" expected Shape Contacts")), Contacts.Num(), ExpectedNum);
+		if (!Test.TestEqual(
+				*(What + TEXT(" num Shape Contacts")), Snapshot.GetNumShapeContacts(),
+				Contacts.Num()))
+		{
+			return;
+		}
+
+		int32 NumPoints = 0;
+		for (int32 I = 0; I < Contacts.Num(); ++I)
+		{
+			const FAGX_ShapeContact& Contact = *Contacts[I];
+			const FString Prefix = FString::Printf(TEXT("%s contact %d"), *What, I);
+			Test.TestEqual(
+				*(Prefix + TEXT(" first Shape")), Snapshot.FirstShapeGuids[I],
+				Contact.GetShape1().GetGeometryGuid());
+			Test.TestEqual(
+				*(Prefix + TEXT(" second Shape")), Snapshot.SecondShapeGuids[I],
+				Contact.GetShape2().GetGeometryGuid());
+			Test.TestEqual(
+				*(Prefix + TEXT(" first Body")), Snapshot.FirstBodyGuids[I],
+				GetBodyGuid(Contact.GetBody1()));
+			Test.TestEqual(
+				*(Prefix + TEXT(" second Body")), Snapshot.SecondBodyGuids[I],
+				GetBodyGuid(Contact.GetBody2()));
+			Test.TestEqual(*(Prefix + TEXT(" first point")), Snapshot.FirstPoints[I], NumPoints);
+			if (!Test.TestEqual(
+					*(Prefix + TEXT(" num points")), Snapshot.GetNumContactPoints(I),
+					Contact.GetNumContactPoints()))
+			{
+				return;
+			}
+
+			for (int32 P = 0; P < Contact.GetNumContactPoints(); ++P)
+			{
+				const FAGX_ContactPoint Point = Contact.GetContactPoint(P);
+				const int32 J = NumPoints + P;
+				Test.TestEqual(
+					*(Prefix + TEXT(" location")), Snapshot.Locations[J], Point.GetLocation());
+				Test.TestEqual(*(Prefix + TEXT(" normal")), Snapshot.Normals[J], Point.GetNormal());
+				Test.TestEqual(*(Prefix + TEXT(" depth")), Snapshot.Depths[J], Point.GetDepth());
+				Test.TestEqual(*(Prefix + TEXT(" force")), Snapshot.Forces[J], Point.GetForce());
+				Test.TestEqual(*(Prefix + TEXT(" index")), Snapshot.ShapeContactIndices[J], I);
+			}
+			NumPoints += Contact.GetNumContactPoints();
+		}
+		Test.TestEqual(*(What + TEXT(" num points")), Snapshot.GetNumContactPoints(), NumPoints);
+	}
+
+	/**
+	 * Check that the Blueprint accessors give the same values as the arrays, and that out of range
+	 * indices give zero values.
+	 */
+	void TestAccessors(FAutomationTestBase& Test, FAGX_ShapeContactSnapshot& Snapshot)
+	{
+		using FL = UAGX_ShapeContactSnapshot_FL;
+		Test.TestEqual(
+			TEXT("Accessor num Shape Contacts"), FL::GetNumShapeContacts(Snapshot),
+			Snapshot.GetNumShapeContacts());
+		Test.TestEqual(
+			TEXT("Accessor num Contact Points"), FL::GetNumContactPoints(Snapshot),
+			Snapshot.GetNumContactPoints());
+
+		bool bShapeContactsMatch = true;
+		for (int32 I = 0; I < Snapshot.GetNumShapeContacts(); ++I)
+		{
+			bShapeContactsMatch &=
+				FL::GetFirstShapeGuid(Snapshot, I) == Snapshot.FirstShapeGuids[I] &&
+				FL::GetSecondShapeGuid(Snapshot, I) == Snapshot.SecondShapeGuids[I] &&
+				FL::GetFirstBodyGuid(Snapshot, I) == Snapshot.FirstBodyGuids[I] &&
+				FL::GetSecondBodyGuid(Snapshot, I) == Snapshot.SecondBodyGuids[I] &&
+				FL::GetFirstPointIndex(Snapshot, I) == Snapshot.FirstPoints[I] &&
+				FL::GetNumPoints(Snapshot, I) == Snapshot.GetNumContactPoints(I);
+		}
+		Test.TestTrue(TEXT("Shape Contact accessors"), bShapeContactsMatch);
+
+		bool bPointsMatch = true;
+		for (int32 J = 0; J < Snapshot.GetNumContactPoints(); ++J)
+		{
+			bPointsMatch &= FL::GetLocation(Snapshot, J) == Snapshot.Locations[J] &&
+							FL::GetNormal(Snapshot, J) == Snapshot.Normals[J] &&
+							FL::GetDepth(Snapshot, J) == Snapshot.Depths[J] &&
+							FL::GetForce(Snapshot, J) == Snapshot.Forces[J] &&
+							FL::GetShapeContactIndex(Snapshot, J) ==
+								Snapshot.ShapeContactIndices[J];
+		}
+		Test.TestTrue(TEXT("Contact Point accessors"), bPointsMatch);
+
+		Test.AddExpectedError(TEXT("in a Shape Contact Snapshot that only has"));
+		const int32 OutOfRange = Snapshot.GetNumContactPoints();
+		Test.TestEqual(
+			TEXT("Out of range location"), FL::GetLocation(Snapshot, OutOfRange),
+			FVector::ZeroVector);
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+	FCheckShapeContactSnapshotCommand, TSharedPtr<FShapeContactSnapshotState>, State,
+	FAutomationTestBase&, Test);
+
+bool FCheckShapeContactSnapshotCommand::Update()
+{
+	using namespace AGX_ShapeContactSnapshotTest_helpers;
+	UWorld* World = GEditor->GetPIEWorldContext()->World();
+	UAGX_Simulation* Simulation = UAGX_Simulation::GetFrom(World);
+	Simulation->WaitForStepForward();
+
+	const TArray<FAGX_ShapeContact> AllContacts = Simulation->GetShapeContacts();
+
+	// The same snapshot is reused for all queries, to test that the reset between calls is
+	// complete.
+	FAGX_ShapeContactSnapshot Snapshot;
+
+	FAGX_ShapeContactFilter Filter;
+	Simulation->GetShapeContactSnapshot(Snapshot, Filter);
+	TestSnapshot(Test, TEXT("Unfiltered"), Snapshot, AllContacts, Filter, 2);
+	TestAccessors(Test, Snapshot);
+
+	Filter.ShapeGuid = State->Ground->GetNative()->GetGeometryGuid();
+	Simulation->GetShapeContactSnapshot(Snapshot, Filter);
+	TestSnapshot(Test, TEXT("Ground filter"), Snapshot, AllContacts, Filter, 2);
+
+	Filter.ShapeGuid = State->Spheres[0]->GetNative()->GetGeometryGuid();
+	Simulation->GetShapeContactSnapshot(Snapshot, Filter);
+	TestSnapshot(Test, TEXT("Sphere filter"), Snapshot, AllContacts, Filter, 1);
+
+	Filter.ShapeGuid = FGuid();
+	Filter.BodyGuid = State->Bodies[1]->GetNative()->GetGuid();
+	Simulation->GetShapeContactSnapshot(Snapshot, Filter);
+	TestSnapshot(Test, TEXT("Body filter"), Snapshot, AllContacts, Filter, 1);
+
+	Filter.ShapeGuid = State->Spheres[0]->GetNative()->GetGeometryGuid();
+	Simulation->GetShapeContactSnapshot(Snapshot, Filter);
+	TestSnapshot(Test, TEXT("Disjoint filter"), Snapshot, AllContacts, Filter, 0);
+
+	Snapshot.Reset();
+	Test.TestEqual(TEXT("Reset Shape Contacts"), Snapshot.GetNumShapeContacts(), 0);
+	Test.TestEqual(TEXT("Reset Contact Points"), Snapshot.GetNumContactPoints(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FShapeContactSnapshotTest, "AGXUnreal.Game.AGX_ShapeContactSnapshot.MatchesShapeContacts",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FShapeContactSnapshotTest::RunTest(const FString& Parameters)
+{
+	using namespace AGX_PlayInEditorUtils;
+
+	// Must allocate the state on the free store since the latent commands will execute after
+	// this function has returned and its local variables destroyed.
+	TSharedPtr<FShapeContactSnapshotState> State = MakeShared<FShapeContactSnapshotState>();
+
+	// Setup initial state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath))
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(true));
+	ADD_LATENT_AUTOMATION_COMMAND(AgxAutomationCommon::FWaitUntilPIEUpCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FBuildShapeContactSnapshotCommand(State))
+	ADD_LATENT_AUTOMATION_COMMAND(FTickUntilDynamicTimeStamp(&State->EndTimeStamp));
+
+	// Run the checks.
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShapeContactSnapshotCommand(State, *this));
+
+	// Restore clean state.
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+	ADD_LATENT_AUTOMATION_COMMAND(FEditorLoadMap(EmptyMapPath));
+
+	return true;
+}
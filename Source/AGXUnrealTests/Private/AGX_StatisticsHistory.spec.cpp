@@ -0,0 +1,80 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+// AGX Dynamics for Unreal includes.
+#include "AgxAutomationCommon.h"
+#include "Utilities/AGX_StatisticsHistory.h"
+
+// Unreal Engine includes.
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+	FAGX_StatisticsHistorySpec, "AGXUnreal.Spec.StatisticsHistory",
+	AgxAutomationCommon::DefaultTestFlags)
+END_DEFINE_SPEC(FAGX_StatisticsHistorySpec)
+
+void FAGX_StatisticsHistorySpec::Define()
+{
+	auto AddSamples = [](FAGX_StatisticsHistory& History, int32 NumSamples)
+	{
+		for (int32 I = 1; I <= NumSamples; ++I)
+		{
+			FAGX_Statistics Statistics;
+			Statistics.Sim_StepForwardTime = static_cast<float>(I);
+			History.Add(static_cast<double>(I), Statistics);
+		}
+	};
+
+	Describe(
+		"When adding more samples than the capacity",
+		[this, AddSamples]()
+		{
+			It("should keep the most recent samples, oldest first",
+			   [this, AddSamples]()
+			   {
+				   FAGX_StatisticsHistory History;
+				   History.SetCapacity(4);
+				   AddSamples(History, 10);
+				   TArray<FAGX_StatisticsSample> Samples;
+				   History.GetSamples(Samples);
+				   if (!TestEqual(TEXT("Number of samples"), Samples.Num(), 4))
+					   return;
+				   for (int32 I = 0; I < 4; ++I)
+				   {
+					   TestEqual(TEXT("Time stamp"), Samples[I].TimeStamp, 7.0 + I);
+				   }
+			   });
+		});
+
+	Describe(
+		"When summarizing a statistic",
+		[this, AddSamples]()
+		{
+			It("should compute min, max, mean and percentile",
+			   [this, AddSamples]()
+			   {
+				   FAGX_StatisticsHistory History;
+				   History.SetCapacity(100);
+				   AddSamples(History, 100);
+				   FAGX_StatisticsSummary Summary;
+				   const bool bFound =
+					   History.GetSummary(TEXT("Sim_StepForwardTime"), 95.0, Summary);
+				   TestTrue(TEXT("Statistic found"), bFound);
+				   TestEqual(TEXT("Num samples"), Summary.NumSamples, 100);
+				   TestEqual(TEXT("Min"), Summary.Min, 1.0);
+				   TestEqual(TEXT("Max"), Summary.Max, 100.0);
+				   TestEqual(TEXT("Mean"), Summary.Mean, 50.5);
+				   TestEqual(TEXT("Percentile"), Summary.Percentile, 95.0);
+			   });
+
+			It("should skip statistics not reported by AGX Dynamics",
+			   [this, AddSamples]()
+			   {
+				   FAGX_StatisticsHistory History;
+				   History.SetCapacity(10);
+				   AddSamples(History, 10);
+				   FAGX_StatisticsSummary Summary;
+				   History.GetSummary(TEXT("DynSys_SolverTime"), 50.0, Summary);
+				   TestEqual(TEXT("Num samples"), Summary.NumSamples, 0);
+			   });
+		});
+}
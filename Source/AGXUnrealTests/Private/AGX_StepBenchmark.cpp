@@ -0,0 +1,319 @@
+// Copyright 2026, Algoryx Simulation AB.
+
+/*
+ * This file contains the stepping performance benchmarks.
+ *
+ * Each benchmark builds a parameterised scene directly with the Barrier classes, i.e. without a
+ * world or any Components, steps it a fixed number of times and reports the wall-clock time and
+ * the AGX Dynamics per-phase timings. The per-phase timings are the same as the ones shown by the
+ * STAT_AGXD_* counters, i.e. everything in FAGX_Statistics. The benchmarks do not need a GPU and
+ * can be run headless with
+ *
+ *   UnrealEditor-Cmd <project> -ExecCmds="Automation RunTests AGXUnreal.Benchmark; Quit"
+ *     -NullRHI -Unattended
+ *
+ * The result of each benchmark is written as JSON to Saved/Automation/AGXBenchmarks/<Scene>.json,
+ * or to the directory given with -AGXBenchmarkOutput=<Directory>. To detect regressions, pass a
+ * directory containing the JSON files from an earlier run with -AGXBenchmarkBaseline=<Directory>.
+ * A benchmark fails if any timing is slower than the baseline by more than the tolerance, a
+ * fraction given with -AGXBenchmarkTolerance=<Fraction> that defaults to 0.1. The number of
+ * measured steps can be changed with -AGXBenchmarkSteps=<NumSteps>.
+ *
+ * The size of each scene can be changed from the command line as well, see the Build functions for
+ * the available -AGXBenchmark<Size>=<Value> parameters. The sizes used are written to the JSON
+ * file, and a baseline built with other sizes is not compared against.
+ *
+ * The Play In Editor benchmarks in AGX_PlayInEditorBenchmark.cpp take the same parameters and
+ * write their results the same way.
+ */
+
+// AGX Dynamics for Unreal includes.
+#include "AGX_BenchmarkUtils.h"
+#include "AGX_MotionControl.h"
+#include "AgxAutomationCommon.h"
+#include "Constraints/HingeBarrier.h"
+#include "RigidBodyBarrier.h"
+#include "Shapes/BoxShapeBarrier.h"
+#include "SimulationBarrier.h"
+#include "Terrain/ShovelBarrier.h"
+#include "Terrain/TerrainBarrier.h"
+#include "Utilities/AGX_Statistics.h"
+#include "Wire/WireBarrier.h"
+#include "Wire/WireNodeBarrier.h"
+
+// Unreal Engine includes.
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+namespace AGX_StepBenchmark_helpers
+{
+	const TCHAR* WallClockKey = TEXT("WallClockStepTime");
+
+	/**
+	 * Owns all Barriers that make up a benchmark scene. The Barriers are heap allocated since
+	 * they must not move after the AGX Dynamics objects have been created.
+	 */
+	struct FBenchmarkScene
+	{
+		FSimulationBarrier Simulation;
+		TArray<TUniquePtr<FRigidBodyBarrier>> Bodies;
+		TArray<TUniquePtr<FShapeBarrier>> Shapes;
+		TArray<TUniquePtr<FConstraintBarrier>> Constraints;
+		TArray<TUniquePtr<FWireBarrier>> Wires;
+		TArray<TUniquePtr<FWireNodeBarrier>> WireNodes;
+		TUniquePtr<FTerrainBarrier> Terrain;
+		TUniquePtr<FShovelBarrier> Shovel;
+
+		// The scene size parameters used when building the scene, by name.
+		TMap<FString, int32> Sizes;
+
+		~FBenchmarkScene()
+		{
+			if (Simulation.HasNative())
+				Simulation.ReleaseNative();
+		}
+	};
+
+	int32 GetSize(FBenchmarkScene& Scene, const TCHAR* Name, int32 Default)
+	{
+		return AGX_BenchmarkUtils::GetSize(Scene.Sizes, Name, Default);
+	}
+
+	FRigidBodyBarrier& CreateBox(
+		FBenchmarkScene& Scene, const FVector& Position, const FVector& HalfExtents,
+		EAGX_MotionControl MotionControl = MC_DYNAMICS)
+	{
+		TUniquePtr<FRigidBodyBarrier>& Body =
+			Scene.Bodies.Add_GetRef(MakeUnique<FRigidBodyBarrier>());
+		Body->AllocateNative();
+		Body->SetPosition(Position);
+		Body->SetMotionControl(MotionControl);
+
+		FBoxShapeBarrier* Box = new FBoxShapeBarrier();
+		Scene.Shapes.Emplace(Box);
+		Box->AllocateNative();
+		Box->SetHalfExtents(HalfExtents);
+		Body->AddShape(Box);
+
+		Scene.Simulation.Add(*Body);
+		return *Body;
+	}
+
+	void CreateGround(FBenchmarkScene& Scene, double HalfSize)
+	{
+		CreateBox(Scene, FVector(0.0, 0.0, -10.0), FVector(HalfSize, HalfSize, 10.0), MC_STATIC);
+	}
+
+	// A grid of separated boxes falling onto the ground. Measures per-body overhead.
+	// Size parameters: BodiesSide.
+	void BuildBodies(FBenchmarkScene& Scene)
+	{
+		const int32 Side = GetSize(Scene, TEXT("BodiesSide"), 32);
+		constexpr double Spacing = 150.0;
+		CreateGround(Scene, Side * Spacing);
+		for (int32 X = 0; X < Side; ++X)
+		{
+			for (int32 Y = 0; Y < Side; ++Y)
+			{
+				const FVector Position(
+					(X - Side / 2) * Spacing, (Y - Side / 2) * Spacing, 100.0 + (X + Y) % 7 * 20.0);
+				CreateBox(Scene, Position, FVector(25.0));
+			}
+		}
+	}
+
+	// Hanging chains of Hinge-connected bodies without contacts. Measures the solver.
+	// Size parameters: NumChains, NumLinks.
+	void BuildConstraints(FBenchmarkScene& Scene)
+	{
+		const int32 NumChains = GetSize(Scene, TEXT("NumChains"), 20);
+		const int32 NumLinks = GetSize(Scene, TEXT("NumLinks"), 25);
+		constexpr double LinkLength = 40.0;
+		for (int32 Chain = 0; Chain < NumChains; ++Chain)
+		{
+			const FVector Top(0.0, Chain * 100.0, NumLinks * LinkLength + 100.0);
+			const FRigidBodyBarrier* Previous = &CreateBox(Scene, Top, FVector(5.0), MC_STATIC);
+			for (int32 Link = 1; Link <= NumLinks; ++Link)
+			{
+				// Swing the chain out along X so that it starts moving immediately. The Hinge is
+				// half a link away from the center of both the previous link and this link.
+				const FVector Position = Top + FVector(Link * LinkLength, 0.0, 0.0);
+				FRigidBodyBarrier& Body =
+					CreateBox(Scene, Position, FVector(LinkLength * 0.4, 5.0, 5.0));
+				Scene.Shapes.Last()->SetEnableCollisions(false);
+
+				FHingeBarrier* Hinge = new FHingeBarrier();
+				Scene.Constraints.Emplace(Hinge);
+				const FQuat AxisAlongY = FQuat(FVector::XAxisVector, UE_HALF_PI);
+				Hinge->AllocateNative(
+					*Previous, FVector(LinkLength * 0.5, 0.0, 0.0), AxisAlongY, &Body,
+					FVector(-LinkLength * 0.5, 0.0, 0.0), AxisAlongY);
+				Scene.Simulation.Add(*Hinge);
+				Previous = &Body;
+			}
+		}
+	}
+
+	// Stacks of resting boxes. Measures contact generation and the solver for many contacts.
+	// Size parameters: NumStacks, StackHeight.
+	void BuildBoxStack(FBenchmarkScene& Scene)
+	{
+		const int32 NumStacks = GetSize(Scene, TEXT("NumStacks"), 10);
+		const int32 StackHeight = GetSize(Scene, TEXT("StackHeight"), 10);
+		CreateGround(Scene, FMath::Max(2000.0, (NumStacks / 5 + 1) * 200.0));
+		for (int32 Stack = 0; Stack < NumStacks; ++Stack)
+		{
+			for (int32 Level = 0; Level < StackHeight; ++Level)
+			{
+				const FVector Position(
+					(Stack % 5) * 200.0, (Stack / 5) * 200.0, 50.0 + Level * 100.0);
+				CreateBox(Scene, Position, FVector(50.0));
+			}
+		}
+	}
+
+	// A kinematic Shovel moving through a Terrain. Measures the terrain and particle systems.
+	// Size parameters: TerrainResolution.
+	void BuildTerrainShovel(FBenchmarkScene& Scene)
+	{
+		const int32 Resolution = GetSize(Scene, TEXT("TerrainResolution"), 201);
+		constexpr double ElementSize = 10.0;
+		TArray<float> InitialHeights;
+		TArray<float> MinimumHeights;
+		InitialHeights.Init(0.0f, Resolution * Resolution);
+		MinimumHeights.Init(-200.0f, Resolution * Resolution);
+		Scene.Terrain = MakeUnique<FTerrainBarrier>();
+		Scene.Terrain->AllocateNative(
+			Resolution, Resolution, ElementSize, InitialHeights, MinimumHeights);
+		Scene.Simulation.Add(*Scene.Terrain);
+
+		const FVector HalfExtents(20.0, 50.0, 30.0);
+		FRigidBodyBarrier& Body =
+			CreateBox(Scene, FVector(-300.0, 0.0, 10.0), HalfExtents, MC_KINEMATICS);
+		Body.SetVelocity(FVector(50.0, 0.0, -2.0));
+		const FTwoVectors TopEdge(
+			FVector(-HalfExtents.X, -HalfExtents.Y, HalfExtents.Z),
+			FVector(-HalfExtents.X, HalfExtents.Y, HalfExtents.Z));
+		const FTwoVectors CuttingEdge(
+			FVector(HalfExtents.X, -HalfExtents.Y, -HalfExtents.Z),
+			FVector(HalfExtents.X, HalfExtents.Y, -HalfExtents.Z));
+		Scene.Shovel = MakeUnique<FShovelBarrier>();
+		Scene.Shovel->AllocateNative(Body, TopEdge, CuttingEdge, FVector::XAxisVector, 10.0);
+		Scene.Simulation.Add(*Scene.Shovel);
+	}
+
+	// Wires holding swinging weights. Measures the wire systems.
+	// Size parameters: NumWires.
+	void BuildWire(FBenchmarkScene& Scene)
+	{
+		const int32 NumWires = GetSize(Scene, TEXT("NumWires"), 5);
+		constexpr double WireLength = 1000.0;
+		for (int32 I = 0; I < NumWires; ++I)
+		{
+			const FVector Top(0.0, I * 300.0, WireLength + 200.0);
+			FRigidBodyBarrier& Anchor = CreateBox(Scene, Top, FVector(10.0), MC_STATIC);
+			const FVector WeightPosition = Top + FVector(WireLength * 0.5, 0.0, -WireLength * 0.8);
+			FRigidBodyBarrier& Weight = CreateBox(Scene, WeightPosition, FVector(30.0));
+
+			FWireNodeBarrier* Begin = new FWireNodeBarrier();
+			Scene.WireNodes.Emplace(Begin);
+			Begin->AllocateNativeBodyFixedNode(Anchor, FVector::ZeroVector);
+			FWireNodeBarrier* End = new FWireNodeBarrier();
+			Scene.WireNodes.Emplace(End);
+			End->AllocateNativeBodyFixedNode(Weight, FVector::ZeroVector);
+
+			FWireBarrier* Wire = new FWireBarrier();
+			Scene.Wires.Emplace(Wire);
+			Wire->AllocateNative(1.5f, 0.02f);
+			Wire->AddRouteNode(*Begin);
+			Wire->AddRouteNode(*End);
+			Scene.Simulation.Add(*Wire);
+		}
+	}
+
+	using FBuildFunction = void (*)(FBenchmarkScene&);
+
+	struct FBenchmarkDefinition
+	{
+		const TCHAR* Name;
+		FBuildFunction Build;
+	};
+
+	const FBenchmarkDefinition Benchmarks[] = {
+		{TEXT("Bodies"), &BuildBodies},
+		{TEXT("Constraints"), &BuildConstraints},
+		{TEXT("BoxStack"), &BuildBoxStack},
+		{TEXT("TerrainShovel"), &BuildTerrainShovel},
+		{TEXT("Wire"), &BuildWire}};
+
+	/**
+	 * Mean time per step, in milliseconds, for the wall clock and each timing in FAGX_Statistics.
+	 * Statistics that AGX Dynamics doesn't report for the scene are left out.
+	 */
+	TMap<FString, double> StepScene(FBenchmarkScene& Scene, int32 NumSteps)
+	{
+		AGX_BenchmarkUtils::FTimingAccumulator Accumulator;
+		for (int32 Step = 0; Step < AGX_BenchmarkUtils::NumWarmupSteps + NumSteps; ++Step)
+		{
+			const double Start = FPlatformTime::Seconds();
+			Scene.Simulation.Step();
+			const double End = FPlatformTime::Seconds();
+			if (Step < AGX_BenchmarkUtils::NumWarmupSteps)
+				continue;
+
+			Accumulator.Add(WallClockKey, (End - Start) * 1000.0);
+			Accumulator.AddStatistics(Scene.Simulation.GetStatistics());
+		}
+		return Accumulator.GetMeans();
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(
+	FStepBenchmark, "AGXUnreal.Benchmark.Step",
+	AgxAutomationCommon::ETF_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FStepBenchmark::GetTests(
+	TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	using namespace AGX_StepBenchmark_helpers;
+	for (const FBenchmarkDefinition& Benchmark : Benchmarks)
+	{
+		OutBeautifiedNames.Add(Benchmark.Name);
+		OutTestCommands.Add(Benchmark.Name);
+	}
+}
+
+bool FStepBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AGX_StepBenchmark_helpers;
+
+	const FBenchmarkDefinition* Benchmark = nullptr;
+	for (const FBenchmarkDefinition& Candidate : Benchmarks)
+	{
+		if (Parameters == Candidate.Name)
+			Benchmark = &Candidate;
+	}
+	if (Benchmark == nullptr)
+	{
+		AddError(FString::Printf(TEXT("Unknown benchmark scene '%s'."), *Parameters));
+		return false;
+	}
+
+	const int32 NumSteps = AGX_BenchmarkUtils::GetNumSteps();
+
+	// Build and step the scene.
+	TMap<FString, int32> Sizes;
+	TMap<FString, double> Timings;
+	{
+		FBenchmarkScene Scene;
+		Scene.Simulation.AllocateNative();
+		Scene.Simulation.SetStatisticsEnabled(true);
+		Benchmark->Build(Scene);
+		Sizes = Scene.Sizes;
+		Timings = StepScene(Scene, NumSteps);
+		Scene.Simulation.SetStatisticsEnabled(false);
+	}
+
+	AGX_BenchmarkUtils::ReportResult(*this, Benchmark->Name, NumSteps, Sizes, Timings);
+	return true;
+}